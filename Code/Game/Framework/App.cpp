@@ -5,8 +5,11 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Framework/App.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameArena.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/RenderPipeline.hpp"
 #include "Game/Gameplay/Game.hpp"
+#include "Game/Subsystem/Audio/AudioRequestQueue.hpp"
 #include "Game/Subsystem/Window/WindowSubsystem.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Audio/AudioSystem.hpp"
@@ -21,12 +24,17 @@
 #include "Engine/Renderer/Renderer.hpp"
 #include "Engine/Resource/ResourceSubsystem.hpp"
 #include "Engine/Widget/WidgetSubsystem.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstring>
 
 //----------------------------------------------------------------------------------------------------
-App*             g_app             = nullptr;       // Created and owned by Main_Windows.cpp
-Game*            g_game            = nullptr;       // Created and owned by the App
+App*               g_app               = nullptr;       // Created and owned by Main_Windows.cpp
+AudioRequestQueue* g_audioRequestQueue = nullptr;       // Created and owned by the App
+FrameArena*        g_frameArena        = nullptr;       // Created and owned by the App
+Game*              g_game              = nullptr;       // Created and owned by the App
+RenderPipeline*    g_renderPipeline    = nullptr;       // Created and owned by the App
 // g_widgetSubsystem is defined in Engine/Core/EngineCommon.cpp
-WindowSubsystem* g_windowSubsystem = nullptr;       // Created and owned by the App
+WindowSubsystem*   g_windowSubsystem   = nullptr;       // Created and owned by the App
 
 //----------------------------------------------------------------------------------------------------
 STATIC bool App::m_isQuitting = false;
@@ -46,8 +54,16 @@ App::~App()
 //----------------------------------------------------------------------------------------------------
 /// @brief
 /// Create all engine subsystems in a specific order.
-void App::Startup()
+void App::Startup(char const* commandLine)
 {
+    // -headless: null renderer, so the overlap of simulation and render prep can be measured on its own
+    m_isHeadless = commandLine != nullptr && strstr(commandLine, "-headless") != nullptr;
+
+    m_startupTime = std::chrono::steady_clock::now();
+
+    sFrameArenaConfig constexpr sFrameArenaConfig;
+    g_frameArena = new FrameArena(sFrameArenaConfig);
+
     GEngine::Get().Startup();
 
     g_eventSystem->SubscribeEventCallbackFunction("OnCloseButtonClicked", OnWindowClose);
@@ -71,9 +87,27 @@ void App::Startup()
     g_windowSubsystem->StartUp();
     g_widgetSubsystem->StartUp();
 
+    sAudioRequestQueueConfig constexpr sAudioRequestQueueConfig;
+    g_audioRequestQueue = new AudioRequestQueue(sAudioRequestQueueConfig);
+
     // g_bitmapFont = g_resourceSubsystem->CreateOrGetBitmapFontFromFile("Data/Fonts/DaemonFont"); // DO NOT SPECIFY FILE .EXTENSION!!  (Important later on.)
     g_rng        = new RandomNumberGenerator();
+
+    // Eager, serial loading from the manifest: only what the first frame draws is created here; sounds
+    // follow one per frame in RunFrame
+    m_assetPreloader.LoadManifest("Data/Config/PreloadManifest.json");
+    m_assetPreloader.LoadStartupAssets();
+
+    sRenderPipelineConfig sRenderPipelineConfig;
+    sRenderPipelineConfig.m_isHeadless = m_isHeadless;
+    g_renderPipeline                   = new RenderPipeline(sRenderPipelineConfig);
+
     g_game       = new Game();
+
+    if (m_isHeadless)
+    {
+        g_game->ChangeGameState(eGameState::GAME);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -82,11 +116,17 @@ void App::Startup()
 void App::Shutdown()
 {
     GAME_SAFE_RELEASE(g_game);
+    GAME_SAFE_RELEASE(g_renderPipeline);
+
+    g_audioRequestQueue->StopAll();
+    GAME_SAFE_RELEASE(g_audioRequestQueue);
 
     GEngine::Get().Shutdown();
 
     g_widgetSubsystem->ShutDown();
     g_windowSubsystem->ShutDown();
+
+    GAME_SAFE_RELEASE(g_frameArena);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -98,6 +138,15 @@ void App::RunFrame()
     Update();       // Game updates / moves / spawns / hurts / kills stuff
     Render();       // Game draws current state of things
     EndFrame();     // Engine post-frame stuff
+
+    if (!m_hasReportedFirstFrame)
+    {
+        double const timeToFirstFrame = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_startupTime).count();
+        DebuggerPrintf("Time to first frame: %.2f ms\n", timeToFirstFrame);
+        m_hasReportedFirstFrame = true;
+    }
+
+    m_assetPreloader.LoadNextDeferredAsset();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -148,9 +197,21 @@ void App::Update()
 
     UpdateCursorMode();
 
-    g_windowSubsystem->Update();
+    g_renderPipeline->MarkSimulationBegin();
+
+    // Child windows hold still in the shop and attract screens
+    eGameState const gameState = g_game->GetCurrentGameState();
+    g_windowSubsystem->Update(static_cast<float>(g_game->GetGameClock()->GetDeltaSeconds()), gameState != eGameState::SHOP && gameState != eGameState::ATTRACT);
     g_widgetSubsystem->Update();
     g_game->Update();
+
+    // Render prep of this frame runs on its own thread while the main thread renders and starts the next update
+    g_game->FillRenderSnapshot(g_renderPipeline->GetSnapshotToFill());
+    g_renderPipeline->MarkSimulationEnd();
+    g_renderPipeline->PublishSnapshot();
+
+    // Every one-shot requested during the update starts here, deduplicated and voice-limited
+    g_audioRequestQueue->Flush();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -162,6 +223,13 @@ void App::Update()
 //
 void App::Render() const
 {
+    if (m_isHeadless)
+    {
+        g_renderPipeline->Submit();
+        ReportHeadlessPipelineStats();
+        return;
+    }
+
     g_renderer->ClearScreen(Rgba8::BLACK);
     g_game->Render();
 
@@ -169,7 +237,22 @@ void App::Render() const
     AABB2 const box = AABB2(Vec2::ZERO, Vec2(1600.f, 30.f));
 
     // g_theDevConsole->Render(box);
-    g_windowSubsystem->Render();
+    g_windowSubsystem->Render(g_renderPipeline->GetDrawnWindowGeometry());
+}
+
+//----------------------------------------------------------------------------------------------------
+// ReportHeadlessPipelineStats - There is no overlay without a renderer, so the numbers go to the debugger
+//----------------------------------------------------------------------------------------------------
+void App::ReportHeadlessPipelineStats() const
+{
+    static int s_frameCount = 0;
+    if (++s_frameCount % 300 != 0) return;
+
+    DebuggerPrintf("Headless pipeline: render prep %.2f ms, latency %.2f ms (%llu frames), %.0f%% of batches built during simulation.\n",
+                   g_renderPipeline->GetPrepMilliseconds(),
+                   g_renderPipeline->GetLatencyMilliseconds(),
+                   static_cast<unsigned long long>(g_renderPipeline->GetLatencyFrames()),
+                   g_renderPipeline->GetOverlappedPrepFraction() * 100.f);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -184,6 +267,7 @@ void App::EndFrame() const
     g_audio->EndFrame();
     g_windowSubsystem->EndFrame();
     g_widgetSubsystem->EndFrame();
+    g_frameArena->EndFrame();     // Last, so everything handed out this frame stays valid through every EndFrame above
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -4,7 +4,9 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
+#include <chrono>
 
+#include "Game/Framework/AssetPreloader.hpp"
 #include "Engine/Core/EventSystem.hpp"
 #include "Engine/Platform/Window.hpp"
 
@@ -18,7 +20,7 @@ class App
 public:
     App();
     ~App();
-    void Startup();
+    void Startup(char const* commandLine);
     void Shutdown();
     void RunFrame();
 
@@ -34,6 +36,12 @@ private:
     void Render() const;
     void EndFrame() const;
     void UpdateCursorMode();
+    void ReportHeadlessPipelineStats() const;
 
     Camera* m_devConsoleCamera = nullptr;
+
+    AssetPreloader                        m_assetPreloader;
+    std::chrono::steady_clock::time_point m_startupTime;
+    bool                                  m_hasReportedFirstFrame = false;
+    bool                                  m_isHeadless            = false;     // -headless on the command line
 };
@@ -0,0 +1,163 @@
+//----------------------------------------------------------------------------------------------------
+// AssetPreloader.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AssetPreloader.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Audio/AudioSystem.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Resource/ResourceSubsystem.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+//----------------------------------------------------------------------------------------------------
+static double GetPreloadTimeSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AssetPreloader::LoadManifest(String const& manifestPath)
+{
+    std::ifstream file(manifestPath, std::ios::binary);
+    if (!file.is_open())
+    {
+        DebuggerPrintf("AssetPreloader: could not open %s, assets will load lazily\n", manifestPath.c_str());
+        return false;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    String const json = buffer.str();
+
+    struct sSection
+    {
+        char const*       m_key;
+        ePreloadAssetType m_type;
+    };
+
+    sSection constexpr sections[] =
+    {
+        {"textures", ePreloadAssetType::TEXTURE},
+        {"fonts", ePreloadAssetType::FONT},
+        {"shaders", ePreloadAssetType::SHADER},
+        {"sounds", ePreloadAssetType::SOUND},
+    };
+
+    m_assets.clear();
+    std::vector<String> paths;
+
+    for (sSection const& section : sections)
+    {
+        paths.clear();
+        if (!ParseStringArray(json, section.m_key, paths)) continue;
+
+        for (String const& path : paths)
+        {
+            m_assets.push_back(sPreloadAsset{section.m_type, path});
+        }
+    }
+
+    // Sections are already in startup-then-deferred order; keep it that way if the list ever changes
+    std::stable_partition(m_assets.begin(), m_assets.end(), [](sPreloadAsset const& asset)
+    {
+        return IsNeededByFirstFrame(asset.m_type);
+    });
+
+    m_nextDeferredAsset = 0;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AssetPreloader::LoadStartupAssets()
+{
+    double const startSeconds = GetPreloadTimeSeconds();
+
+    while (m_nextDeferredAsset < m_assets.size() && IsNeededByFirstFrame(m_assets[m_nextDeferredAsset].m_type))
+    {
+        CreateResource(m_assets[m_nextDeferredAsset]);
+        ++m_nextDeferredAsset;
+    }
+
+    m_startupLoadSeconds = GetPreloadTimeSeconds() - startSeconds;
+
+    DebuggerPrintf("AssetPreloader: %zu startup assets created in %.2f ms, %zu deferred\n",
+                   m_nextDeferredAsset,
+                   m_startupLoadSeconds * 1000.0,
+                   GetRemainingDeferredAssetCount());
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AssetPreloader::LoadNextDeferredAsset()
+{
+    if (m_nextDeferredAsset >= m_assets.size()) return false;
+
+    double const startSeconds = GetPreloadTimeSeconds();
+    CreateResource(m_assets[m_nextDeferredAsset]);
+    ++m_nextDeferredAsset;
+    m_deferredLoadSeconds += GetPreloadTimeSeconds() - startSeconds;
+
+    if (m_nextDeferredAsset == m_assets.size())
+    {
+        DebuggerPrintf("AssetPreloader: deferred assets created in %.2f ms\n", m_deferredLoadSeconds * 1000.0);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void AssetPreloader::CreateResource(sPreloadAsset const& asset)
+{
+    switch (asset.m_type)
+    {
+    case ePreloadAssetType::TEXTURE: g_resourceSubsystem->CreateOrGetTextureFromFile(asset.m_resourcePath.c_str()); break;
+    case ePreloadAssetType::FONT:    g_resourceSubsystem->CreateOrGetBitmapFontFromFile(asset.m_resourcePath.c_str()); break;
+    case ePreloadAssetType::SHADER:  g_renderer->CreateOrGetShaderFromFile(asset.m_resourcePath.c_str()); break;
+    case ePreloadAssetType::SOUND:   g_audio->CreateOrGetSound(asset.m_resourcePath.c_str(), eAudioSystemSoundDimension::Sound2D); break;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// ParseStringArray - Just enough JSON for the manifest: the first "key": [ "a", "b" ] in the text
+//----------------------------------------------------------------------------------------------------
+STATIC bool AssetPreloader::ParseStringArray(String const& json, char const* key, std::vector<String>& outValues)
+{
+    String const quotedKey = Stringf("\"%s\"", key);
+
+    // The same key may also appear as a plain string (e.g. under "_usage"); take the one holding an array
+    size_t cursor = json.find(quotedKey);
+    while (cursor != String::npos)
+    {
+        size_t const valueBegin = json.find_first_not_of(" \t\r\n:", cursor + quotedKey.size());
+        if (valueBegin != String::npos && json[valueBegin] == '[')
+        {
+            cursor = valueBegin;
+            break;
+        }
+        cursor = json.find(quotedKey, cursor + quotedKey.size());
+    }
+    if (cursor == String::npos) return false;
+
+    size_t const arrayEnd = json.find(']', cursor);
+    if (arrayEnd == String::npos) return false;
+
+    while (true)
+    {
+        size_t const valueBegin = json.find('"', cursor);
+        if (valueBegin == String::npos || valueBegin > arrayEnd) break;
+
+        size_t const valueEnd = json.find('"', valueBegin + 1);
+        if (valueEnd == String::npos || valueEnd > arrayEnd) break;
+
+        outValues.push_back(json.substr(valueBegin + 1, valueEnd - valueBegin - 1));
+        cursor = valueEnd + 1;
+    }
+
+    return true;
+}
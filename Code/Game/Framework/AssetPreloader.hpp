@@ -0,0 +1,59 @@
+//----------------------------------------------------------------------------------------------------
+// AssetPreloader.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class ePreloadAssetType : uint8_t
+{
+    TEXTURE,
+    FONT,
+    SHADER,
+    SOUND,
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sPreloadAsset
+{
+    ePreloadAssetType m_type = ePreloadAssetType::TEXTURE;
+    String            m_resourcePath;     // What the CreateOrGet* call expects
+};
+
+//----------------------------------------------------------------------------------------------------
+// AssetPreloader
+// Manifest-driven eager loading: the resources listed in Data/Config/PreloadManifest.json are created
+// by plain serial CreateOrGet* calls on the main thread, before the first frame that needs them,
+// instead of lazily by the first call site. Nothing is decoded or read in the background.
+//
+// Textures, fonts and shaders (what the first frame draws) are created in StartUp. Sounds are
+// created one per frame afterwards, while attract mode runs; a sound requested before its turn is
+// simply loaded by its own CreateOrGetSound call, as it was before the manifest existed.
+//----------------------------------------------------------------------------------------------------
+class AssetPreloader
+{
+public:
+    bool LoadManifest(String const& manifestPath);
+    void LoadStartupAssets();
+    bool LoadNextDeferredAsset();     // Returns false once every deferred asset has been created
+
+    size_t GetAssetCount() const { return m_assets.size(); }
+    size_t GetRemainingDeferredAssetCount() const { return m_assets.size() - m_nextDeferredAsset; }
+    double GetStartupLoadSeconds() const { return m_startupLoadSeconds; }
+    double GetDeferredLoadSeconds() const { return m_deferredLoadSeconds; }
+
+private:
+    static bool ParseStringArray(String const& json, char const* key, std::vector<String>& outValues);
+    static bool IsNeededByFirstFrame(ePreloadAssetType type) { return type != ePreloadAssetType::SOUND; }
+    static void CreateResource(sPreloadAsset const& asset);
+
+    std::vector<sPreloadAsset> m_assets;                       // Startup assets first, then deferred ones
+    size_t                     m_nextDeferredAsset   = 0;
+    double                     m_startupLoadSeconds  = 0.0;
+    double                     m_deferredLoadSeconds = 0.0;
+};
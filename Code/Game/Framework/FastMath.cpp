@@ -0,0 +1,41 @@
+//----------------------------------------------------------------------------------------------------
+// FastMath.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FastMath.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void FastMath::SinCosDegrees(float const* degrees, float* outSin, float* outCos, int const count)
+{
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 s, c;
+        SinCosDegrees4(_mm_loadu_ps(degrees + i), s, c);
+        _mm_storeu_ps(outSin + i, s);
+        _mm_storeu_ps(outCos + i, c);
+    }
+
+    for (; i < count; ++i)
+    {
+        SinCosDegrees(degrees[i], outSin[i], outCos[i]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void FastMath::Atan2Degrees(float const* y, float const* x, float* outDegrees, int const count)
+{
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(outDegrees + i, Atan2Degrees4(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
+    }
+
+    for (; i < count; ++i)
+    {
+        outDegrees[i] = Atan2Degrees(y[i], x[i]);
+    }
+}
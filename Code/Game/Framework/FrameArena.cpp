@@ -0,0 +1,208 @@
+//----------------------------------------------------------------------------------------------------
+// FrameArena.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameArena.hpp"
+#include "Game/Framework/MemoryTracker.hpp"
+
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#if defined(GAME_TRACK_HEAP_ALLOCATIONS)
+#include <atomic>
+
+//----------------------------------------------------------------------------------------------------
+// Replacing the global operator new in one translation unit is enough for the whole executable.
+// Only the counter is added; the blocks still come from malloc and every matching delete frees them.
+//----------------------------------------------------------------------------------------------------
+static std::atomic<size_t> s_heapAllocationCount = 0;
+
+void* operator new(size_t const byteCount)
+{
+    s_heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* memory = std::malloc(byteCount > 0 ? byteCount : 1);
+    if (memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+
+void* operator new[](size_t const byteCount)
+{
+    return operator new(byteCount);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+static size_t GetHeapAllocationCount()
+{
+    return s_heapAllocationCount.load(std::memory_order_relaxed);
+}
+#else
+static size_t GetHeapAllocationCount()
+{
+    return 0;
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------
+FrameArena::FrameArena(sFrameArenaConfig const& config)
+    : m_config(config)
+{
+    for (sBuffer& buffer : m_buffers)
+    {
+        buffer.m_memory = std::make_unique<std::byte[]>(m_config.m_bytesPerBuffer);
+        buffer.m_overflowBlocks.reserve(16);
+        MemoryTracker::RecordAllocation(eMemoryTag::FRAME_ARENA, m_config.m_bytesPerBuffer);
+    }
+
+    m_vertexListPool.reserve(m_config.m_initialVertexListCount);
+    for (size_t i = 0; i < m_config.m_initialVertexListCount; ++i)
+    {
+        m_vertexListPool.push_back(std::make_unique<VertexList_PCU>());
+    }
+
+    m_heapAllocationCountAtFrame = GetHeapAllocationCount();
+}
+
+//----------------------------------------------------------------------------------------------------
+FrameArena::~FrameArena()
+{
+    for (sBuffer& buffer : m_buffers)
+    {
+        RewindBuffer(buffer);
+        MemoryTracker::RecordFree(eMemoryTag::FRAME_ARENA, m_config.m_bytesPerBuffer);
+    }
+
+    MemoryTracker::RecordResize(eMemoryTag::VERTEX_LIST, m_trackedVertexListBytes, 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+void* FrameArena::Allocate(size_t const byteCount, size_t const alignment)
+{
+    sBuffer& buffer = m_buffers[m_currentBuffer];
+
+    uintptr_t const base    = reinterpret_cast<uintptr_t>(buffer.m_memory.get());
+    uintptr_t const aligned = (base + buffer.m_offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    size_t const    offset  = static_cast<size_t>(aligned - base);
+
+    if (offset + byteCount <= m_config.m_bytesPerBuffer)
+    {
+        buffer.m_offset = offset + byteCount;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    // The buffer is full: keep the frame running and report it so the budget can be raised
+    if (m_overflowCount == 0)
+    {
+        DebuggerPrintf("FrameArena: %zu byte buffer exhausted, falling back to the heap\n", m_config.m_bytesPerBuffer);
+    }
+    ++m_overflowCount;
+
+    void* memory = ::operator new(byteCount, std::align_val_t(alignment));
+    buffer.m_overflowBlocks.push_back({memory, byteCount, alignment});
+    MemoryTracker::RecordAllocation(eMemoryTag::FRAME_ARENA, byteCount);
+    return memory;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string_view FrameArena::Format(char const* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int const length = std::vsnprintf(nullptr, 0, format, argsCopy);
+    va_end(argsCopy);
+
+    if (length <= 0)
+    {
+        va_end(args);
+        return {};
+    }
+
+    char* text = static_cast<char*>(Allocate(static_cast<size_t>(length) + 1, alignof(char)));
+    std::vsnprintf(text, static_cast<size_t>(length) + 1, format, args);
+    va_end(args);
+
+    return std::string_view(text, static_cast<size_t>(length));
+}
+
+//----------------------------------------------------------------------------------------------------
+VertexList_PCU& FrameArena::AcquireVertexList()
+{
+    if (m_vertexListsInUse == m_vertexListPool.size())
+    {
+        m_vertexListPool.push_back(std::make_unique<VertexList_PCU>());
+    }
+
+    VertexList_PCU& verts = *m_vertexListPool[m_vertexListsInUse++];
+    verts.clear();
+    return verts;
+}
+
+//----------------------------------------------------------------------------------------------------
+// EndFrame - Publish the frame's numbers, then flip buffers and rewind the one from two frames ago
+//----------------------------------------------------------------------------------------------------
+void FrameArena::EndFrame()
+{
+    size_t const heapAllocationCount = GetHeapAllocationCount();
+
+    m_bytesUsedLastFrame           = m_buffers[m_currentBuffer].m_offset;
+    m_overflowCountLastFrame       = m_overflowCount;
+    m_vertexListCountLastFrame     = m_vertexListsInUse;
+    m_heapAllocationCountLastFrame = heapAllocationCount - m_heapAllocationCountAtFrame;
+    m_heapAllocationCountAtFrame   = heapAllocationCount;
+
+    // Pooled lists only grow, so their capacity is reported as a gauge rather than per allocation
+    size_t vertexListBytes = 0;
+    for (std::unique_ptr<VertexList_PCU> const& verts : m_vertexListPool)
+    {
+        vertexListBytes += verts->capacity() * sizeof(Vertex_PCU);
+    }
+    MemoryTracker::RecordResize(eMemoryTag::VERTEX_LIST, m_trackedVertexListBytes, vertexListBytes);
+    m_trackedVertexListBytes = vertexListBytes;
+
+    m_overflowCount    = 0;
+    m_vertexListsInUse = 0;
+    m_currentBuffer    = 1 - m_currentBuffer;
+    RewindBuffer(m_buffers[m_currentBuffer]);
+}
+
+//----------------------------------------------------------------------------------------------------
+void FrameArena::RewindBuffer(sBuffer& buffer)
+{
+    for (sOverflowBlock const& block : buffer.m_overflowBlocks)
+    {
+        ::operator delete(block.m_memory, std::align_val_t(block.m_alignment));
+        MemoryTracker::RecordFree(eMemoryTag::FRAME_ARENA, block.m_byteCount);
+    }
+
+    buffer.m_overflowBlocks.clear();
+    buffer.m_offset = 0;
+}
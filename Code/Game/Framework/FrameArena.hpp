@@ -0,0 +1,132 @@
+//----------------------------------------------------------------------------------------------------
+// FrameArena.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "Engine/Renderer/VertexUtils.hpp"
+
+// #define GAME_TRACK_HEAP_ALLOCATIONS     // (If uncommented) Counts every global operator new so the overlay can show heap allocations per frame.
+
+//----------------------------------------------------------------------------------------------------
+struct sFrameArenaConfig
+{
+    size_t m_bytesPerBuffer         = 1024 * 1024;     // Each of the two buffers; anything past this overflows to the heap
+    size_t m_initialVertexListCount = 64;
+};
+
+//----------------------------------------------------------------------------------------------------
+// FrameArena
+// Linear allocator for data that only lives for a frame. Two buffers alternate: allocations go to the
+// current buffer, EndFrame() flips to the other one and rewinds it, so memory handed out in frame N
+// stays valid through frame N + 1 and is reused in frame N + 2. Nothing is freed individually.
+//
+// Vertex lists are handed out from a pool instead of the buffers because the renderer takes
+// VertexList_PCU by type; the pool keeps each list's capacity, so steady-state frames build their
+// geometry without touching the heap.
+//----------------------------------------------------------------------------------------------------
+class FrameArena
+{
+public:
+    explicit FrameArena(sFrameArenaConfig const& config);
+    ~FrameArena();
+
+    FrameArena(FrameArena const&)            = delete;
+    FrameArena& operator=(FrameArena const&) = delete;
+
+    void*            Allocate(size_t byteCount, size_t alignment = alignof(std::max_align_t));
+    std::string_view Format(char const* format, ...);     // printf-style; the text is null-terminated in the arena
+    VertexList_PCU&  AcquireVertexList();                 // Empty list, valid until the next EndFrame()
+
+    template <typename T>
+    class Allocator;
+
+    template <typename T>
+    std::vector<T, Allocator<T>> MakeVector(size_t reserveCount = 0);
+
+    void EndFrame();
+
+    // Instrumentation
+    size_t GetBytesUsedLastFrame() const { return m_bytesUsedLastFrame; }
+    size_t GetOverflowCountLastFrame() const { return m_overflowCountLastFrame; }
+    size_t GetVertexListCountLastFrame() const { return m_vertexListCountLastFrame; }
+    size_t GetHeapAllocationCountLastFrame() const { return m_heapAllocationCountLastFrame; }     // 0 unless GAME_TRACK_HEAP_ALLOCATIONS
+
+#if defined(GAME_TRACK_HEAP_ALLOCATIONS)
+    static constexpr bool IS_COUNTING_HEAP_ALLOCATIONS = true;
+#else
+    static constexpr bool IS_COUNTING_HEAP_ALLOCATIONS = false;
+#endif
+
+private:
+    struct sOverflowBlock
+    {
+        void*  m_memory    = nullptr;
+        size_t m_byteCount = 0;
+        size_t m_alignment = 0;
+    };
+
+    struct sBuffer
+    {
+        std::unique_ptr<std::byte[]> m_memory;
+        size_t                       m_offset = 0;
+        std::vector<sOverflowBlock>  m_overflowBlocks;     // Heap blocks for requests that did not fit; freed on rewind
+    };
+
+    void RewindBuffer(sBuffer& buffer);
+
+    sFrameArenaConfig                            m_config;
+    sBuffer                                      m_buffers[2];
+    int                                          m_currentBuffer = 0;
+    std::vector<std::unique_ptr<VertexList_PCU>> m_vertexListPool;     // unique_ptr keeps handed-out references stable as the pool grows
+    size_t                                       m_vertexListsInUse = 0;
+
+    size_t m_overflowCount                = 0;
+    size_t m_bytesUsedLastFrame           = 0;
+    size_t m_overflowCountLastFrame       = 0;
+    size_t m_vertexListCountLastFrame     = 0;
+    size_t m_heapAllocationCountLastFrame = 0;
+    size_t m_heapAllocationCountAtFrame   = 0;
+    size_t m_trackedVertexListBytes       = 0;     // Pooled capacity last reported to MemoryTracker
+};
+
+//----------------------------------------------------------------------------------------------------
+// Standard allocator over a FrameArena; deallocate is a no-op and the memory goes away with the frame
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+class FrameArena::Allocator
+{
+public:
+    using value_type = T;
+
+    explicit Allocator(FrameArena* arena) noexcept : m_arena(arena) {}
+
+    template <typename U>
+    Allocator(Allocator<U> const& other) noexcept : m_arena(other.m_arena) {}
+
+    T*   allocate(size_t const count) { return static_cast<T*>(m_arena->Allocate(sizeof(T) * count, alignof(T))); }
+    void deallocate(T*, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(Allocator<U> const& other) const noexcept { return m_arena == other.m_arena; }
+
+    FrameArena* m_arena = nullptr;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+using FrameVector = std::vector<T, FrameArena::Allocator<T>>;
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+std::vector<T, FrameArena::Allocator<T>> FrameArena::MakeVector(size_t const reserveCount)
+{
+    std::vector<T, Allocator<T>> vector{Allocator<T>(this)};
+    if (reserveCount > 0) vector.reserve(reserveCount);
+    return vector;
+}
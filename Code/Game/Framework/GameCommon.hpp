@@ -11,7 +11,10 @@
 struct Rgba8;
 struct Vec2;
 class App;
+class AudioRequestQueue;
+class FrameArena;
 class Game;
+class RenderPipeline;
 class WidgetSubsystem;
 class WindowSubsystem;
 
@@ -19,7 +22,10 @@ class WindowSubsystem;
 //----------------------------------------------------------------------------------------------------
 //-one-time declaration
 extern App*                   g_app;
+extern AudioRequestQueue*     g_audioRequestQueue;
+extern FrameArena*            g_frameArena;
 extern Game*                  g_game;
+extern RenderPipeline*        g_renderPipeline;
 extern WidgetSubsystem*       g_widgetSubsystem;
 extern WindowSubsystem*       g_windowSubsystem;
 
@@ -18,10 +18,9 @@ int WINAPI WinMain(HINSTANCE const applicationInstanceHandle,
                    int)
 {
     UNUSED(applicationInstanceHandle)
-    UNUSED(commandLineString)
 
     g_app = new App();
-    g_app->Startup();
+    g_app->Startup(commandLineString);
     g_app->RunMainLoop();
     g_app->Shutdown();
 
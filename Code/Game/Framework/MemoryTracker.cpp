@@ -0,0 +1,173 @@
+//----------------------------------------------------------------------------------------------------
+// MemoryTracker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/MemoryTracker.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    struct sTagCounters
+    {
+        std::atomic<size_t> m_liveBytes            = 0;
+        std::atomic<size_t> m_liveAllocationCount  = 0;
+        std::atomic<size_t> m_totalAllocationCount = 0;
+        std::atomic<size_t> m_highWaterBytes       = 0;
+    };
+
+    sTagCounters s_tagCounters[static_cast<size_t>(eMemoryTag::COUNT)];
+
+    char const* const s_tagNames[static_cast<size_t>(eMemoryTag::COUNT)] =
+    {
+        "Game",
+        "Entity",
+        "Projectile",
+        "Coin",
+        "Window",
+        "SwapChain",
+        "Widget",
+        "VertexList",
+        "FrameArena",
+    };
+
+    sTagCounters& GetCounters(eMemoryTag const tag)
+    {
+        return s_tagCounters[static_cast<size_t>(tag)];
+    }
+
+    void AddLiveBytes(sTagCounters& counters, size_t const byteCount)
+    {
+        size_t const liveBytes = counters.m_liveBytes.fetch_add(byteCount, std::memory_order_relaxed) + byteCount;
+        size_t       highWater = counters.m_highWaterBytes.load(std::memory_order_relaxed);
+
+        while (liveBytes > highWater && !counters.m_highWaterBytes.compare_exchange_weak(highWater, liveBytes, std::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void MemoryTracker::RecordAllocation(eMemoryTag const tag, size_t const byteCount)
+{
+    sTagCounters& counters = GetCounters(tag);
+    counters.m_liveAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    counters.m_totalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    AddLiveBytes(counters, byteCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+void MemoryTracker::RecordFree(eMemoryTag const tag, size_t const byteCount)
+{
+    sTagCounters& counters = GetCounters(tag);
+    counters.m_liveAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+    counters.m_liveBytes.fetch_sub(byteCount, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+void MemoryTracker::RecordResize(eMemoryTag const tag, size_t const oldByteCount, size_t const newByteCount)
+{
+    sTagCounters& counters = GetCounters(tag);
+
+    if (newByteCount > oldByteCount)
+    {
+        AddLiveBytes(counters, newByteCount - oldByteCount);
+    }
+    else
+    {
+        counters.m_liveBytes.fetch_sub(oldByteCount - newByteCount, std::memory_order_relaxed);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void* MemoryTracker::AllocateTagged(eMemoryTag const tag, size_t const byteCount)
+{
+    void* memory = ::operator new(byteCount);
+    RecordAllocation(tag, byteCount);
+    return memory;
+}
+
+//----------------------------------------------------------------------------------------------------
+void MemoryTracker::FreeTagged(eMemoryTag const tag, void* memory, size_t const byteCount)
+{
+    if (memory == nullptr) return;
+
+    RecordFree(tag, byteCount);
+    ::operator delete(memory);
+}
+
+//----------------------------------------------------------------------------------------------------
+sMemoryTagStats MemoryTracker::GetStats(eMemoryTag const tag)
+{
+    sTagCounters const& counters = GetCounters(tag);
+
+    sMemoryTagStats stats;
+    stats.m_liveBytes            = counters.m_liveBytes.load(std::memory_order_relaxed);
+    stats.m_liveAllocationCount  = counters.m_liveAllocationCount.load(std::memory_order_relaxed);
+    stats.m_totalAllocationCount = counters.m_totalAllocationCount.load(std::memory_order_relaxed);
+    stats.m_highWaterBytes       = counters.m_highWaterBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+char const* MemoryTracker::GetTagName(eMemoryTag const tag)
+{
+    return s_tagNames[static_cast<size_t>(tag)];
+}
+
+//----------------------------------------------------------------------------------------------------
+bool MemoryTracker::WriteJsonReport(String const& filePath, int const waveNumber)
+{
+    std::filesystem::path const path(filePath);
+    if (path.has_parent_path())
+    {
+        std::error_code errorCode;
+        std::filesystem::create_directories(path.parent_path(), errorCode);
+    }
+
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+    {
+        DebuggerPrintf("MemoryTracker: Could not write %s\n", filePath.c_str());
+        return false;
+    }
+
+    sMemoryTagStats totals;
+
+    file << "{\n";
+    file << "    \"wave\": " << waveNumber << ",\n";
+    file << "    \"tags\": [\n";
+
+    for (size_t i = 0; i < static_cast<size_t>(eMemoryTag::COUNT); ++i)
+    {
+        eMemoryTag const      tag   = static_cast<eMemoryTag>(i);
+        sMemoryTagStats const stats = GetStats(tag);
+
+        totals.m_liveBytes += stats.m_liveBytes;
+        totals.m_liveAllocationCount += stats.m_liveAllocationCount;
+        totals.m_totalAllocationCount += stats.m_totalAllocationCount;
+
+        file << "        { \"tag\": \"" << GetTagName(tag) << "\""
+             << ", \"liveBytes\": " << stats.m_liveBytes
+             << ", \"liveAllocations\": " << stats.m_liveAllocationCount
+             << ", \"totalAllocations\": " << stats.m_totalAllocationCount
+             << ", \"highWaterBytes\": " << stats.m_highWaterBytes
+             << " }" << (i + 1 < static_cast<size_t>(eMemoryTag::COUNT) ? "," : "") << "\n";
+    }
+
+    file << "    ],\n";
+    file << "    \"totalLiveBytes\": " << totals.m_liveBytes << ",\n";
+    file << "    \"totalLiveAllocations\": " << totals.m_liveAllocationCount << ",\n";
+    file << "    \"totalAllocations\": " << totals.m_totalAllocationCount << "\n";
+    file << "}\n";
+
+    return file.good();
+}
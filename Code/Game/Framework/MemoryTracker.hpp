@@ -0,0 +1,98 @@
+//----------------------------------------------------------------------------------------------------
+// MemoryTracker.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eMemoryTag : uint8_t
+{
+    GAME,
+    ENTITY,
+    PROJECTILE,
+    COIN,
+    WINDOW,
+    SWAP_CHAIN,       // Estimated from the client size; the buffers live in the driver
+    WIDGET,
+    VERTEX_LIST,
+    FRAME_ARENA,
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sMemoryTagStats
+{
+    size_t m_liveBytes            = 0;
+    size_t m_liveAllocationCount  = 0;
+    size_t m_totalAllocationCount = 0;     // Since startup
+    size_t m_highWaterBytes       = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// MemoryTracker Namespace
+// Per-tag byte and allocation counters. Every update is a handful of relaxed atomics, so tracking stays
+// on in every build. Objects are tagged with GAME_MEMORY_TAG (class operator new/delete), containers
+// with TrackedAllocator, and memory the game does not allocate itself (swap chains, objects created
+// by engine factories) is reported by hand with RecordAllocation / RecordFree.
+//----------------------------------------------------------------------------------------------------
+namespace MemoryTracker
+{
+    void RecordAllocation(eMemoryTag tag, size_t byteCount);
+    void RecordFree(eMemoryTag tag, size_t byteCount);
+    void RecordResize(eMemoryTag tag, size_t oldByteCount, size_t newByteCount);     // For gauges such as pooled capacity
+
+    void* AllocateTagged(eMemoryTag tag, size_t byteCount);
+    void  FreeTagged(eMemoryTag tag, void* memory, size_t byteCount);
+
+    sMemoryTagStats GetStats(eMemoryTag tag);
+    char const*     GetTagName(eMemoryTag tag);
+
+    // Writes every tag's stats as JSON; returns false if the file could not be written
+    bool WriteJsonReport(String const& filePath, int waveNumber);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Standard allocator that charges a tag for everything it allocates
+//----------------------------------------------------------------------------------------------------
+template <typename T, eMemoryTag Tag>
+class TrackedAllocator
+{
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TrackedAllocator<U, Tag>;
+    };
+
+    TrackedAllocator() noexcept = default;
+
+    template <typename U>
+    TrackedAllocator(TrackedAllocator<U, Tag> const&) noexcept {}
+
+    T*   allocate(size_t const count) { return static_cast<T*>(MemoryTracker::AllocateTagged(Tag, sizeof(T) * count)); }
+    void deallocate(T* memory, size_t const count) noexcept { MemoryTracker::FreeTagged(Tag, memory, sizeof(T) * count); }
+
+    template <typename U>
+    bool operator==(TrackedAllocator<U, Tag> const&) const noexcept { return true; }
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, eMemoryTag Tag>
+using TrackedVector = std::vector<T, TrackedAllocator<T, Tag>>;
+
+//----------------------------------------------------------------------------------------------------
+// Place inside a class body; derived classes inherit the tag. The sized delete receives the dynamic
+// size through the virtual destructor, so no per-block header is needed.
+//----------------------------------------------------------------------------------------------------
+#define GAME_MEMORY_TAG(tag)                                                                                    \
+    static void* operator new(size_t const byteCount) { return MemoryTracker::AllocateTagged(tag, byteCount); } \
+    static void  operator delete(void* memory, size_t const byteCount) { MemoryTracker::FreeTagged(tag, memory, byteCount); }
@@ -0,0 +1,129 @@
+//----------------------------------------------------------------------------------------------------
+// PointSpatialIndex.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/PointSpatialIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------
+PointSpatialIndex::PointSpatialIndex(float const cellSize)
+    : m_cellSize(cellSize)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void PointSpatialIndex::Build(AABB2 const& bounds, float const* positionX, float const* positionY, int const pointCount)
+{
+    m_bounds     = bounds;
+    m_cellCountX = std::max(1, static_cast<int>(ceilf((bounds.m_maxs.x - bounds.m_mins.x) / m_cellSize)));
+    m_cellCountY = std::max(1, static_cast<int>(ceilf((bounds.m_maxs.y - bounds.m_mins.y) / m_cellSize)));
+
+    size_t const cellCount = static_cast<size_t>(m_cellCountX) * static_cast<size_t>(m_cellCountY);
+    m_cellStarts.assign(cellCount + 1, 0);
+    m_pointCells.resize(static_cast<size_t>(pointCount));
+    m_sortedX.resize(static_cast<size_t>(pointCount));
+    m_sortedY.resize(static_cast<size_t>(pointCount));
+    m_sortedIndex.resize(static_cast<size_t>(pointCount));
+
+    // Count per cell, offset by one so the prefix sum below yields each cell's first slot
+    for (int i = 0; i < pointCount; ++i)
+    {
+        int const cell = GetCellY(positionY[i]) * m_cellCountX + GetCellX(positionX[i]);
+        m_pointCells[i] = cell;
+        ++m_cellStarts[cell + 1];
+    }
+
+    for (size_t c = 0; c < cellCount; ++c)
+    {
+        m_cellStarts[c + 1] += m_cellStarts[c];
+    }
+
+    m_cellCursor.assign(m_cellStarts.begin(), m_cellStarts.end() - 1);
+
+    for (int i = 0; i < pointCount; ++i)
+    {
+        int const slot      = m_cellCursor[m_pointCells[i]]++;
+        m_sortedX[slot]     = positionX[i];
+        m_sortedY[slot]     = positionY[i];
+        m_sortedIndex[slot] = i;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int PointSpatialIndex::QueryRadius(float const x,
+                                   float const y,
+                                   float const radius,
+                                   int const   excludeIndex,
+                                   int const   maxResults,
+                                   int*        outIndices) const
+{
+    if (m_sortedIndex.empty() || maxResults <= 0) return 0;
+
+    float const radiusSq   = radius * radius;
+    int const   centerX    = GetCellX(x);
+    int const   centerY    = GetCellY(y);
+    int const   centerCell = centerY * m_cellCountX + centerX;
+    int         count      = 0;
+
+    if (ScanCell(centerCell, x, y, radiusSq, excludeIndex, maxResults, outIndices, count)) return count;
+
+    int const minX = GetCellX(x - radius);
+    int const minY = GetCellY(y - radius);
+    int const maxX = GetCellX(x + radius);
+    int const maxY = GetCellY(y + radius);
+
+    for (int cellY = minY; cellY <= maxY; ++cellY)
+    {
+        for (int cellX = minX; cellX <= maxX; ++cellX)
+        {
+            int const cell = cellY * m_cellCountX + cellX;
+            if (cell == centerCell) continue;
+
+            if (ScanCell(cell, x, y, radiusSq, excludeIndex, maxResults, outIndices, count)) return count;
+        }
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------------------------
+int PointSpatialIndex::GetCellX(float const x) const
+{
+    return std::clamp(static_cast<int>((x - m_bounds.m_mins.x) / m_cellSize), 0, m_cellCountX - 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+int PointSpatialIndex::GetCellY(float const y) const
+{
+    return std::clamp(static_cast<int>((y - m_bounds.m_mins.y) / m_cellSize), 0, m_cellCountY - 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+// ScanCell - Returns true once maxResults is reached
+//----------------------------------------------------------------------------------------------------
+bool PointSpatialIndex::ScanCell(int const   cell,
+                                 float const x,
+                                 float const y,
+                                 float const radiusSq,
+                                 int const   excludeIndex,
+                                 int const   maxResults,
+                                 int*        outIndices,
+                                 int&        ioCount) const
+{
+    int const end = m_cellStarts[cell + 1];
+
+    for (int slot = m_cellStarts[cell]; slot < end; ++slot)
+    {
+        float const dx = m_sortedX[slot] - x;
+        float const dy = m_sortedY[slot] - y;
+        if (dx * dx + dy * dy > radiusSq || m_sortedIndex[slot] == excludeIndex) continue;
+
+        outIndices[ioCount++] = m_sortedIndex[slot];
+        if (ioCount == maxResults) return true;
+    }
+
+    return false;
+}
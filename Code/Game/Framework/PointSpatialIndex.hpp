@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------------------------------------
+// PointSpatialIndex.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// PointSpatialIndex
+// Uniform grid over a fixed bounds answering "which points lie within r of here". Build() counting-
+// sorts the points by cell into one flat array (positions copied alongside), so a query walks a few
+// contiguous runs instead of per-cell vectors, and rebuilding every frame only touches storage that
+// is already allocated. Points past the bounds land in the edge cells.
+//----------------------------------------------------------------------------------------------------
+class PointSpatialIndex
+{
+public:
+    explicit PointSpatialIndex(float cellSize = 64.f);
+
+    void Build(AABB2 const& bounds, float const* positionX, float const* positionY, int pointCount);
+
+    // Writes up to maxResults indices of points within radius of (x, y), skipping excludeIndex, and
+    // returns how many were written. The centre cell is scanned first, so a capped query keeps the
+    // closest candidates rather than those from the lowest cells.
+    int QueryRadius(float x, float y, float radius, int excludeIndex, int maxResults, int* outIndices) const;
+
+    int   GetPointCount() const { return static_cast<int>(m_sortedIndex.size()); }
+    float GetCellSize() const { return m_cellSize; }
+
+private:
+    int  GetCellX(float x) const;
+    int  GetCellY(float y) const;
+    bool ScanCell(int cell, float x, float y, float radiusSq, int excludeIndex, int maxResults, int* outIndices, int& ioCount) const;
+
+    float              m_cellSize   = 64.f;
+    AABB2              m_bounds;
+    int                m_cellCountX = 0;
+    int                m_cellCountY = 0;
+    std::vector<int>   m_cellStarts;      // Cell c owns sorted slots [m_cellStarts[c], m_cellStarts[c + 1])
+    std::vector<int>   m_cellCursor;      // Build scratch
+    std::vector<int>   m_pointCells;      // Build scratch
+    std::vector<float> m_sortedX;
+    std::vector<float> m_sortedY;
+    std::vector<int>   m_sortedIndex;     // Caller's point index per sorted slot
+};
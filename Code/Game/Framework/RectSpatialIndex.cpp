@@ -0,0 +1,128 @@
+//----------------------------------------------------------------------------------------------------
+// RectSpatialIndex.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RectSpatialIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Engine/Core/EngineCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+RectSpatialIndex::RectSpatialIndex(float const cellSize)
+    : m_cellSize(cellSize)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void RectSpatialIndex::Reset(AABB2 const& bounds)
+{
+    m_bounds     = bounds;
+    m_cellCountX = std::max(1, static_cast<int>(ceilf((bounds.m_maxs.x - bounds.m_mins.x) / m_cellSize)));
+    m_cellCountY = std::max(1, static_cast<int>(ceilf((bounds.m_maxs.y - bounds.m_mins.y) / m_cellSize)));
+
+    size_t const cellCount = static_cast<size_t>(m_cellCountX) * static_cast<size_t>(m_cellCountY);
+    if (m_cells.size() != cellCount)
+    {
+        m_cells.resize(cellCount);
+    }
+
+    for (std::vector<int>& cell : m_cells)
+    {
+        cell.clear();
+    }
+
+    m_rects.clear();
+    m_queryStamps.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+int RectSpatialIndex::AddRect(AABB2 const& rect)
+{
+    int const rectIndex = static_cast<int>(m_rects.size());
+    m_rects.push_back(rect);
+    m_queryStamps.push_back(0);
+
+    int minX, minY, maxX, maxY;
+    GetCellRange(rect, minX, minY, maxX, maxY);
+
+    for (int y = minY; y <= maxY; ++y)
+    {
+        for (int x = minX; x <= maxX; ++x)
+        {
+            m_cells[static_cast<size_t>(y * m_cellCountX + x)].push_back(rectIndex);
+        }
+    }
+
+    return rectIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool RectSpatialIndex::OverlapsAny(AABB2 const& rect) const
+{
+    if (m_rects.empty()) return false;
+
+    int minX, minY, maxX, maxY;
+    GetCellRange(rect, minX, minY, maxX, maxY);
+
+    for (int y = minY; y <= maxY; ++y)
+    {
+        for (int x = minX; x <= maxX; ++x)
+        {
+            for (int const rectIndex : m_cells[static_cast<size_t>(y * m_cellCountX + x)])
+            {
+                if (DoRectsOverlap(rect, m_rects[rectIndex])) return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void RectSpatialIndex::QueryOverlapping(AABB2 const& rect, std::vector<int>& outRectIndices) const
+{
+    outRectIndices.clear();
+    if (m_rects.empty()) return;
+
+    // A rect spanning several cells is seen once per cell; the stamp reports it only once
+    ++m_queryStamp;
+
+    int minX, minY, maxX, maxY;
+    GetCellRange(rect, minX, minY, maxX, maxY);
+
+    for (int y = minY; y <= maxY; ++y)
+    {
+        for (int x = minX; x <= maxX; ++x)
+        {
+            for (int const rectIndex : m_cells[static_cast<size_t>(y * m_cellCountX + x)])
+            {
+                if (m_queryStamps[rectIndex] == m_queryStamp) continue;
+                m_queryStamps[rectIndex] = m_queryStamp;
+
+                if (DoRectsOverlap(rect, m_rects[rectIndex]))
+                {
+                    outRectIndices.push_back(rectIndex);
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool RectSpatialIndex::DoRectsOverlap(AABB2 const& a, AABB2 const& b)
+{
+    return a.m_mins.x < b.m_maxs.x && b.m_mins.x < a.m_maxs.x &&
+        a.m_mins.y < b.m_maxs.y && b.m_mins.y < a.m_maxs.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+void RectSpatialIndex::GetCellRange(AABB2 const& rect, int& outMinX, int& outMinY, int& outMaxX, int& outMaxY) const
+{
+    outMinX = std::clamp(static_cast<int>(floorf((rect.m_mins.x - m_bounds.m_mins.x) / m_cellSize)), 0, m_cellCountX - 1);
+    outMinY = std::clamp(static_cast<int>(floorf((rect.m_mins.y - m_bounds.m_mins.y) / m_cellSize)), 0, m_cellCountY - 1);
+    outMaxX = std::clamp(static_cast<int>(floorf((rect.m_maxs.x - m_bounds.m_mins.x) / m_cellSize)), 0, m_cellCountX - 1);
+    outMaxY = std::clamp(static_cast<int>(floorf((rect.m_maxs.y - m_bounds.m_mins.y) / m_cellSize)), 0, m_cellCountY - 1);
+}
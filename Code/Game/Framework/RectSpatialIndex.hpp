@@ -0,0 +1,44 @@
+//----------------------------------------------------------------------------------------------------
+// RectSpatialIndex.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// RectSpatialIndex
+// Uniform grid over a fixed bounds that answers "which stored rects overlap this rect". Rects are
+// registered in every cell they touch; rects reaching past the bounds land in the edge cells.
+// Reset() keeps the cell storage, so rebuilding the index every frame does not allocate.
+//----------------------------------------------------------------------------------------------------
+class RectSpatialIndex
+{
+public:
+    explicit RectSpatialIndex(float cellSize = 128.f);
+
+    void Reset(AABB2 const& bounds);
+    int  AddRect(AABB2 const& rect);
+
+    bool OverlapsAny(AABB2 const& rect) const;
+    void QueryOverlapping(AABB2 const& rect, std::vector<int>& outRectIndices) const;
+
+    int          GetRectCount() const { return static_cast<int>(m_rects.size()); }
+    AABB2 const& GetRect(int rectIndex) const { return m_rects[rectIndex]; }
+
+    static bool DoRectsOverlap(AABB2 const& a, AABB2 const& b);
+
+private:
+    void GetCellRange(AABB2 const& rect, int& outMinX, int& outMinY, int& outMaxX, int& outMaxY) const;
+
+    float                         m_cellSize   = 128.f;
+    AABB2                         m_bounds;
+    int                           m_cellCountX = 0;
+    int                           m_cellCountY = 0;
+    std::vector<std::vector<int>> m_cells;
+    std::vector<AABB2>            m_rects;
+    mutable std::vector<int>      m_queryStamps;     // Per rect, last query that reported it
+    mutable int                   m_queryStamp = 0;
+};
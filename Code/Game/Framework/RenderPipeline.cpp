@@ -0,0 +1,285 @@
+//----------------------------------------------------------------------------------------------------
+// RenderPipeline.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RenderPipeline.hpp"
+
+#include <chrono>
+#include <intrin.h>
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/FastMath.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void AddPrepCost(std::vector<sRenderPrepCost>& prepCosts, int const rowIndex, uint64_t const ticks)
+    {
+        if (rowIndex >= static_cast<int>(prepCosts.size())) prepCosts.resize(rowIndex + 1);
+
+        prepCosts[rowIndex].m_ticks += ticks;
+        ++prepCosts[rowIndex].m_shapeCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AddVertsForRenderShape(VertexList_PCU& verts, sRenderShape const& shape)
+{
+    Vec2 const  center = shape.m_position;
+    float const radius = shape.m_radius;
+
+    switch (shape.m_shape)
+    {
+    case eRenderShape::DISC:
+        AddVertsForDisc2D(verts, center, radius, shape.m_color);
+        break;
+
+    case eRenderShape::RING:
+        AddVertsForDisc2D(verts, center, radius, shape.m_thickness, shape.m_color);
+        break;
+
+    case eRenderShape::BOX:
+        AddVertsForAABB2D(verts, AABB2(center - Vec2(radius, radius), center + Vec2(radius, radius)), shape.m_color);
+        break;
+
+    case eRenderShape::TRIANGLE:
+        AddVertsForTriangle2D(verts,
+                              Vec2(center.x, center.y + radius),
+                              Vec2(center.x - radius, center.y - radius),
+                              Vec2(center.x + radius, center.y - radius),
+                              shape.m_color);
+        break;
+
+    case eRenderShape::POLYGON:
+    {
+        // Step each corner from the last by one rotation instead of two polar conversions per side
+        float sinPerSide;
+        float cosPerSide;
+        FastMath::SinCosDegrees(360.f / static_cast<float>(shape.m_sideCount), sinPerSide, cosPerSide);
+
+        Vec2 const firstCorner = FastMath::MakeFromPolarDegrees(shape.m_angleOffsetDegrees, radius);
+        Vec2       corner0     = firstCorner;
+
+        for (int i = 0; i < shape.m_sideCount; ++i)
+        {
+            // Close on the exact first corner so rounding drift cannot open a seam
+            Vec2 const corner1 = (i + 1 == shape.m_sideCount) ? firstCorner : FastMath::RotateByCosSin(corner0, cosPerSide, sinPerSide);
+
+            AddVertsForTriangle2D(verts, center, center + corner0, center + corner1, shape.m_color);
+            corner0 = corner1;
+        }
+        break;
+    }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+RenderPipeline::RenderPipeline(sRenderPipelineConfig const& config)
+    : m_config(config)
+{
+    if (m_config.m_isThreaded)
+    {
+        m_prepThread = std::thread(&RenderPipeline::RunPrepThread, this);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+RenderPipeline::~RenderPipeline()
+{
+    if (m_prepThread.joinable())
+    {
+        m_isRunning.store(false, std::memory_order_release);
+        m_publishCount.fetch_add(1, std::memory_order_release);
+        m_publishCount.notify_one();
+        m_prepThread.join();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderPipeline::MarkSimulationBegin()
+{
+    m_simulationBeginCount.fetch_add(1, std::memory_order_relaxed);
+    m_isSimulating.store(true, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderPipeline::MarkSimulationEnd()
+{
+    m_isSimulating.store(false, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+sRenderSnapshot& RenderPipeline::GetSnapshotToFill()
+{
+    sRenderSnapshot& snapshot = m_snapshots.GetWriteSlot();
+    snapshot.m_visibleWindowRects.clear();
+    snapshot.m_windowGeometry.clear();
+    snapshot.m_shapes.clear();
+    return snapshot;
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderPipeline::PublishSnapshot()
+{
+    sRenderSnapshot& snapshot = m_snapshots.GetWriteSlot();
+    snapshot.m_frameIndex     = ++m_publishedFrameIndex;
+    snapshot.m_publishSeconds = GetNowSeconds();
+
+    m_snapshots.Publish();
+
+    if (!m_config.m_isThreaded)
+    {
+        PrepareNewestSnapshot();
+        return;
+    }
+
+    m_publishCount.fetch_add(1, std::memory_order_release);
+    m_publishCount.notify_one();
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderPipeline::Submit()
+{
+    // Bound the pipeline depth: never let the screen trail the simulation by more than the budget
+    uint64_t builtFrameIndex = m_builtFrameIndex.load(std::memory_order_acquire);
+
+    while (builtFrameIndex + m_config.m_maxFramesInFlight < m_publishedFrameIndex)
+    {
+        m_builtFrameIndex.wait(builtFrameIndex, std::memory_order_acquire);
+        builtFrameIndex = m_builtFrameIndex.load(std::memory_order_acquire);
+    }
+
+    m_batches.AcquireNewest();
+    m_submittedPrepCosts.clear();
+
+    sRenderBatch const& batch = m_batches.GetReadSlot();
+    if (batch.m_frameIndex == 0) return;
+
+    // A batch is redrawn while prep has nothing newer; its shapes were only prepared once
+    if (batch.m_frameIndex != m_submittedFrameIndex)
+    {
+        m_submittedPrepCosts  = batch.m_prepCosts;
+        m_submittedFrameIndex = batch.m_frameIndex;
+    }
+
+    m_renderedEntityCount = batch.m_renderedEntityCount;
+    m_culledEntityCount   = batch.m_culledEntityCount;
+    m_vertexCount         = batch.m_verts.size();
+    m_latencyFrames       = m_publishedFrameIndex - batch.m_frameIndex;
+    m_latencyMilliseconds = (GetNowSeconds() - batch.m_publishSeconds) * 1000.0;
+
+    if (m_config.m_isHeadless || batch.m_verts.empty()) return;
+
+    g_renderer->SetModelConstants();
+    g_renderer->SetBlendMode(eBlendMode::OPAQUE);
+    g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+    g_renderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
+    g_renderer->SetDepthMode(eDepthMode::DISABLED);
+    g_renderer->BindTexture(nullptr);
+    g_renderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
+    g_renderer->DrawVertexArray(batch.m_verts);
+}
+
+//----------------------------------------------------------------------------------------------------
+float RenderPipeline::GetOverlappedPrepFraction() const
+{
+    uint64_t const builtBatchCount = m_builtBatchCount.load(std::memory_order_relaxed);
+    if (builtBatchCount == 0) return 0.f;
+
+    return static_cast<float>(m_overlappedBatchCount.load(std::memory_order_relaxed)) / static_cast<float>(builtBatchCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderPipeline::RunPrepThread()
+{
+    uint64_t seenPublishCount = 0;
+
+    while (true)
+    {
+        m_publishCount.wait(seenPublishCount, std::memory_order_acquire);
+        seenPublishCount = m_publishCount.load(std::memory_order_acquire);
+
+        if (!m_isRunning.load(std::memory_order_acquire)) return;
+
+        PrepareNewestSnapshot();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderPipeline::PrepareNewestSnapshot()
+{
+    if (!m_snapshots.AcquireNewest()) return;
+
+    uint64_t const simulationBeginCount = m_simulationBeginCount.load(std::memory_order_relaxed);
+    bool           isOverlapped         = m_isSimulating.load(std::memory_order_relaxed);
+    double const   startSeconds         = GetNowSeconds();
+
+    sRenderSnapshot const& snapshot = m_snapshots.GetReadSlot();
+    sRenderBatch&          batch    = m_batches.GetWriteSlot();
+    BuildBatch(snapshot, batch);
+
+    m_prepMicroseconds.store((GetNowSeconds() - startSeconds) * 1000000.0, std::memory_order_relaxed);
+
+    isOverlapped = isOverlapped
+                   || m_isSimulating.load(std::memory_order_relaxed)
+                   || m_simulationBeginCount.load(std::memory_order_relaxed) != simulationBeginCount;
+
+    m_builtBatchCount.fetch_add(1, std::memory_order_relaxed);
+    if (isOverlapped)
+    {
+        m_overlappedBatchCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    m_batches.Publish();
+    m_builtFrameIndex.store(snapshot.m_frameIndex, std::memory_order_release);
+    m_builtFrameIndex.notify_one();
+}
+
+//----------------------------------------------------------------------------------------------------
+// BuildBatch - Culls against the visible child windows; only their pixels ever reach the screen. Shapes
+// with a cost row are timed, culled or not, so the entity cost table sees what each type costs here.
+//----------------------------------------------------------------------------------------------------
+void RenderPipeline::BuildBatch(sRenderSnapshot const& snapshot, sRenderBatch& outBatch)
+{
+    outBatch.m_frameIndex          = snapshot.m_frameIndex;
+    outBatch.m_publishSeconds      = snapshot.m_publishSeconds;
+    outBatch.m_renderedEntityCount = 0;
+    outBatch.m_culledEntityCount   = 0;
+    outBatch.m_verts.clear();
+    outBatch.m_prepCosts.clear();
+    outBatch.m_windowGeometry = snapshot.m_windowGeometry;
+
+    m_cullIndex.Reset(snapshot.m_screenBounds);
+    for (AABB2 const& windowRect : snapshot.m_visibleWindowRects)
+    {
+        m_cullIndex.AddRect(windowRect);
+    }
+
+    for (sRenderShape const& shape : snapshot.m_shapes)
+    {
+        uint64_t const startTicks = shape.m_costRowIndex >= 0 ? __rdtsc() : 0;
+        Vec2 const     cullExtent = Vec2(shape.m_cullRadius, shape.m_cullRadius);
+
+        if (m_cullIndex.OverlapsAny(AABB2(shape.m_position - cullExtent, shape.m_position + cullExtent)))
+        {
+            AddVertsForRenderShape(outBatch.m_verts, shape);
+            outBatch.m_renderedEntityCount += shape.m_isEntity ? 1 : 0;
+        }
+        else
+        {
+            outBatch.m_culledEntityCount += shape.m_isEntity ? 1 : 0;
+        }
+
+        if (shape.m_costRowIndex >= 0)
+        {
+            AddPrepCost(outBatch.m_prepCosts, shape.m_costRowIndex, __rdtsc() - startTicks);
+        }
+    }
+}
@@ -0,0 +1,121 @@
+//----------------------------------------------------------------------------------------------------
+// RenderPipeline.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "Game/Framework/RectSpatialIndex.hpp"
+#include "Game/Framework/RenderSnapshot.hpp"
+#include "Game/Framework/TripleBuffer.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sRenderPipelineConfig
+{
+    bool     m_isThreaded        = true;      // false builds each batch inline on the main thread
+    bool     m_isHeadless        = false;     // Null renderer: batches are built and timed but never drawn
+    uint64_t m_maxFramesInFlight = 1;         // Frames render prep may trail the simulation by
+};
+
+//----------------------------------------------------------------------------------------------------
+// One render-prep result: the world geometry of one sRenderSnapshot, ready for a single draw call
+//----------------------------------------------------------------------------------------------------
+struct sRenderBatch
+{
+    uint64_t                     m_frameIndex          = 0;
+    double                       m_publishSeconds      = 0.0;     // When the source snapshot was published
+    VertexList_PCU               m_verts;
+    std::vector<sWindowGeometry> m_windowGeometry;                // The source snapshot's, committed with the draw
+    std::vector<sRenderPrepCost> m_prepCosts;                     // By sRenderShape::m_costRowIndex, culled shapes included
+    int                          m_renderedEntityCount = 0;
+    int                          m_culledEntityCount   = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// The vertices render prep builds for one shape; also used where a shape is drawn outside the pipeline
+//----------------------------------------------------------------------------------------------------
+void AddVertsForRenderShape(VertexList_PCU& verts, sRenderShape const& shape);
+
+//----------------------------------------------------------------------------------------------------
+// RenderPipeline
+// Overlaps simulation with render prep. At the end of each update the simulation fills the snapshot
+// from GetSnapshotToFill() and publishes it; the prep thread picks up the newest snapshot, culls it
+// against the visible child windows and builds one vertex batch, while the main thread has already
+// moved on to the next frame. Submit() on the main thread draws the newest finished batch.
+//
+// That batch may be a frame or more behind the simulation, so the child window rects travel with it:
+// the main thread commits and presents GetDrawnWindowGeometry(), never the windows' live rects, and
+// the world inside a window always lines up with where the window is. The same goes for the prep time
+// each shape cost: it is charged to its entity type once, when its batch is first submitted.
+//
+// Both hand-offs are TripleBuffers, so neither thread ever takes a lock. The only waits are the prep
+// thread parking while there is nothing to build, and Submit() holding the main thread when prep has
+// fallen more than m_maxFramesInFlight frames behind.
+//----------------------------------------------------------------------------------------------------
+class RenderPipeline
+{
+public:
+    explicit RenderPipeline(sRenderPipelineConfig const& config);
+    ~RenderPipeline();
+
+    RenderPipeline(RenderPipeline const&)            = delete;
+    RenderPipeline& operator=(RenderPipeline const&) = delete;
+
+    // Simulation (main thread)
+    void             MarkSimulationBegin();
+    void             MarkSimulationEnd();
+    sRenderSnapshot& GetSnapshotToFill();
+    void             PublishSnapshot();
+
+    // Render (main thread)
+    void                                Submit();
+    std::vector<sWindowGeometry> const& GetDrawnWindowGeometry() const { return m_batches.GetReadSlot().m_windowGeometry; }     // Of the last Submit()
+    std::vector<sRenderPrepCost> const& GetSubmittedPrepCosts() const { return m_submittedPrepCosts; }     // Empty unless the last Submit() drew a new batch
+
+    // Instrumentation, as of the last Submit()
+    int      GetRenderedEntityCount() const { return m_renderedEntityCount; }
+    int      GetCulledEntityCount() const { return m_culledEntityCount; }
+    size_t   GetVertexCount() const { return m_vertexCount; }
+    uint64_t GetLatencyFrames() const { return m_latencyFrames; }
+    double   GetLatencyMilliseconds() const { return m_latencyMilliseconds; }
+    double   GetPrepMilliseconds() const { return m_prepMicroseconds.load(std::memory_order_relaxed) / 1000.0; }
+    float    GetOverlappedPrepFraction() const;     // Share of batches built while the simulation was running
+    bool     IsHeadless() const { return m_config.m_isHeadless; }
+
+private:
+    void RunPrepThread();
+    void PrepareNewestSnapshot();
+    void BuildBatch(sRenderSnapshot const& snapshot, sRenderBatch& outBatch);
+
+    sRenderPipelineConfig m_config;
+
+    TripleBuffer<sRenderSnapshot> m_snapshots;     // Simulation -> render prep
+    TripleBuffer<sRenderBatch>    m_batches;       // Render prep -> Submit
+    RectSpatialIndex              m_cullIndex;     // Render prep only
+
+    uint64_t              m_publishedFrameIndex = 0;        // Main thread only
+    std::atomic<uint64_t> m_publishCount        = 0;        // Wakes the prep thread
+    std::atomic<uint64_t> m_builtFrameIndex     = 0;        // Newest frame render prep has finished
+    std::atomic<bool>     m_isRunning           = true;
+    std::thread           m_prepThread;
+
+    // Overlap proof: a batch overlapped if the simulation was running at any point while it was built
+    std::atomic<bool>     m_isSimulating         = false;
+    std::atomic<uint64_t> m_simulationBeginCount = 0;
+    std::atomic<uint64_t> m_builtBatchCount      = 0;
+    std::atomic<uint64_t> m_overlappedBatchCount = 0;
+    std::atomic<double>   m_prepMicroseconds     = 0.0;
+
+    int      m_renderedEntityCount = 0;
+    int      m_culledEntityCount   = 0;
+    size_t   m_vertexCount         = 0;
+    uint64_t m_latencyFrames       = 0;
+    double   m_latencyMilliseconds = 0.0;
+    uint64_t m_submittedFrameIndex = 0;
+
+    std::vector<sRenderPrepCost> m_submittedPrepCosts;     // Reused every frame by Submit
+};
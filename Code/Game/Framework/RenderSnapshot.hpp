@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------------------------------
+// RenderSnapshot.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Game/Subsystem/Window/WindowBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eRenderShape : uint8_t
+{
+    DISC,
+    RING,          // Disc outline, m_thickness wide
+    BOX,           // Axis-aligned square, m_radius half-extent
+    TRIANGLE,      // Apex up, base 2 * m_radius wide
+    POLYGON,       // Regular m_sideCount-gon, first vertex at m_angleOffsetDegrees
+};
+
+//----------------------------------------------------------------------------------------------------
+// Everything the render-prep thread needs to draw one world object; copied out of the simulation so
+// the thread never touches an Entity, the CoinField or the ProjectileSystem.
+//----------------------------------------------------------------------------------------------------
+struct sRenderShape
+{
+    Vec2         m_position;
+    float        m_radius             = 0.f;
+    float        m_cullRadius         = 0.f;     // Half-extent of everything drawn, tested against window rects
+    float        m_thickness          = 0.f;     // RING only
+    float        m_angleOffsetDegrees = 0.f;     // POLYGON only
+    Rgba8        m_color;
+    eRenderShape m_shape              = eRenderShape::DISC;
+    uint8_t      m_sideCount          = 0;       // POLYGON only
+    bool         m_isEntity           = false;   // Counted in the rendered / culled entity stats
+    int16_t      m_costRowIndex       = -1;      // EntityCostTracker row charged with this shape's prep time, -1 for none
+};
+
+//----------------------------------------------------------------------------------------------------
+// Render-prep time of the shapes charged to one EntityCostTracker row, in time-stamp counter ticks
+//----------------------------------------------------------------------------------------------------
+struct sRenderPrepCost
+{
+    uint64_t m_ticks      = 0;
+    int      m_shapeCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Immutable once published: one simulated frame's worth of world shapes plus the client rects of the
+// child windows that were visible, which is all render prep needs for culling. The geometry of every
+// child window rides along so the windows are committed with the batch drawn from this frame.
+//----------------------------------------------------------------------------------------------------
+struct sRenderSnapshot
+{
+    uint64_t                     m_frameIndex     = 0;
+    double                       m_publishSeconds = 0.0;
+    AABB2                        m_screenBounds;
+    std::vector<AABB2>           m_visibleWindowRects;
+    std::vector<sWindowGeometry> m_windowGeometry;     // Client rect of every active child window this frame
+    std::vector<sRenderShape>    m_shapes;             // Entities in list order, then coins, then projectiles
+};
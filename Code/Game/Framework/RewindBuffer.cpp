@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------------------------------
+// RewindBuffer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RewindBuffer.hpp"
+
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------
+RewindBuffer::RewindBuffer(sRewindBufferConfig const& config)
+    : m_config(config)
+{
+    size_t const slotCount = static_cast<size_t>(std::ceil(m_config.m_secondsToKeep / m_config.m_captureInterval));
+    m_slots.resize(slotCount > 0 ? slotCount : 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool RewindBuffer::AdvanceCaptureTimer(float const deltaSeconds)
+{
+    m_captureTimer += deltaSeconds;
+    if (m_captureTimer < m_config.m_captureInterval) return false;
+
+    // Never queue up several captures after a long frame; one per due interval is enough
+    m_captureTimer = std::fmod(m_captureTimer, m_config.m_captureInterval);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<uint8_t>& RewindBuffer::BeginCapture()
+{
+    m_newest = (m_count == 0) ? 0 : (m_newest + 1) % m_slots.size();
+
+    if (m_count < m_slots.size())
+    {
+        ++m_count;
+    }
+
+    return m_slots[m_newest];
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<uint8_t> const* RewindBuffer::PopNewest()
+{
+    if (m_count == 0) return nullptr;
+
+    std::vector<uint8_t> const* snapshot = &m_slots[m_newest];
+
+    --m_count;
+    m_newest       = (m_newest + m_slots.size() - 1) % m_slots.size();
+    m_captureTimer = 0.f;
+
+    return snapshot;
+}
+
+//----------------------------------------------------------------------------------------------------
+void RewindBuffer::Clear()
+{
+    m_newest       = 0;
+    m_count        = 0;
+    m_captureTimer = 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t RewindBuffer::GetStoredByteCount() const
+{
+    size_t byteCount = 0;
+    for (std::vector<uint8_t> const& slot : m_slots)
+    {
+        byteCount += slot.capacity();
+    }
+    return byteCount;
+}
@@ -0,0 +1,44 @@
+//----------------------------------------------------------------------------------------------------
+// RewindBuffer.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+struct sRewindBufferConfig
+{
+    float m_secondsToKeep   = 10.f;
+    float m_captureInterval = 1.f / 30.f;     // Game seconds between captures
+};
+
+//----------------------------------------------------------------------------------------------------
+// RewindBuffer
+// Fixed ring of snapshot slots covering the last m_secondsToKeep of game time. Slots are byte buffers
+// that keep their capacity, so once the ring has wrapped a capture only copies bytes. The oldest slot
+// is overwritten when the ring is full; PopNewest walks backwards for rewind.
+//----------------------------------------------------------------------------------------------------
+class RewindBuffer
+{
+public:
+    explicit RewindBuffer(sRewindBufferConfig const& config);
+
+    bool                        AdvanceCaptureTimer(float deltaSeconds);     // True when a capture is due
+    std::vector<uint8_t>&       BeginCapture();                              // Slot to overwrite; becomes the newest
+    std::vector<uint8_t> const* PopNewest();                                 // nullptr when empty
+    void                        Clear();
+
+    size_t GetSnapshotCount() const { return m_count; }
+    size_t GetCapacity() const { return m_slots.size(); }
+    size_t GetStoredByteCount() const;
+
+private:
+    sRewindBufferConfig               m_config;
+    std::vector<std::vector<uint8_t>> m_slots;
+    size_t                            m_newest       = 0;
+    size_t                            m_count        = 0;
+    float                             m_captureTimer = 0.f;
+};
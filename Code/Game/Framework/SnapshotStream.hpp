@@ -0,0 +1,173 @@
+//----------------------------------------------------------------------------------------------------
+// SnapshotStream.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// SnapshotWriter
+// Appends raw bytes to a caller-owned buffer. Values are copied bit for bit, so a
+// snapshot read back on the same build restores floats and RNG state exactly. The buffer keeps its
+// capacity between captures; after the first few captures no write allocates.
+//----------------------------------------------------------------------------------------------------
+class SnapshotWriter
+{
+public:
+    // The buffer is opened up to its full capacity and written through a cursor; the destructor trims
+    // it back to the bytes actually written
+    explicit SnapshotWriter(std::vector<uint8_t>& buffer)
+        : m_buffer(buffer)
+    {
+        m_buffer.resize(m_buffer.capacity());
+    }
+
+    ~SnapshotWriter()
+    {
+        m_buffer.resize(m_offset);
+    }
+
+    SnapshotWriter(SnapshotWriter const&)            = delete;
+    SnapshotWriter& operator=(SnapshotWriter const&) = delete;
+
+    template <typename T>
+    void Write(T const& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshot values are copied bit for bit");
+        WriteBytes(&value, sizeof(T));
+    }
+
+    template <typename T, typename Allocator>
+    void WriteVector(std::vector<T, Allocator> const& values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshot values are copied bit for bit");
+        Write(static_cast<uint32_t>(values.size()));
+        WriteBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    void WriteBytes(void const* data, size_t const byteCount)
+    {
+        if (byteCount == 0) return;
+
+        if (m_offset + byteCount > m_buffer.size())
+        {
+            size_t const grownSize = m_buffer.size() * 2;
+            m_buffer.resize(grownSize > m_offset + byteCount ? grownSize : m_offset + byteCount + 4096);
+        }
+
+        std::memcpy(m_buffer.data() + m_offset, data, byteCount);
+        m_offset += byteCount;
+    }
+
+    // A section is a uint32_t byte count followed by the bytes, so a reader can check that the whole
+    // section fits before anything reads from it. BeginSection returns where to patch the count.
+    size_t BeginSection()
+    {
+        size_t const lengthOffset = m_offset;
+        Write(static_cast<uint32_t>(0));
+        return lengthOffset;
+    }
+
+    void EndSection(size_t const lengthOffset)
+    {
+        uint32_t const length = static_cast<uint32_t>(m_offset - lengthOffset - sizeof(uint32_t));
+        std::memcpy(m_buffer.data() + lengthOffset, &length, sizeof(length));
+    }
+
+    size_t GetByteCount() const { return m_offset; }
+
+private:
+    std::vector<uint8_t>& m_buffer;
+    size_t                m_offset = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// SnapshotReader
+// Reads back what SnapshotWriter wrote, in the same order. Reading past the end zero-fills the output
+// and marks the reader invalid instead of asserting, so a truncated snapshot can be rejected. Callers
+// that must not change anything on a bad buffer walk its sections once first, then read for real.
+//----------------------------------------------------------------------------------------------------
+class SnapshotReader
+{
+public:
+    SnapshotReader(uint8_t const* data, size_t const byteCount)
+        : m_data(data),
+          m_byteCount(byteCount)
+    {
+    }
+
+    template <typename T>
+    void Read(T& outValue)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshot values are copied bit for bit");
+        ReadBytes(&outValue, sizeof(T));
+    }
+
+    template <typename T, typename Allocator>
+    void ReadVector(std::vector<T, Allocator>& outValues)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshot values are copied bit for bit");
+
+        uint32_t count = 0;
+        Read(count);
+
+        if (!m_isValid || static_cast<size_t>(count) * sizeof(T) > m_byteCount - m_offset)
+        {
+            m_isValid = false;
+            outValues.clear();
+            return;
+        }
+
+        outValues.resize(count);
+        ReadBytes(outValues.data(), static_cast<size_t>(count) * sizeof(T));
+    }
+
+    void ReadBytes(void* outData, size_t const byteCount)
+    {
+        if (byteCount == 0) return;
+
+        if (!m_isValid || byteCount > m_byteCount - m_offset)
+        {
+            m_isValid = false;
+            std::memset(outData, 0, byteCount);
+            return;
+        }
+
+        std::memcpy(outData, m_data + m_offset, byteCount);
+        m_offset += byteCount;
+    }
+
+    // Reader over the next section written by SnapshotWriter::BeginSection/EndSection; this reader
+    // steps past it. A section that does not fit leaves both readers invalid.
+    SnapshotReader ReadSection()
+    {
+        uint32_t length = 0;
+        Read(length);
+
+        if (!m_isValid || length > m_byteCount - m_offset)
+        {
+            m_isValid = false;
+
+            SnapshotReader invalidSection(nullptr, 0);
+            invalidSection.m_isValid = false;
+            return invalidSection;
+        }
+
+        SnapshotReader section(m_data + m_offset, length);
+        m_offset += length;
+        return section;
+    }
+
+    bool IsValid() const { return m_isValid; }
+    bool IsAtEnd() const { return m_offset == m_byteCount; }
+
+private:
+    uint8_t const* m_data      = nullptr;
+    size_t         m_byteCount = 0;
+    size_t         m_offset    = 0;
+    bool           m_isValid   = true;
+};
@@ -0,0 +1,50 @@
+//----------------------------------------------------------------------------------------------------
+// TripleBuffer.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// TripleBuffer
+// Lock-free hand-off of whole values from exactly one producer thread to exactly one consumer thread.
+// The producer always owns a slot to write and the consumer always owns the newest slot it acquired;
+// the third slot sits in between and is swapped with a single atomic exchange on each side. Neither
+// side ever waits: a published value that is never acquired is simply replaced by the next one.
+// Slots are reused, so values that hold containers keep their capacity from frame to frame.
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+class TripleBuffer
+{
+public:
+    // Producer side
+    T&   GetWriteSlot() { return m_slots[m_writeIndex]; }
+    void Publish()
+    {
+        uint8_t const previous = m_sharedIndex.exchange(static_cast<uint8_t>(m_writeIndex | FRESH_BIT), std::memory_order_acq_rel);
+        m_writeIndex           = previous & INDEX_MASK;
+    }
+
+    // Consumer side; returns false (keeping the current read slot) when nothing new was published
+    bool AcquireNewest()
+    {
+        if ((m_sharedIndex.load(std::memory_order_relaxed) & FRESH_BIT) == 0) return false;
+
+        uint8_t const previous = m_sharedIndex.exchange(m_readIndex, std::memory_order_acq_rel);
+        m_readIndex            = previous & INDEX_MASK;
+        return true;
+    }
+
+    T const& GetReadSlot() const { return m_slots[m_readIndex]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH_BIT  = 0x4;     // Set by Publish, cleared by AcquireNewest
+
+    T                    m_slots[3];
+    uint8_t              m_writeIndex  = 0;     // Producer only
+    std::atomic<uint8_t> m_sharedIndex = 1;
+    uint8_t              m_readIndex   = 2;     // Consumer only
+};
@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------------------------------
+// AIScheduler.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Game/Framework/RectSpatialIndex.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Think intervals, in frames, are powers of two so every bucket lands on the same frames each cycle
+enum class eAILod : uint8_t
+{
+    FULL,          // Near the player: thinks every frame, never deferred
+    HALF,          // Visible, mid range: every 2nd frame
+    QUARTER,       // Visible, far: every 4th frame
+    HIDDEN,        // Outside every visible child window: every 8th frame
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAISchedulerConfig
+{
+    bool  m_isEnabled          = true;      // false thinks every entity every frame (A/B comparison)
+    float m_fullRateRadius     = 350.f;     // Screen pixels from the player
+    float m_halfRateRadius     = 800.f;
+    float m_budgetMilliseconds = 2.f;       // Thinks past this are deferred, except FULL
+};
+
+//----------------------------------------------------------------------------------------------------
+// Per-entity bookkeeping, owned by the entity so the scheduler needs no lookup
+//----------------------------------------------------------------------------------------------------
+struct sAIScheduleState
+{
+    Vec2   m_extrapolationVelocity;     // Displacement per second of the last think
+    Vec2   m_extrapolatedOffset;        // Dead-reckoned since the last think; undone before the next
+    float  m_secondsSinceThink = 0.f;
+    eAILod m_lod               = eAILod::FULL;
+    bool   m_isOverdue         = false;     // Deferred by the budget; thinks next frame regardless of bucket or budget
+};
+
+//----------------------------------------------------------------------------------------------------
+// AIScheduler
+// Decides, per entity and frame, whether its AI runs (a "think") or its position is extrapolated from
+// the velocity of the last think. The think interval comes from the entity's LOD, picked at each think
+// from its distance to the player and whether it overlaps a visible child window. Entities are spread
+// over the frames of an interval by bucketKey, so the cost stays flat instead of spiking every 8th frame.
+//
+// A think first undoes the extrapolated offset, then runs the AI once with all the seconds since the
+// previous think; timers, phases and orbit angles therefore advance exactly as at full rate, and
+// anything else that moved the entity in between (knockback, separation) is kept.
+//----------------------------------------------------------------------------------------------------
+class AIScheduler
+{
+public:
+    explicit AIScheduler(sAISchedulerConfig const& config);
+
+    void BeginFrame(Vec2 const& playerPosition, AABB2 const& screenBounds, std::vector<AABB2> const& visibleWindowRects);
+
+    // True: run the AI now with outThinkSeconds, then call EndThink(). False: ioPosition was extrapolated.
+    bool BeginUpdate(sAIScheduleState& state, Vec2& ioPosition, float visibilityRadius, uint32_t bucketKey, float deltaSeconds, float& outThinkSeconds);
+    void EndThink(sAIScheduleState& state, Vec2 const& positionBefore, Vec2 const& positionAfter, float thinkSeconds);
+
+    void SetEnabled(bool isEnabled) { m_config.m_isEnabled = isEnabled; }
+    bool IsEnabled() const { return m_config.m_isEnabled; }
+
+    // Instrumentation, for the frame in progress or the last one
+    int    GetThinkCount() const { return m_thinkCount; }
+    int    GetExtrapolatedCount() const { return m_extrapolatedCount; }
+    int    GetDeferredCount() const { return m_deferredCount; }
+    int    GetLodCount(eAILod lod) const { return m_lodCounts[static_cast<int>(lod)]; }
+    double GetThinkMilliseconds() const { return m_thinkMilliseconds; }
+    float  GetBudgetMilliseconds() const { return m_config.m_budgetMilliseconds; }
+
+private:
+    eAILod PickLod(Vec2 const& position, float visibilityRadius) const;
+
+    static constexpr int THINK_TIMING_STRIDE = 16;
+
+    sAISchedulerConfig m_config;
+    RectSpatialIndex   m_visibleIndex;
+    Vec2               m_playerPosition;
+    uint32_t           m_frameIndex        = 0;
+    double             m_thinkStartSeconds = 0.0;
+    bool               m_isTimingThink     = false;
+
+    int    m_thinkCount        = 0;
+    int    m_extrapolatedCount = 0;
+    int    m_deferredCount     = 0;
+    int    m_lodCounts[static_cast<int>(eAILod::COUNT)] = {};
+    double m_thinkMilliseconds = 0.0;     // Sampled estimate over this frame's thinks, checked against the budget
+};
@@ -18,12 +18,16 @@ public:
     explicit Circle(EntityID entityID, Vec2 const& position, float orientationDegrees, Rgba8 const& color, bool isVisible, bool hasChildWindow);
     ~Circle() override;
     void Update(float deltaSeconds) override;
-    void Render() const override;
+    bool GetRenderShape(sRenderShape& outShape) const override;
     void BounceOfWindow();
     void UpdateFromInput(float deltaSeconds) override;
     void ShrinkWindow();
+    void WriteSnapshot(SnapshotWriter& writer) const override;
+    void ReadSnapshot(SnapshotReader& reader) override;
 
 private:
+    void UpdateAI(float deltaSeconds) override;
+
     std::shared_ptr<ButtonWidget> m_healthWidget;
 
     // Orbit-specific state
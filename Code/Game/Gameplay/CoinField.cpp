@@ -0,0 +1,300 @@
+//----------------------------------------------------------------------------------------------------
+// CoinField.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/CoinField.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/RenderSnapshot.hpp"
+#include "Game/Framework/SnapshotStream.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/Rgba8.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <emmintrin.h>
+
+//----------------------------------------------------------------------------------------------------
+CoinField::CoinField(sCoinFieldConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void CoinField::SpawnStack(Vec2 const& position, int const value)
+{
+    if (value <= 0) return;
+
+    m_positionX.push_back(position.x);
+    m_positionY.push_back(position.y);
+    m_velocityX.push_back(0.f);
+    m_velocityY.push_back(0.f);
+    m_radius.push_back(GetStackRadius(value));
+    m_value.push_back(value);
+}
+
+//----------------------------------------------------------------------------------------------------
+void CoinField::Clear()
+{
+    m_positionX.clear();
+    m_positionY.clear();
+    m_velocityX.clear();
+    m_velocityY.clear();
+    m_radius.clear();
+    m_value.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void CoinField::WriteSnapshot(SnapshotWriter& writer) const
+{
+    writer.WriteVector(m_positionX);
+    writer.WriteVector(m_positionY);
+    writer.WriteVector(m_velocityX);
+    writer.WriteVector(m_velocityY);
+    writer.WriteVector(m_radius);
+    writer.WriteVector(m_value);
+}
+
+//----------------------------------------------------------------------------------------------------
+void CoinField::ReadSnapshot(SnapshotReader& reader)
+{
+    reader.ReadVector(m_positionX);
+    reader.ReadVector(m_positionY);
+    reader.ReadVector(m_velocityX);
+    reader.ReadVector(m_velocityY);
+    reader.ReadVector(m_radius);
+    reader.ReadVector(m_value);
+}
+
+//----------------------------------------------------------------------------------------------------
+int CoinField::Update(float const deltaSeconds, Vec2 const& playerPosition, float const playerRadius)
+{
+    if (m_value.empty()) return 0;
+
+    IntegrateMagnet(deltaSeconds, playerPosition.x, playerPosition.y);
+    MergeNearbyStacks();
+    return CollectTouching(playerPosition.x, playerPosition.y, playerRadius);
+}
+
+//----------------------------------------------------------------------------------------------------
+void CoinField::AppendRenderShapes(std::vector<sRenderShape>& outShapes) const
+{
+    for (size_t i = 0; i < m_value.size(); ++i)
+    {
+        sRenderShape& shape = outShapes.emplace_back();
+        shape.m_position    = Vec2(m_positionX[i], m_positionY[i]);
+        shape.m_radius      = m_radius[i];
+        shape.m_cullRadius  = m_radius[i];
+        shape.m_color       = Rgba8::YELLOW;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int CoinField::GetTotalValue() const
+{
+    int totalValue = 0;
+    for (int const value : m_value)
+    {
+        totalValue += value;
+    }
+    return totalValue;
+}
+
+//----------------------------------------------------------------------------------------------------
+// IntegrateMagnet - Four stacks per iteration with SSE2; stacks inside the magnet radius accelerate
+// toward the player, the rest slow down under drag. Both paths are computed and blended by mask.
+//----------------------------------------------------------------------------------------------------
+void CoinField::IntegrateMagnet(float const deltaSeconds, float const playerX, float const playerY)
+{
+    size_t const count = m_value.size();
+
+    float const magnetRadiusSq = m_config.m_magnetRadius * m_config.m_magnetRadius;
+    float const pull           = m_config.m_magnetAcceleration * deltaSeconds;
+    float const dragScale      = (std::max)(0.f, 1.f - m_config.m_drag * deltaSeconds);
+    float const maxSpeedSq     = m_config.m_maxSpeed * m_config.m_maxSpeed;
+
+    __m128 const vPlayerX    = _mm_set1_ps(playerX);
+    __m128 const vPlayerY    = _mm_set1_ps(playerY);
+    __m128 const vMagnetSq   = _mm_set1_ps(magnetRadiusSq);
+    __m128 const vPull       = _mm_set1_ps(pull);
+    __m128 const vDragScale  = _mm_set1_ps(dragScale);
+    __m128 const vMaxSpeed   = _mm_set1_ps(m_config.m_maxSpeed);
+    __m128 const vMaxSpeedSq = _mm_set1_ps(maxSpeedSq);
+    __m128 const vDelta      = _mm_set1_ps(deltaSeconds);
+    __m128 const vEpsilon    = _mm_set1_ps(1e-6f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 positionX = _mm_loadu_ps(&m_positionX[i]);
+        __m128 positionY = _mm_loadu_ps(&m_positionY[i]);
+        __m128 velocityX = _mm_loadu_ps(&m_velocityX[i]);
+        __m128 velocityY = _mm_loadu_ps(&m_velocityY[i]);
+
+        __m128 const toPlayerX  = _mm_sub_ps(vPlayerX, positionX);
+        __m128 const toPlayerY  = _mm_sub_ps(vPlayerY, positionY);
+        __m128 const distanceSq = _mm_add_ps(_mm_mul_ps(toPlayerX, toPlayerX), _mm_mul_ps(toPlayerY, toPlayerY));
+        __m128 const inMagnet   = _mm_cmplt_ps(distanceSq, vMagnetSq);
+
+        __m128 const inverseDistance = _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(_mm_max_ps(distanceSq, vEpsilon)));
+        __m128 const pulledX         = _mm_add_ps(velocityX, _mm_mul_ps(_mm_mul_ps(toPlayerX, inverseDistance), vPull));
+        __m128 const pulledY         = _mm_add_ps(velocityY, _mm_mul_ps(_mm_mul_ps(toPlayerY, inverseDistance), vPull));
+        __m128 const draggedX        = _mm_mul_ps(velocityX, vDragScale);
+        __m128 const draggedY        = _mm_mul_ps(velocityY, vDragScale);
+
+        velocityX = _mm_or_ps(_mm_and_ps(inMagnet, pulledX), _mm_andnot_ps(inMagnet, draggedX));
+        velocityY = _mm_or_ps(_mm_and_ps(inMagnet, pulledY), _mm_andnot_ps(inMagnet, draggedY));
+
+        // Clamp speed: scale = min(1, maxSpeed / speed)
+        __m128 const speedSq = _mm_add_ps(_mm_mul_ps(velocityX, velocityX), _mm_mul_ps(velocityY, velocityY));
+        __m128 const tooFast = _mm_cmpgt_ps(speedSq, vMaxSpeedSq);
+        __m128 const scale   = _mm_div_ps(vMaxSpeed, _mm_sqrt_ps(_mm_max_ps(speedSq, vEpsilon)));
+        __m128 const clamp   = _mm_or_ps(_mm_and_ps(tooFast, scale), _mm_andnot_ps(tooFast, _mm_set1_ps(1.f)));
+        velocityX            = _mm_mul_ps(velocityX, clamp);
+        velocityY            = _mm_mul_ps(velocityY, clamp);
+
+        positionX = _mm_add_ps(positionX, _mm_mul_ps(velocityX, vDelta));
+        positionY = _mm_add_ps(positionY, _mm_mul_ps(velocityY, vDelta));
+
+        _mm_storeu_ps(&m_positionX[i], positionX);
+        _mm_storeu_ps(&m_positionY[i], positionY);
+        _mm_storeu_ps(&m_velocityX[i], velocityX);
+        _mm_storeu_ps(&m_velocityY[i], velocityY);
+    }
+
+    for (; i < count; ++i)
+    {
+        float const toPlayerX  = playerX - m_positionX[i];
+        float const toPlayerY  = playerY - m_positionY[i];
+        float const distanceSq = toPlayerX * toPlayerX + toPlayerY * toPlayerY;
+
+        if (distanceSq < magnetRadiusSq)
+        {
+            float const inverseDistance = 1.f / sqrtf((std::max)(distanceSq, 1e-6f));
+            m_velocityX[i] += toPlayerX * inverseDistance * pull;
+            m_velocityY[i] += toPlayerY * inverseDistance * pull;
+        }
+        else
+        {
+            m_velocityX[i] *= dragScale;
+            m_velocityY[i] *= dragScale;
+        }
+
+        float const speedSq = m_velocityX[i] * m_velocityX[i] + m_velocityY[i] * m_velocityY[i];
+        if (speedSq > maxSpeedSq)
+        {
+            float const scale = m_config.m_maxSpeed / sqrtf(speedSq);
+            m_velocityX[i] *= scale;
+            m_velocityY[i] *= scale;
+        }
+
+        m_positionX[i] += m_velocityX[i] * deltaSeconds;
+        m_positionY[i] += m_velocityY[i] * deltaSeconds;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// MergeNearbyStacks - Hashes stacks into merge-radius cells; a stack within the merge radius of the
+// first stack in its cell is folded into it. Neighbouring cells are left alone, so two stacks on
+// either side of a cell edge merge a frame later once the magnet or the next drop moves them.
+//----------------------------------------------------------------------------------------------------
+void CoinField::MergeNearbyStacks()
+{
+    float const cellSize      = m_config.m_mergeRadius;
+    float const mergeRadiusSq = m_config.m_mergeRadius * m_config.m_mergeRadius;
+
+    m_mergeCells.clear();
+
+    for (size_t i = 0; i < m_value.size();)
+    {
+        int64_t const cellX = static_cast<int64_t>(floorf(m_positionX[i] / cellSize));
+        int64_t const cellY = static_cast<int64_t>(floorf(m_positionY[i] / cellSize));
+        int64_t const key   = (cellX << 32) ^ (cellY & 0xffffffff);
+
+        auto const [cellIt, isNewCell] = m_mergeCells.try_emplace(key, static_cast<uint32_t>(i));
+        if (isNewCell)
+        {
+            ++i;
+            continue;
+        }
+
+        size_t const target = cellIt->second;
+        float const  dx     = m_positionX[i] - m_positionX[target];
+        float const  dy     = m_positionY[i] - m_positionY[target];
+
+        if (dx * dx + dy * dy > mergeRadiusSq)
+        {
+            ++i;
+            continue;
+        }
+
+        // Value-weighted position and momentum so a merge never teleports the stack
+        float const totalValue = static_cast<float>(m_value[target] + m_value[i]);
+        float const weight     = static_cast<float>(m_value[i]) / totalValue;
+
+        m_positionX[target] += dx * weight;
+        m_positionY[target] += dy * weight;
+        m_velocityX[target] += (m_velocityX[i] - m_velocityX[target]) * weight;
+        m_velocityY[target] += (m_velocityY[i] - m_velocityY[target]) * weight;
+        m_value[target] += m_value[i];
+        m_radius[target] = GetStackRadius(m_value[target]);
+
+        // Swap-remove pulls the last stack into slot i, which is examined next without advancing;
+        // the target always has a lower index, so it is never the one moved
+        RemoveStack(i);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int CoinField::CollectTouching(float const playerX, float const playerY, float const playerRadius)
+{
+    int collectedValue = 0;
+
+    for (size_t i = 0; i < m_value.size();)
+    {
+        float const dx          = m_positionX[i] - playerX;
+        float const dy          = m_positionY[i] - playerY;
+        float const touchRadius = playerRadius + m_radius[i];
+
+        if (dx * dx + dy * dy < touchRadius * touchRadius)
+        {
+            collectedValue += m_value[i];
+            RemoveStack(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    return collectedValue;
+}
+
+//----------------------------------------------------------------------------------------------------
+void CoinField::RemoveStack(size_t const index)
+{
+    size_t const last = m_value.size() - 1;
+
+    m_positionX[index] = m_positionX[last];
+    m_positionY[index] = m_positionY[last];
+    m_velocityX[index] = m_velocityX[last];
+    m_velocityY[index] = m_velocityY[last];
+    m_radius[index]    = m_radius[last];
+    m_value[index]     = m_value[last];
+
+    m_positionX.pop_back();
+    m_positionY.pop_back();
+    m_velocityX.pop_back();
+    m_velocityY.pop_back();
+    m_radius.pop_back();
+    m_value.pop_back();
+}
+
+//----------------------------------------------------------------------------------------------------
+float CoinField::GetStackRadius(int const value) const
+{
+    // Area grows with value, capped so huge stacks stay readable
+    return (std::min)(m_config.m_baseRadius * sqrtf(static_cast<float>(value)) + 2.f, m_config.m_maxRadius);
+}
@@ -0,0 +1,75 @@
+//----------------------------------------------------------------------------------------------------
+// CoinField.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/MemoryTracker.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/Vec2.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class SnapshotReader;
+class SnapshotWriter;
+struct sRenderShape;
+
+//----------------------------------------------------------------------------------------------------
+struct sCoinFieldConfig
+{
+    float m_mergeRadius        = 24.f;     // Stacks closer than this collapse into one
+    float m_magnetRadius       = 180.f;    // Stacks inside this radius around the player are pulled in
+    float m_magnetAcceleration = 1600.f;
+    float m_maxSpeed           = 700.f;
+    float m_drag               = 4.f;      // Per-second velocity decay outside the magnet
+    float m_baseRadius         = 4.f;
+    float m_maxRadius          = 16.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+// CoinField
+// All dropped coins, stored as structure-of-arrays value stacks instead of one Entity per coin.
+// Coins never collide with anything but the player, so pickup is a single pass against one disc.
+//----------------------------------------------------------------------------------------------------
+class CoinField
+{
+public:
+    GAME_MEMORY_TAG(eMemoryTag::COIN)
+
+    explicit CoinField(sCoinFieldConfig const& config);
+
+    void SpawnStack(Vec2 const& position, int value);
+    void Clear();
+    void WriteSnapshot(SnapshotWriter& writer) const;
+    void ReadSnapshot(SnapshotReader& reader);
+
+    // Integrates, merges and collects; returns the coin value picked up by the player this frame
+    int  Update(float deltaSeconds, Vec2 const& playerPosition, float playerRadius);
+    void AppendRenderShapes(std::vector<sRenderShape>& outShapes) const;     // One disc per stack, culled by render prep
+
+    int GetStackCount() const { return static_cast<int>(m_value.size()); }
+    int GetTotalValue() const;
+
+private:
+    void IntegrateMagnet(float deltaSeconds, float playerX, float playerY);
+    void MergeNearbyStacks();
+    int  CollectTouching(float playerX, float playerY, float playerRadius);
+    void RemoveStack(size_t index);
+    float GetStackRadius(int value) const;
+
+    sCoinFieldConfig m_config;
+
+    // One entry per stack, same index across every array
+    TrackedVector<float, eMemoryTag::COIN> m_positionX;
+    TrackedVector<float, eMemoryTag::COIN> m_positionY;
+    TrackedVector<float, eMemoryTag::COIN> m_velocityX;
+    TrackedVector<float, eMemoryTag::COIN> m_velocityY;
+    TrackedVector<float, eMemoryTag::COIN> m_radius;
+    TrackedVector<int, eMemoryTag::COIN>   m_value;
+
+    std::unordered_map<int64_t, uint32_t> m_mergeCells;     // Cell -> first stack seen there; reused every frame
+};
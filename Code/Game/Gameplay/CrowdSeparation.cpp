@@ -0,0 +1,153 @@
+//----------------------------------------------------------------------------------------------------
+// CrowdSeparation.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/CrowdSeparation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <emmintrin.h>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr float FAR_AWAY = 1.0e9f;     // Position of the padding discs in the gather arrays
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+CrowdSeparation::CrowdSeparation(sCrowdSeparationConfig const& config)
+    : m_config(config),
+      m_index(config.m_cellSize)
+{
+    size_t const paddedCount = static_cast<size_t>((m_config.m_maxNeighbors + 3) & ~3);
+
+    m_neighbors.resize(static_cast<size_t>(m_config.m_maxNeighbors));
+    m_gatherX.resize(paddedCount);
+    m_gatherY.resize(paddedCount);
+    m_gatherRadius.resize(paddedCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+void CrowdSeparation::Clear()
+{
+    m_positionX.clear();
+    m_positionY.clear();
+    m_radius.clear();
+    m_maxRadius = 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+int CrowdSeparation::AddAgent(Vec2 const& position, float const radius)
+{
+    m_positionX.push_back(position.x);
+    m_positionY.push_back(position.y);
+    m_radius.push_back(radius);
+    m_maxRadius = (std::max)(m_maxRadius, radius);
+
+    return static_cast<int>(m_positionX.size()) - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void CrowdSeparation::Solve(AABB2 const& bounds, float const deltaSeconds)
+{
+    double const startSeconds = GetNowSeconds();
+    int const    agentCount   = GetAgentCount();
+
+    m_displacementX.assign(static_cast<size_t>(agentCount), 0.f);
+    m_displacementY.assign(static_cast<size_t>(agentCount), 0.f);
+    m_neighborCount    = 0;
+    m_cappedAgentCount = 0;
+
+    if (agentCount > 1 && deltaSeconds > 0.f)
+    {
+        m_index.Build(bounds, m_positionX.data(), m_positionY.data(), agentCount);
+
+        // Each side of a pair takes half of the overlap
+        float const blend = 0.5f * (std::min)(1.f, m_config.m_resolveRate * deltaSeconds);
+
+        for (int i = 0; i < agentCount; ++i)
+        {
+            SolveAgent(i, blend);
+        }
+    }
+
+    m_solveMilliseconds = (GetNowSeconds() - startSeconds) * 1000.0;
+}
+
+//----------------------------------------------------------------------------------------------------
+// SolveAgent - Gather, then reduce four neighbours per iteration: overlapping discs push by
+// (reach - distance) along the separating direction, the rest are masked out.
+//----------------------------------------------------------------------------------------------------
+void CrowdSeparation::SolveAgent(int const agentIndex, float const blend)
+{
+    float const x      = m_positionX[agentIndex];
+    float const y      = m_positionY[agentIndex];
+    float const radius = m_radius[agentIndex];
+
+    int const neighborCount = m_index.QueryRadius(x, y, radius + m_maxRadius + m_config.m_padding, agentIndex, m_config.m_maxNeighbors, m_neighbors.data());
+    if (neighborCount == 0) return;
+
+    m_neighborCount += neighborCount;
+    m_cappedAgentCount += (neighborCount == m_config.m_maxNeighbors) ? 1 : 0;
+
+    int const paddedCount = (neighborCount + 3) & ~3;
+
+    for (int k = 0; k < paddedCount; ++k)
+    {
+        if (k >= neighborCount)
+        {
+            m_gatherX[k]      = FAR_AWAY;
+            m_gatherY[k]      = FAR_AWAY;
+            m_gatherRadius[k] = 0.f;
+            continue;
+        }
+
+        int const neighbor = m_neighbors[k];
+        m_gatherX[k]       = m_positionX[neighbor];
+        m_gatherY[k]       = m_positionY[neighbor];
+        m_gatherRadius[k]  = m_radius[neighbor];
+
+        // Exactly stacked agents have no separating direction; split them along x by index
+        if (m_gatherX[k] == x && m_gatherY[k] == y)
+        {
+            m_gatherX[k] += (neighbor < agentIndex) ? -0.01f : 0.01f;
+        }
+    }
+
+    __m128 const vX       = _mm_set1_ps(x);
+    __m128 const vY       = _mm_set1_ps(y);
+    __m128 const vReach   = _mm_set1_ps(radius + m_config.m_padding);
+    __m128 const vEpsilon = _mm_set1_ps(1e-6f);
+    __m128       pushX    = _mm_setzero_ps();
+    __m128       pushY    = _mm_setzero_ps();
+
+    for (int k = 0; k < paddedCount; k += 4)
+    {
+        __m128 const dx         = _mm_sub_ps(vX, _mm_loadu_ps(&m_gatherX[k]));
+        __m128 const dy         = _mm_sub_ps(vY, _mm_loadu_ps(&m_gatherY[k]));
+        __m128 const distanceSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 const reach      = _mm_add_ps(vReach, _mm_loadu_ps(&m_gatherRadius[k]));
+        __m128 const overlaps   = _mm_cmplt_ps(distanceSq, _mm_mul_ps(reach, reach));
+
+        // (reach - d) / d scales the unnormalised offset straight to the overlap
+        __m128 const distance = _mm_sqrt_ps(_mm_max_ps(distanceSq, vEpsilon));
+        __m128 const scale    = _mm_and_ps(overlaps, _mm_div_ps(_mm_sub_ps(reach, distance), distance));
+
+        pushX = _mm_add_ps(pushX, _mm_mul_ps(dx, scale));
+        pushY = _mm_add_ps(pushY, _mm_mul_ps(dy, scale));
+    }
+
+    alignas(16) float sumX[4];
+    alignas(16) float sumY[4];
+    _mm_store_ps(sumX, pushX);
+    _mm_store_ps(sumY, pushY);
+
+    m_displacementX[agentIndex] = (sumX[0] + sumX[1] + sumX[2] + sumX[3]) * blend;
+    m_displacementY[agentIndex] = (sumY[0] + sumY[1] + sumY[2] + sumY[3]) * blend;
+}
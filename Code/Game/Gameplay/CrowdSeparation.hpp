@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------------------------------
+// CrowdSeparation.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Game/Framework/PointSpatialIndex.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sCrowdSeparationConfig
+{
+    float m_cellSize     = 64.f;     // About the widest enemy, so most queries stay within 3x3 cells
+    float m_padding      = 4.f;      // Gap kept between enemy bodies
+    float m_resolveRate  = 12.f;     // Share of the overlap removed per second, at most all of it per frame
+    int   m_maxNeighbors = 8;        // Per agent; keeps the cost flat inside dense clumps
+};
+
+//----------------------------------------------------------------------------------------------------
+// CrowdSeparation
+// Pushes overlapping enemies apart after their AI has moved them. Agents are added as SoA discs, the
+// PointSpatialIndex is rebuilt from them, and each agent gathers at most m_maxNeighbors neighbours
+// into a small scratch array that is then reduced four neighbours at a time with SSE2. Every agent
+// takes half of each overlap, so a pair that sees each other separates symmetrically.
+//----------------------------------------------------------------------------------------------------
+class CrowdSeparation
+{
+public:
+    explicit CrowdSeparation(sCrowdSeparationConfig const& config);
+
+    void Clear();
+    int  AddAgent(Vec2 const& position, float radius);
+    void Solve(AABB2 const& bounds, float deltaSeconds);
+    Vec2 GetDisplacement(int agentIndex) const { return Vec2(m_displacementX[agentIndex], m_displacementY[agentIndex]); }
+
+    // Instrumentation, as of the last Solve()
+    int    GetAgentCount() const { return static_cast<int>(m_positionX.size()); }
+    int    GetNeighborCount() const { return m_neighborCount; }
+    int    GetCappedAgentCount() const { return m_cappedAgentCount; }
+    double GetSolveMilliseconds() const { return m_solveMilliseconds; }
+
+private:
+    void SolveAgent(int agentIndex, float blend);
+
+    sCrowdSeparationConfig m_config;
+    PointSpatialIndex      m_index;
+
+    // One entry per agent, same index across every array
+    std::vector<float> m_positionX;
+    std::vector<float> m_positionY;
+    std::vector<float> m_radius;
+    std::vector<float> m_displacementX;
+    std::vector<float> m_displacementY;
+    float              m_maxRadius = 0.f;
+
+    // Per-agent gather scratch, padded to a multiple of four with discs that can never overlap
+    std::vector<int>   m_neighbors;
+    std::vector<float> m_gatherX;
+    std::vector<float> m_gatherY;
+    std::vector<float> m_gatherRadius;
+
+    int    m_neighborCount     = 0;
+    int    m_cappedAgentCount  = 0;
+    double m_solveMilliseconds = 0.0;
+};
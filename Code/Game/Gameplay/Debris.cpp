@@ -4,6 +4,7 @@
 
 //----------------------------------------------------------------------------------------------------
 #include "Game/Gameplay/Debris.hpp"
+#include "Game/Framework/FrameArena.hpp"
 #include <Engine/Core/EngineCommon.hpp>
 
 //----------------------------------------------------------------------------------------------------
@@ -22,7 +23,7 @@ Debris::Debris(EntityID const entityID,
     m_thickness      = 10.f;
     m_cosmeticRadius = m_physicRadius + m_thickness;
 
-    g_windowSubsystem->CreateChildWindow(m_entityID, m_name, static_cast<int>(m_position.x), static_cast<int>(m_position.y), 200, 200);
+    g_windowSubsystem->CreateChildWindow(this, m_name, static_cast<int>(m_position.x), static_cast<int>(m_position.y), 200, 200);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -37,15 +38,14 @@ void Debris::Update(float const deltaSeconds)
     Entity::Update(deltaSeconds);
     // m_velocity = Vec2::MakeFromPolarDegrees(m_orientationDegrees);
     // m_position += m_velocity * deltaSeconds * m_speed;
-    WindowID    windowID   = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-    WindowData* windowData = g_windowSubsystem->GetWindowData(windowID);
-    windowData->m_window->SetClientPosition(m_position - windowData->m_window->GetClientDimensions() * 0.5f);
+    if (m_window == nullptr) return;
+    m_window->SetClientPosition(m_position - m_window->GetClientDimensions() * 0.5f);
 }
 
 //----------------------------------------------------------------------------------------------------
 void Debris::Render() const
 {
-    VertexList_PCU verts;
+    VertexList_PCU& verts = g_frameArena->AcquireVertexList();
     AddVertsForAABB2D(verts, AABB2(m_position - Vec2(m_physicRadius, m_physicRadius), m_position + Vec2(m_physicRadius, m_physicRadius)), m_color);
     g_renderer->SetModelConstants();
     g_renderer->SetBlendMode(eBlendMode::OPAQUE);
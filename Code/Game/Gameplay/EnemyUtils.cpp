@@ -5,11 +5,35 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Gameplay/EnemyUtils.hpp"
 //----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/FastMath.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+	//------------------------------------------------------------------------------------------------
+	// Turns the heading toward a unit direction at 360 deg/sec and moves along it. The turn is done on
+	// vectors (FastMath::TurnTowardDirection) so the only trig left is one sincos and one atan2.
+	void SteerToward(Vec2& outPosition, float& outOrientationDegrees, Vec2 const& direction, float speed, float deltaSeconds)
+	{
+		float const maxTurnDegrees = (std::min)(360.f * deltaSeconds, 180.f);
+		float       sinMaxTurn;
+		float       cosMaxTurn;
+		FastMath::SinCosDegrees(maxTurnDegrees, sinMaxTurn, cosMaxTurn);
 
+		Vec2 const heading    = FastMath::MakeFromPolarDegrees(outOrientationDegrees);
+		Vec2 const newHeading = FastMath::TurnTowardDirection(heading, direction, cosMaxTurn, sinMaxTurn);
+
+		outOrientationDegrees = FastMath::GetOrientationDegrees(newHeading);
+		outPosition += newHeading * deltaSeconds * speed;
+	}
+}
 
 //----------------------------------------------------------------------------------------------------
 Vec2 EnemyUtils::GetDirectionToPlayer(Vec2 const& enemyPosition, Vec2 const& playerPosition)
@@ -38,11 +62,7 @@ void EnemyUtils::ChasePlayer(Vec2&       outPosition,
 		return;
 	}
 
-	float const goalDegrees = direction.GetOrientationDegrees();
-	outOrientationDegrees   = GetTurnedTowardDegrees(outOrientationDegrees, goalDegrees, 360.f * deltaSeconds);
-
-	Vec2 const velocity = Vec2::MakeFromPolarDegrees(outOrientationDegrees);
-	outPosition += velocity * deltaSeconds * speed;
+	SteerToward(outPosition, outOrientationDegrees, direction, speed, deltaSeconds);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -62,20 +82,21 @@ void EnemyUtils::OrbitPlayer(Vec2&       outPosition,
 		orbitAngle -= 360.f;
 	}
 
-	Vec2 const orbitOffset = Vec2::MakeFromPolarDegrees(orbitAngle, orbitRadius);
+	Vec2 const orbitOffset = FastMath::MakeFromPolarDegrees(orbitAngle, orbitRadius);
 	Vec2 const targetPos   = playerPosition + orbitOffset;
 
-	// Smooth convergence toward orbit target using Engine Interpolate
+	// Smooth convergence toward orbit target using Engine Interpolate; exponential so one long step
+	// (AI level of detail) closes the same gap as the frames it stands for
 	if (GetDistanceSquared2D(outPosition, targetPos) > 0.0001f)
 	{
-		float const fraction = GetClamped(3.f * deltaSeconds, 0.f, 1.f);
+		float const fraction = 1.f - std::exp(-3.f * deltaSeconds);
 		Vec2 const  prevPos  = outPosition;
 		outPosition          = Interpolate(outPosition, targetPos, fraction);
 
 		Vec2 const moveDir = (outPosition - prevPos);
 		if (moveDir.GetLengthSquared() > 0.0001f)
 		{
-			outOrientationDegrees = moveDir.GetOrientationDegrees();
+			outOrientationDegrees = FastMath::GetOrientationDegrees(moveDir);
 		}
 	}
 }
@@ -105,13 +126,13 @@ void EnemyUtils::ZigZagToward(Vec2&       outPosition,
 
 	// Perpendicular direction for zigzag offset
 	Vec2 const  perpendicular(-direction.y, direction.x);
-	float const sineValue = SinDegrees(phase);
+	float const sineValue = FastMath::SinDegrees(phase);
 
 	// Combined movement: forward + perpendicular zigzag
 	Vec2 const moveDir = (direction + perpendicular * sineValue * (zigzagAmplitude / speed)).GetNormalized();
 	outPosition += moveDir * speed * deltaSeconds;
 
-	outOrientationDegrees = moveDir.GetOrientationDegrees();
+	outOrientationDegrees = FastMath::GetOrientationDegrees(moveDir);
 }
 
 //-----------------------------------------------------------------------------------------------
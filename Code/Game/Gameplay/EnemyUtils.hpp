@@ -7,6 +7,11 @@
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Math/Vec2.hpp"
 
+//----------------------------------------------------------------------------------------------------
+// Client size of every regular enemy's child window; WaveManager warms the window pool at this size
+//----------------------------------------------------------------------------------------------------
+constexpr int ENEMY_WINDOW_SIZE = 200;
+
 //----------------------------------------------------------------------------------------------------
 // EnemyUtils Namespace
 // Provides pure, stateless utility functions for enemy AI behaviors.
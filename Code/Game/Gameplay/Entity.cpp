@@ -4,7 +4,11 @@
 
 #include "Game/Gameplay/Entity.hpp"
 
+#include <algorithm>
+
 #include "Game.hpp"
+#include "Game/Framework/RenderSnapshot.hpp"
+#include "Game/Framework/SnapshotStream.hpp"
 #include "Game/Subsystem/Window/WindowSubsystem.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/EventSystem.hpp"
@@ -32,13 +36,12 @@ void Entity::Update(float const deltaSeconds)
     UNUSED(deltaSeconds)
     if (m_health <= 0) MarkAsDead();
     
-    // Only show/hide child window if entity has an associated window
-    WindowID const windowID = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-    if (windowID != INVALID_WINDOW_ID)
+    // Only show/hide child window if entity has an associated window; the cached WindowData skips the lookup
+    if (m_windowData != nullptr)
     {
-        m_isChildWindowVisible 
-            ? g_windowSubsystem->ShowWindowByWindowID(windowID) 
-            : g_windowSubsystem->HideWindowByWindowID(windowID);
+        m_isChildWindowVisible
+            ? g_windowSubsystem->ShowWindow(m_windowData)
+            : g_windowSubsystem->HideWindow(m_windowData);
     }
 }
 
@@ -46,8 +49,6 @@ void Entity::MarkAsDead()
 {
     m_isDead = true;
 
-    if (m_name == "Bullet" || m_name == "EnemyBullet") return;
-
     if (g_game->GetCurrentGameState() == eGameState::GAME)
     {
         EventArgs args;
@@ -102,6 +103,103 @@ bool Entity::IsEntityVisible() const
     return m_isEntityVisible;
 }
 
+AABB2 Entity::GetCosmeticBounds() const
+{
+    float const radius = (std::max)(m_cosmeticRadius, m_physicRadius);
+    return AABB2(m_position - Vec2(radius, radius), m_position + Vec2(radius, radius));
+}
+
+void Entity::Render() const
+{
+}
+
+bool Entity::GetRenderShape(sRenderShape& outShape) const
+{
+    UNUSED(outShape)
+    return false;
+}
+
+void Entity::FillRenderShape(sRenderShape& outShape, eRenderShape const shape) const
+{
+    outShape.m_position   = m_position;
+    outShape.m_radius     = m_physicRadius;
+    outShape.m_cullRadius = (std::max)(m_cosmeticRadius, m_physicRadius);
+    outShape.m_color      = m_color;
+    outShape.m_shape      = shape;
+    outShape.m_isEntity   = true;
+}
+
+void Entity::UpdateScheduledAI(float const deltaSeconds)
+{
+    AIScheduler* scheduler    = g_game->GetAIScheduler();
+    float        thinkSeconds = 0.f;
+
+    if (!scheduler->BeginUpdate(m_aiSchedule, m_position, (std::max)(m_cosmeticRadius, m_physicRadius), m_entityID, deltaSeconds, thinkSeconds)) return;
+
+    Vec2 const positionBefore = m_position;
+    UpdateAI(thinkSeconds);
+    scheduler->EndThink(m_aiSchedule, positionBefore, m_position, thinkSeconds);
+}
+
+void Entity::UpdateAI(float const deltaSeconds)
+{
+    UNUSED(deltaSeconds)
+}
+
+void Entity::WriteSnapshot(SnapshotWriter& writer) const
+{
+    writer.Write(m_position);
+    writer.Write(m_velocity);
+    writer.Write(m_color);
+    writer.Write(m_health);
+    writer.Write(m_coinToDrop);
+    writer.Write(m_orientationDegrees);
+    writer.Write(m_physicRadius);
+    writer.Write(m_cosmeticRadius);
+    writer.Write(m_thickness);
+    writer.Write(m_speed);
+    writer.Write(m_isDead);
+    writer.Write(m_isGarbage);
+    writer.Write(m_isChildWindowVisible);
+    writer.Write(m_isEntityVisible);
+}
+
+void Entity::ReadSnapshot(SnapshotReader& reader)
+{
+    // m_hasChildWindow is structural: Game recreates the entity with the right value before reading
+    reader.Read(m_position);
+    reader.Read(m_velocity);
+    reader.Read(m_color);
+    reader.Read(m_health);
+    reader.Read(m_coinToDrop);
+    reader.Read(m_orientationDegrees);
+    reader.Read(m_physicRadius);
+    reader.Read(m_cosmeticRadius);
+    reader.Read(m_thickness);
+    reader.Read(m_speed);
+    reader.Read(m_isDead);
+    reader.Read(m_isGarbage);
+    reader.Read(m_isChildWindowVisible);
+    reader.Read(m_isEntityVisible);
+
+    // Dead reckoning from before the restore would be undone against the restored position
+    m_aiSchedule = sAIScheduleState{};
+}
+
+void Entity::BindChildWindow(WindowID const windowID, WindowData* windowData)
+{
+    m_windowID   = windowID;
+    m_window     = windowData->m_window.get();
+    m_windowData = windowData;
+}
+
+void Entity::UnbindChildWindow()
+{
+    m_windowID   = INVALID_WINDOW_ID;
+    m_window     = nullptr;
+    m_windowData = nullptr;
+}
+
 void Entity::IncreaseHealth(int const amount)
 {
     m_health += amount;
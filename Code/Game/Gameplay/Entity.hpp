@@ -6,29 +6,43 @@
 #pragma once
 
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/MemoryTracker.hpp"
+#include "Game/Gameplay/AIScheduler.hpp"
 #include "Game/Subsystem/Window/WindowSubsystem.hpp"
+#include "Engine/Math/AABB2.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class SnapshotReader;
+class SnapshotWriter;
+struct sRenderShape;
+struct WindowData;
+enum class eRenderShape : uint8_t;
 
 //----------------------------------------------------------------------------------------------------
 class Entity
 {
 public:
+    GAME_MEMORY_TAG(eMemoryTag::ENTITY)
+
     explicit Entity(Vec2 const& position, float orientationDegrees, Rgba8 const& color, bool isVisible, bool hasChildWindow);
     virtual  ~Entity();
-    EntityID m_entityID           = 0;
-    WindowID m_windowID           = 0;
-    String   m_name               = "DEFAULT";
-    Vec2     m_position           = Vec2::ZERO;
-    Vec2     m_velocity           = Vec2::ZERO;
-    Rgba8    m_color              = Rgba8::WHITE;
-    int      m_health             = 0;
-    int      m_coinToDrop         = 0;      // TODO: reconsider the name of this variable
-    float    m_orientationDegrees = 0.f;
-    float    m_physicRadius       = 0.f;
-    float    m_cosmeticRadius     = 0.f;
-    float    m_thickness          = 0.f;
+    EntityID    m_entityID           = 0;
+    WindowID    m_windowID           = 0;        // Cached by WindowSubsystem while the child window is alive
+    Window*     m_window             = nullptr;  // Cached by WindowSubsystem while the child window is alive
+    WindowData* m_windowData         = nullptr;  // Cached by WindowSubsystem while the child window is alive
+    String      m_name               = "DEFAULT";
+    Vec2        m_position           = Vec2::ZERO;
+    Vec2        m_velocity           = Vec2::ZERO;
+    Rgba8       m_color              = Rgba8::WHITE;
+    int         m_health             = 0;
+    int         m_coinToDrop         = 0;      // TODO: reconsider the name of this variable
+    float       m_orientationDegrees = 0.f;
+    float       m_physicRadius       = 0.f;
+    float       m_cosmeticRadius     = 0.f;
+    float       m_thickness          = 0.f;
 
     virtual void Update(float deltaSeconds);
-    virtual void Render() const = 0;
+    virtual void Render() const;     // Draws nothing; only entities without a render shape override it
     virtual void UpdateFromInput(float deltaSeconds) = 0;    // TODO: should entity handle its own input logic? or should the game handle it for him?
 
     virtual void MarkAsDead();
@@ -43,11 +57,36 @@ public:
     virtual bool IsChildWindowVisible() const;
     virtual bool IsEntityVisible() const;
 
+    virtual AABB2 GetCosmeticBounds() const;      // Everything Render() may draw, used for render culling
+
+    // Pipelined rendering: entities that can be described as one sRenderShape are drawn by render prep;
+    // the rest (return false) keep drawing themselves through Render() on the main thread
+    virtual bool GetRenderShape(sRenderShape& outShape) const;
+
+    // Rewind snapshots: the base writes the shared state, overrides append their own after it
+    virtual void WriteSnapshot(SnapshotWriter& writer) const;
+    virtual void ReadSnapshot(SnapshotReader& reader);
+    bool         HasChildWindow() const { return m_hasChildWindow; }
+
+    void BindChildWindow(WindowID windowID, WindowData* windowData);
+    void UnbindChildWindow();
+
     void  IncreaseHealth(int amount);
     void  DecreaseHealth(int amount);
     float m_speed = 100.f;
 
+    mutable int m_costRowIndex = -1;     // EntityCostTracker row, resolved from m_name on the first sample
+
 protected:
+    void FillRenderShape(sRenderShape& outShape, eRenderShape shape) const;
+
+    // AI level of detail: Update() calls UpdateScheduledAI(), which runs UpdateAI() on the frames the
+    // AIScheduler picks (with every second since the last run) and extrapolates the position otherwise
+    void         UpdateScheduledAI(float deltaSeconds);
+    virtual void UpdateAI(float deltaSeconds);
+
+    sAIScheduleState m_aiSchedule;
+
     bool m_isDead               = false;
     bool m_isGarbage            = false;
     bool m_isChildWindowVisible = true;        // Should we show this entity's child window or not?
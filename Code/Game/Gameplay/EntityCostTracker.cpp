@@ -0,0 +1,201 @@
+//----------------------------------------------------------------------------------------------------
+// EntityCostTracker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/EntityCostTracker.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int PHASE_COUNT = static_cast<int>(eEntityCostPhase::COUNT);
+    constexpr int UPDATE      = static_cast<int>(eEntityCostPhase::UPDATE);
+    constexpr int RENDER      = static_cast<int>(eEntityCostPhase::RENDER);
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+EntityCostTracker::EntityCostTracker(sEntityCostTrackerConfig const& config)
+    : m_config(config),
+      m_startTicks(__rdtsc()),
+      m_startSeconds(GetNowSeconds())
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityCostTracker::BeginFrame()
+{
+    if (!m_config.m_isEnabled) return;
+
+    // The longer the run, the better the estimate; the first frame is already good to a few percent
+    uint64_t const nowTicks   = __rdtsc();
+    double const   nowSeconds = GetNowSeconds();
+    if (nowTicks > m_startTicks && nowSeconds > m_startSeconds)
+    {
+        m_millisecondsPerTick = (nowSeconds - m_startSeconds) * 1000.0 / static_cast<double>(nowTicks - m_startTicks);
+    }
+
+    m_lastFrameMilliseconds = 0.f;
+
+    for (sEntityCostRow& row : m_rows)
+    {
+        float frameMilliseconds = 0.f;
+
+        for (int p = 0; p < PHASE_COUNT; ++p)
+        {
+            float const milliseconds = TicksToMilliseconds(row.m_frameTicks[p]);
+
+            row.m_lastFrameMilliseconds[p] = milliseconds;
+            row.m_averageMilliseconds[p] += (milliseconds - row.m_averageMilliseconds[p]) * m_config.m_averageBlend;
+            row.m_totalTicks[p] += row.m_frameTicks[p];
+            row.m_totalCalls[p] += static_cast<uint64_t>(row.m_frameCalls[p]);
+            frameMilliseconds += milliseconds;
+        }
+
+        row.m_lastFrameCount        = row.m_frameCalls[UPDATE];
+        row.m_peakFrameMilliseconds = (std::max)(row.m_peakFrameMilliseconds, frameMilliseconds);
+        m_lastFrameMilliseconds += frameMilliseconds;
+
+        std::fill(std::begin(row.m_frameTicks), std::end(row.m_frameTicks), 0ull);
+        std::fill(std::begin(row.m_frameCalls), std::end(row.m_frameCalls), 0);
+    }
+
+    m_sortedRowIndices.resize(m_rows.size());
+    for (int i = 0; i < static_cast<int>(m_rows.size()); ++i)
+    {
+        m_sortedRowIndices[i] = i;
+    }
+
+    std::sort(m_sortedRowIndices.begin(), m_sortedRowIndices.end(), [this](int const a, int const b)
+    {
+        return m_rows[a].GetAverageTotalMilliseconds() > m_rows[b].GetAverageTotalMilliseconds();
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EntityCostTracker::WriteJsonReport(String const& filePath, int const waveNumber) const
+{
+    std::filesystem::path const path(filePath);
+    if (path.has_parent_path())
+    {
+        std::error_code errorCode;
+        std::filesystem::create_directories(path.parent_path(), errorCode);
+    }
+
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+    {
+        DebuggerPrintf("EntityCostTracker: Could not write %s\n", filePath.c_str());
+        return false;
+    }
+
+    std::vector<int> order(m_rows.size());
+    for (int i = 0; i < static_cast<int>(m_rows.size()); ++i)
+    {
+        order[i] = i;
+    }
+
+    std::sort(order.begin(), order.end(), [this](int const a, int const b)
+    {
+        return m_rows[a].m_totalTicks[UPDATE] + m_rows[a].m_totalTicks[RENDER] > m_rows[b].m_totalTicks[UPDATE] + m_rows[b].m_totalTicks[RENDER];
+    });
+
+    file << "{\n";
+    file << "    \"wave\": " << waveNumber << ",\n";
+    file << "    \"types\": [\n";
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        sEntityCostRow const& row         = m_rows[order[i]];
+        float const           updateMs    = TicksToMilliseconds(row.m_totalTicks[UPDATE]);
+        float const           renderMs    = TicksToMilliseconds(row.m_totalTicks[RENDER]);
+        uint64_t const        updateCalls = row.m_totalCalls[UPDATE];
+        float const           usPerUpdate = updateCalls > 0 ? updateMs * 1000.f / static_cast<float>(updateCalls) : 0.f;
+
+        file << "        { \"type\": \"" << row.m_typeName << "\""
+             << ", \"totalMs\": " << updateMs + renderMs
+             << ", \"updateMs\": " << updateMs
+             << ", \"renderMs\": " << renderMs
+             << ", \"updateCalls\": " << updateCalls
+             << ", \"renderCalls\": " << row.m_totalCalls[RENDER]
+             << ", \"microsecondsPerUpdate\": " << usPerUpdate
+             << ", \"peakFrameMs\": " << row.m_peakFrameMilliseconds
+             << " }" << (i + 1 < order.size() ? "," : "") << "\n";
+    }
+
+    file << "    ]\n";
+    file << "}\n";
+
+    return file.good();
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityCostTracker::ResetTotals()
+{
+    for (sEntityCostRow& row : m_rows)
+    {
+        std::fill(std::begin(row.m_totalTicks), std::end(row.m_totalTicks), 0ull);
+        std::fill(std::begin(row.m_totalCalls), std::end(row.m_totalCalls), 0ull);
+        row.m_peakFrameMilliseconds = 0.f;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityCostTracker::AddRenderPrepCosts(std::vector<sRenderPrepCost> const& prepCosts)
+{
+    if (!m_config.m_isEnabled) return;
+
+    int const rowCount = (std::min)(static_cast<int>(prepCosts.size()), static_cast<int>(m_rows.size()));
+    for (int i = 0; i < rowCount; ++i)
+    {
+        m_rows[i].m_frameTicks[RENDER] += prepCosts[i].m_ticks;
+        m_rows[i].m_frameCalls[RENDER] += prepCosts[i].m_shapeCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void EntityCostTracker::AddSample(Entity const& entity, eEntityCostPhase const phase, uint64_t const ticks)
+{
+    sEntityCostRow& row = m_rows[FindOrAddRow(entity)];
+
+    row.m_frameTicks[static_cast<int>(phase)] += ticks;
+    ++row.m_frameCalls[static_cast<int>(phase)];
+}
+
+//----------------------------------------------------------------------------------------------------
+// FindOrAddRow - By name only on an entity's first sample; the row index is cached on the entity
+//----------------------------------------------------------------------------------------------------
+int EntityCostTracker::FindOrAddRow(Entity const& entity)
+{
+    if (entity.m_costRowIndex >= 0 && entity.m_costRowIndex < static_cast<int>(m_rows.size())) return entity.m_costRowIndex;
+
+    String const typeName = entity.HasChildWindow() ? entity.m_name + " [window]" : entity.m_name;
+
+    for (int i = 0; i < static_cast<int>(m_rows.size()); ++i)
+    {
+        if (m_rows[i].m_typeName == typeName)
+        {
+            entity.m_costRowIndex = i;
+            return i;
+        }
+    }
+
+    m_rows.emplace_back();
+    m_rows.back().m_typeName = typeName;
+
+    entity.m_costRowIndex = static_cast<int>(m_rows.size()) - 1;
+    return entity.m_costRowIndex;
+}
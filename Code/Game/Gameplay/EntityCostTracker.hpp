@@ -0,0 +1,105 @@
+//----------------------------------------------------------------------------------------------------
+// EntityCostTracker.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <intrin.h>
+#include <vector>
+
+#include "Game/Framework/RenderSnapshot.hpp"
+#include "Game/Gameplay/Entity.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eEntityCostPhase : uint8_t
+{
+    UPDATE,     // Update() + UpdateFromInput() in Game::Update
+    RENDER,     // Cull + vertices in RenderPipeline::BuildBatch (prep thread), Render() in Game::RenderGame
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sEntityCostTrackerConfig
+{
+    bool  m_isEnabled    = true;
+    float m_averageBlend = 0.05f;     // Weight of the newest frame in the overlay's running average
+};
+
+//----------------------------------------------------------------------------------------------------
+// One row per concrete entity type, split by whether the entity owns a child window
+//----------------------------------------------------------------------------------------------------
+struct sEntityCostRow
+{
+    String m_typeName;
+    int    m_lastFrameCount = 0;     // Entities of this row updated last frame
+
+    float m_lastFrameMilliseconds[static_cast<int>(eEntityCostPhase::COUNT)] = {};
+    float m_averageMilliseconds[static_cast<int>(eEntityCostPhase::COUNT)]   = {};
+    float m_peakFrameMilliseconds                                            = 0.f;     // Update + render, since the last ResetTotals()
+
+    // Since the last ResetTotals(), for the wave reports
+    uint64_t m_totalTicks[static_cast<int>(eEntityCostPhase::COUNT)] = {};
+    uint64_t m_totalCalls[static_cast<int>(eEntityCostPhase::COUNT)] = {};
+
+    // Current frame, published by BeginFrame()
+    uint64_t m_frameTicks[static_cast<int>(eEntityCostPhase::COUNT)] = {};
+    int      m_frameCalls[static_cast<int>(eEntityCostPhase::COUNT)] = {};
+
+    float GetAverageTotalMilliseconds() const { return m_averageMilliseconds[0] + m_averageMilliseconds[1]; }
+};
+
+//----------------------------------------------------------------------------------------------------
+// EntityCostTracker
+// Aggregates per-type time and call counts around the entity calls in the game loop. A sample is two
+// reads of the time-stamp counter bracketing the call, charged to the row the entity cached on its
+// first sample, so nothing is looked up by name per frame; disabled, a sample is one branch. Ticks
+// are turned into milliseconds once per frame, calibrated against steady_clock over the whole run.
+//----------------------------------------------------------------------------------------------------
+class EntityCostTracker
+{
+public:
+    explicit EntityCostTracker(sEntityCostTrackerConfig const& config);
+
+    // Publishes the previous frame (its update and its render) and starts the next one
+    void BeginFrame();
+
+    uint64_t BeginSample() const { return m_config.m_isEnabled ? __rdtsc() : 0; }
+    void     EndSample(Entity const& entity, eEntityCostPhase const phase, uint64_t const startTicks)
+    {
+        if (!m_config.m_isEnabled) return;
+        AddSample(entity, phase, __rdtsc() - startTicks);
+    }
+
+    // Render prep runs on another thread: shapes carry their row, and the submitted batch's costs are
+    // charged to the RENDER phase of the frame that submits it
+    int  GetRowIndex(Entity const& entity) { return m_config.m_isEnabled ? FindOrAddRow(entity) : -1; }
+    void AddRenderPrepCosts(std::vector<sRenderPrepCost> const& prepCosts);
+
+    // Totals since the last ResetTotals(), most expensive first; returns false if the file could not be written
+    bool WriteJsonReport(String const& filePath, int waveNumber) const;
+    void ResetTotals();
+
+    void SetEnabled(bool const isEnabled) { m_config.m_isEnabled = isEnabled; }
+    bool IsEnabled() const { return m_config.m_isEnabled; }
+
+    // Rows sorted by average update + render cost, as of the last BeginFrame()
+    std::vector<int> const& GetSortedRowIndices() const { return m_sortedRowIndices; }
+    sEntityCostRow const&   GetRow(int const rowIndex) const { return m_rows[rowIndex]; }
+    float                   GetLastFrameMilliseconds() const { return m_lastFrameMilliseconds; }
+
+private:
+    void  AddSample(Entity const& entity, eEntityCostPhase phase, uint64_t ticks);
+    int   FindOrAddRow(Entity const& entity);
+    float TicksToMilliseconds(uint64_t ticks) const { return static_cast<float>(static_cast<double>(ticks) * m_millisecondsPerTick); }
+
+    sEntityCostTrackerConfig    m_config;
+    std::vector<sEntityCostRow> m_rows;
+    std::vector<int>            m_sortedRowIndices;
+    float                       m_lastFrameMilliseconds = 0.f;     // Every row, update + render
+
+    // Calibration: ticks and seconds since construction
+    uint64_t m_startTicks          = 0;
+    double   m_startSeconds        = 0.0;
+    double   m_millisecondsPerTick = 0.0;
+};
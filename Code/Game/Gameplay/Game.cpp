@@ -6,20 +6,28 @@
 #include "Game/Gameplay/Game.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Game/Framework/App.hpp"
+#include "Game/Framework/FrameArena.hpp"
 #include "Game/Framework/GameCommon.hpp"
-#include "Game/Gameplay/Bullet.hpp"
+#include "Game/Framework/RenderPipeline.hpp"
+#include "Game/Framework/RewindBuffer.hpp"
+#include "Game/Framework/SnapshotStream.hpp"
 #include "Game/Gameplay/Circle.hpp"
-#include "Game/Gameplay/Coin.hpp"
+#include "Game/Gameplay/CoinField.hpp"
+#include "Game/Gameplay/CrowdSeparation.hpp"
 #include "Game/Gameplay/EnemyUtils.hpp"
+#include "Game/Gameplay/EntityCostTracker.hpp"
 #include "Game/Gameplay/Hexagon.hpp"
 #include "Game/Gameplay/Octagon.hpp"
 #include "Game/Gameplay/Pentagon.hpp"
 #include "Game/Gameplay/Player.hpp"
+#include "Game/Gameplay/ProjectileSystem.hpp"
 #include "Game/Gameplay/Shop.hpp"
+#include "Game/Gameplay/SpawnQueue.hpp"
 #include "Game/Gameplay/Square.hpp"
 #include "Game/Gameplay/Triangle.hpp"
 #include "Game/Gameplay/UpgradeManager.hpp"
 #include "Game/Gameplay/WaveManager.hpp"
+#include "Game/Subsystem/Audio/AudioRequestQueue.hpp"
 #include "Game/Subsystem/Widget/ButtonWidget.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Audio/AudioSystem.hpp"
@@ -35,6 +43,9 @@
 #include "Engine/Renderer/VertexUtils.hpp"
 #include "Engine/Resource/ResourceSubsystem.hpp"
 #include "Engine/Widget/WidgetSubsystem.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
 
 // Start entity IDs from 1 (0 is reserved as INVALID_ENTITY_ID)
 int Game::s_nextEntityID = 1;
@@ -58,8 +69,15 @@ Game::Game()
 
     m_gameClock = new Clock(Clock::GetSystemClock());
 
-    m_waveManager    = new WaveManager(this);
-    m_upgradeManager = new UpgradeManager(this);
+    m_waveManager       = new WaveManager(this);
+    m_upgradeManager    = new UpgradeManager(this);
+    m_coinField         = new CoinField(sCoinFieldConfig{});
+    m_projectileSystem  = new ProjectileSystem(sProjectileSystemConfig{});
+    m_rewindBuffer      = new RewindBuffer(sRewindBufferConfig{});
+    m_aiScheduler       = new AIScheduler(sAISchedulerConfig{});
+    m_crowdSeparation   = new CrowdSeparation(sCrowdSeparationConfig{});
+    m_spawnQueue        = new SpawnQueue(sSpawnQueueConfig{});
+    m_entityCostTracker = new EntityCostTracker(sEntityCostTrackerConfig{});
 
     SpawnPlayer();
     // TODO: spawn before firing the event will cause nullptr
@@ -83,6 +101,13 @@ Game::~Game()
     g_eventSystem->UnsubscribeEventCallbackFunction("OnWaveComplete", OnWaveComplete);
     g_eventSystem->UnsubscribeEventCallbackFunction("OnBossSpawn", OnBossSpawn);
     g_eventSystem->UnsubscribeEventCallbackFunction("OnUpgradePurchased", OnUpgradePurchased);
+    GAME_SAFE_RELEASE(m_entityCostTracker);
+    GAME_SAFE_RELEASE(m_spawnQueue);
+    GAME_SAFE_RELEASE(m_crowdSeparation);
+    GAME_SAFE_RELEASE(m_aiScheduler);
+    GAME_SAFE_RELEASE(m_rewindBuffer);
+    GAME_SAFE_RELEASE(m_projectileSystem);
+    GAME_SAFE_RELEASE(m_coinField);
     GAME_SAFE_RELEASE(m_upgradeManager);
     GAME_SAFE_RELEASE(m_waveManager);
     GAME_SAFE_RELEASE(m_screenCamera);
@@ -91,9 +116,17 @@ Game::~Game()
 //----------------------------------------------------------------------------------------------------
 void Game::Update()
 {
-    float const gameDeltaSeconds = static_cast<float>(m_gameClock->GetDeltaSeconds());
+    float gameDeltaSeconds = static_cast<float>(m_gameClock->GetDeltaSeconds());
+
+    m_entityCostTracker->BeginFrame();
+    UpdateRewind();
 
-    if (m_gameState == eGameState::GAME)
+    if (m_isRewinding)
+    {
+        // The restored world is held still; entities still update with a zero step so their windows follow
+        gameDeltaSeconds = 0.f;
+    }
+    else if (m_gameState == eGameState::GAME)
     {
         // WaveManager handles all enemy spawning (timing, type selection, wave progression)
         if (m_waveManager)
@@ -102,10 +135,21 @@ void Game::Update()
         }
 
         HandleEntityCollision();
+        HandleProjectileCollision();
+        UpdateCoinField(gameDeltaSeconds);
+
+        // After the collisions, so children of a hexagon killed this frame can still appear this frame
+        FlushSpawnQueue();
     }
 
     UpdateFromInput();
     AdjustForPauseAndTimeDistortion();
+
+    // LOD is picked against this frame's player position and visible child windows
+    Player const* player = GetPlayer();
+    g_windowSubsystem->GetVisibleClientRects(m_aiVisibleWindowRects);
+    m_aiScheduler->BeginFrame(player != nullptr ? player->m_position : Vec2::ZERO, AABB2(Vec2::ZERO, Window::s_mainWindow->GetScreenDimensions()), m_aiVisibleWindowRects);
+
     for (size_t i = 0; i < m_entityList.size(); ++i)
     {
         Entity* entity = m_entityList[i];
@@ -113,8 +157,16 @@ void Game::Update()
         {
             if (!entity->IsDead())
             {
+                uint64_t const sampleStart = m_entityCostTracker->BeginSample();
+
                 entity->Update(gameDeltaSeconds);
-                entity->UpdateFromInput(gameDeltaSeconds);
+
+                if (!m_isRewinding)
+                {
+                    entity->UpdateFromInput(gameDeltaSeconds);
+                }
+
+                m_entityCostTracker->EndSample(*entity, eEntityCostPhase::UPDATE, sampleStart);
             }
             else
             {
@@ -125,6 +177,18 @@ void Game::Update()
             }
         }
     }
+
+    if (m_gameState == eGameState::GAME && !m_isRewinding)
+    {
+        SeparateEnemies(gameDeltaSeconds);
+    }
+
+    UpdateProjectiles(gameDeltaSeconds);
+
+    if (m_gameState == eGameState::GAME && !m_isRewinding && m_rewindBuffer->AdvanceCaptureTimer(gameDeltaSeconds))
+    {
+        CaptureSnapshot(m_rewindBuffer->BeginCapture());
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -189,25 +253,15 @@ STATIC bool Game::OnEntityDestroyed(EventArgs& args)
     String   name     = args.GetValue("name", "DEFAULT");
     EntityID entityID = args.GetValue("entityID", -1);
 
-    if (name == "Coin") return true;
-
     Entity* entity = g_game->GetEntityByEntityID(entityID);
     if (entity == nullptr) return true;
 
     // Only enemies drop coins
     if (!IsEnemy(entity)) return true;
 
-    // Spawn coins based on m_coinToDrop (minimum 1)
+    // Drop one stack worth m_coinToDrop (minimum 1); nearby stacks merge inside the coin field
     int const coinCount = (entity->m_coinToDrop > 0) ? entity->m_coinToDrop : 1;
-    for (int i = 0; i < coinCount; ++i)
-    {
-        // Scatter coins slightly around death position for visual variety
-        float const scatterAngle = 360.f / static_cast<float>(coinCount) * static_cast<float>(i);
-        Vec2 const  offset       = Vec2::MakeFromPolarDegrees(scatterAngle, 10.f * static_cast<float>(i > 0));
-        Vec2 const  coinPos      = entity->m_position + offset;
-
-        g_game->m_entityList.push_back(new Coin((int)g_game->m_entityList.size(), coinPos, 0.f, Rgba8::YELLOW, true, false));
-    }
+    g_game->m_coinField->SpawnStack(entity->m_position, coinCount);
 
     return true;
 }
@@ -227,6 +281,9 @@ STATIC bool Game::OnWaveStart(EventArgs& args)
         DebuggerPrintf("Wave %d started.\n", waveNumber);
     }
 
+    // Instant retry (Y) returns here
+    g_game->CaptureSnapshot(g_game->m_waveStartSnapshot);
+
     return true;
 }
 
@@ -236,6 +293,11 @@ STATIC bool Game::OnWaveComplete(EventArgs& args)
     int const waveNumber = atoi(args.GetValue("waveNumber", "0").c_str());
     DebuggerPrintf("Wave %d completed!\n", waveNumber);
 
+    // Headless snapshot so long runs can be compared wave by wave without the overlay
+    MemoryTracker::WriteJsonReport(Stringf("Data/Logs/MemoryReport_Wave%03d.json", waveNumber), waveNumber);
+    g_game->m_entityCostTracker->WriteJsonReport(Stringf("Data/Logs/EntityCostReport_Wave%03d.json", waveNumber), waveNumber);
+    g_game->m_entityCostTracker->ResetTotals();
+
     return true;
 }
 
@@ -319,6 +381,12 @@ Shop* Game::GetShop() const
     return nullptr;
 }
 
+//----------------------------------------------------------------------------------------------------
+ProjectileSystem* Game::GetProjectileSystem() const
+{
+    return m_projectileSystem;
+}
+
 //----------------------------------------------------------------------------------------------------
 WaveManager* Game::GetWaveManager() const
 {
@@ -331,6 +399,18 @@ UpgradeManager* Game::GetUpgradeManager() const
     return m_upgradeManager;
 }
 
+//----------------------------------------------------------------------------------------------------
+AIScheduler* Game::GetAIScheduler() const
+{
+    return m_aiScheduler;
+}
+
+//----------------------------------------------------------------------------------------------------
+SpawnQueue* Game::GetSpawnQueue() const
+{
+    return m_spawnQueue;
+}
+
 //----------------------------------------------------------------------------------------------------
 Entity* Game::GetEntityByEntityID(EntityID const& entityID) const
 {
@@ -383,21 +463,56 @@ void Game::UpdateFromInput()
             g_audio->StartSound(clickSound, false, 10.f, 0.f, 1.f);
         }
     }
+
+    if (g_input->WasKeyJustPressed(KEYCODE_I))
+    {
+        m_isStatsOverlayVisible = !m_isStatsOverlayVisible;
+    }
+
+    if (g_input->WasKeyJustPressed(KEYCODE_M))
+    {
+        m_isMemoryOverlayVisible = !m_isMemoryOverlayVisible;
+    }
+
+    if (g_input->WasKeyJustPressed(KEYCODE_C))
+    {
+        m_isEntityCostOverlayVisible = !m_isEntityCostOverlayVisible;
+    }
+
+    if (g_input->WasKeyJustPressed(KEYCODE_L))
+    {
+        m_aiScheduler->SetEnabled(!m_aiScheduler->IsEnabled());
+    }
+
+    if (g_input->WasKeyJustPressed(KEYCODE_B))
+    {
+        m_spawnQueue->SetEnabled(!m_spawnQueue->IsEnabled());
+    }
+
+    if (g_input->WasKeyJustPressed(KEYCODE_F))
+    {
+        m_waveManager->SetPrecomputeEnabled(!m_waveManager->IsPrecomputeEnabled());
+    }
 }
 
+//----------------------------------------------------------------------------------------------------
+// FireCollisionEvent - Fired every frame two entities overlap, so the args and the event name are
+// kept alive and only their values are overwritten; the key nodes are never reallocated.
 //----------------------------------------------------------------------------------------------------
 void Game::FireCollisionEvent(Entity* entityA, Entity* entityB)
 {
-    EventArgs args;
+    static String const collisionEventName = "OnCollisionEnter";
+
+    EventArgs& args = m_collisionEventArgs;
     args.SetValue("entityA", entityA->m_name);
     args.SetValue("entityAID", std::to_string(entityA->m_entityID));
     args.SetValue("entityB", entityB->m_name);
     args.SetValue("entityBID", std::to_string(entityB->m_entityID));
-    g_eventSystem->FireEvent("OnCollisionEnter", args);
+    g_eventSystem->FireEvent(collisionEventName, args);
 }
 
 //----------------------------------------------------------------------------------------------------
-// IsEnemy - Returns true if the entity is an enemy type (not player, bullet, coin, shop, debris)
+// IsEnemy - Returns true if the entity is an enemy type (not player, shop, debris)
 //----------------------------------------------------------------------------------------------------
 bool Game::IsEnemy(Entity const* entity)
 {
@@ -405,22 +520,14 @@ bool Game::IsEnemy(Entity const* entity)
 
     String const& name = entity->m_name;
     return name != "You"
-        && name != "Bullet"
-        && name != "EnemyBullet"
-        && name != "Coin"
         && name != "Shop"
         && name != "Debris"
         && name != "DEFAULT";
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::HandleBulletEnemyCollision(Bullet* bullet, Entity* enemy)
+void Game::HandleBulletEnemyCollision(Entity* enemy)
 {
-    FireCollisionEvent(bullet, enemy);
-
-    // Kill bullet immediately so it can't hit multiple enemies in the same frame
-    bullet->MarkAsDead();
-
     enemy->DecreaseHealth(1);
 
     // Per-type knockback: tanky enemies resist, others get moderate pushback
@@ -438,18 +545,25 @@ void Game::HandleBulletEnemyCollision(Bullet* bullet, Entity* enemy)
     }
 
     SoundID const hitSound = g_audio->CreateOrGetSound("Data/Audio/hit.mp3", eAudioSystemSoundDimension::Sound2D);
-    g_audio->StartSound(hitSound, false, 1.f, 0.f, 1.f);
+    g_audioRequestQueue->RequestSound(hitSound);
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::HandlePlayerCoinCollision(Player* player, Coin* coin)
+// UpdateCoinField - Coins live outside m_entityList, so pickup is tested against the player alone
+//----------------------------------------------------------------------------------------------------
+void Game::UpdateCoinField(float const deltaSeconds)
 {
-    FireCollisionEvent(player, coin);
+    Player* player = GetPlayer();
+    if (player == nullptr || player->IsDead()) return;
+
+    int const collectedValue = m_coinField->Update(deltaSeconds, player->m_position, player->m_physicRadius);
+    if (collectedValue <= 0) return;
 
-    coin->DecreaseHealth(1);
+    player->IncreaseCoin(collectedValue);
+    player->m_coinWidget->SetText(g_frameArena->Format("Coin=%d", player->m_coin));
 
     SoundID const coinSound = g_audio->CreateOrGetSound("Data/Audio/coin.mp3", eAudioSystemSoundDimension::Sound2D);
-    g_audio->StartSound(coinSound, false, 1.f, 0.f, 1.f);
+    g_audioRequestQueue->RequestSound(coinSound);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -459,17 +573,13 @@ void Game::HandlePlayerEnemyCollision(Player* player, Entity* enemy)
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::HandleEnemyBulletPlayerCollision(Bullet* enemyBullet, Player* player)
+void Game::HandleEnemyBulletPlayerCollision(Player* player)
 {
-    FireCollisionEvent(player, enemyBullet);
-
-    enemyBullet->MarkAsDead();
-
     player->DecreaseHealth(1);
-    player->m_healthWidget->SetText(Stringf("Health=%d/%d", player->m_health, player->m_maxHealth));
+    player->m_healthWidget->SetText(g_frameArena->Format("Health=%d/%d", player->m_health, player->m_maxHealth));
 
     SoundID const hitSound = g_audio->CreateOrGetSound("Data/Audio/hit.mp3", eAudioSystemSoundDimension::Sound2D);
-    g_audio->StartSound(hitSound, false, 1.f, 0.f, 1.f);
+    g_audioRequestQueue->RequestSound(hitSound);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -487,41 +597,149 @@ void Game::HandleEntityCollision()
             if (!DoDiscsOverlap2D(entityA->m_position, entityA->m_physicRadius, entityB->m_position, entityB->m_physicRadius))
                 continue;
 
-            Bullet* bulletA = dynamic_cast<Bullet*>(entityA);
-            Bullet* bulletB = dynamic_cast<Bullet*>(entityB);
             Player* playerA = dynamic_cast<Player*>(entityA);
             Player* playerB = dynamic_cast<Player*>(entityB);
-            Coin*   coinA   = dynamic_cast<Coin*>(entityA);
-            Coin*   coinB   = dynamic_cast<Coin*>(entityB);
-
-            // Player bullet vs Enemy (all enemy types; excludes EnemyBullets)
-            if (bulletA && bulletA->m_name == "Bullet" && IsEnemy(entityB))
-                HandleBulletEnemyCollision(bulletA, entityB);
-            else if (bulletB && bulletB->m_name == "Bullet" && IsEnemy(entityA))
-                HandleBulletEnemyCollision(bulletB, entityA);
-            // Player vs Coin
-            else if (playerA && coinB)
-                HandlePlayerCoinCollision(playerA, coinB);
-            else if (playerB && coinA)
-                HandlePlayerCoinCollision(playerB, coinA);
-            // Player vs Enemy (all enemy types)
-            else if (playerA && IsEnemy(entityB))
+
+            // Player vs Enemy (all enemy types); bullets are handled by HandleProjectileCollision
+            if (playerA && IsEnemy(entityB))
                 HandlePlayerEnemyCollision(playerA, entityB);
             else if (playerB && IsEnemy(entityA))
                 HandlePlayerEnemyCollision(playerB, entityA);
-            // EnemyBullet vs Player
-            else if (bulletA && bulletA->m_name == "EnemyBullet" && playerB)
-                HandleEnemyBulletPlayerCollision(bulletA, playerB);
-            else if (bulletB && bulletB->m_name == "EnemyBullet" && playerA)
-                HandleEnemyBulletPlayerCollision(bulletB, playerA);
-
-            // If entityA died during collision handling (e.g., bullet hit enemy),
-            // stop checking it against remaining entities
+
+            // If entityA died during collision handling, stop checking it against remaining entities
             if (entityA->IsDead()) break;
         }
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+// HandleProjectileCollision - Player bullets are tested against living enemies, enemy bullets
+// against the player; each bullet dies on its first hit.
+//----------------------------------------------------------------------------------------------------
+void Game::HandleProjectileCollision()
+{
+    AABB2 const worldBounds = AABB2(Vec2::ZERO, Window::s_mainWindow->GetScreenDimensions());
+
+    m_projectileTargets.clear();
+    for (int i = 0; i < (int)m_entityList.size(); ++i)
+    {
+        Entity const* entity = m_entityList[i];
+        if (entity == nullptr || entity->IsDead() || !IsEnemy(entity)) continue;
+        m_projectileTargets.push_back(sProjectileTarget{entity->m_position, entity->m_physicRadius, i});
+    }
+
+    m_projectileSystem->CollideWithTargets(eProjectileFaction::PLAYER, m_projectileTargets, worldBounds, m_projectileHits);
+    for (sProjectileHit const& hit : m_projectileHits)
+    {
+        HandleBulletEnemyCollision(m_entityList[hit.m_targetIndex]);
+    }
+
+    Player* player = GetPlayer();
+    if (player == nullptr || player->IsDead()) return;
+
+    m_projectileTargets.clear();
+    m_projectileTargets.push_back(sProjectileTarget{player->m_position, player->m_physicRadius, 0});
+
+    m_projectileSystem->CollideWithTargets(eProjectileFaction::ENEMY, m_projectileTargets, worldBounds, m_projectileHits);
+    for (size_t i = 0; i < m_projectileHits.size(); ++i)
+    {
+        HandleEnemyBulletPlayerCollision(player);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// UpdateProjectiles - Bullets reaching an edge of the player window die and push that edge out
+//----------------------------------------------------------------------------------------------------
+void Game::UpdateProjectiles(float const deltaSeconds)
+{
+    m_projectileSystem->Update(deltaSeconds);
+
+    Player* player = GetPlayer();
+    Window* window = player ? player->m_window : nullptr;
+    if (window == nullptr) return;
+
+    WindowID const windowID    = player->m_windowID;
+    Vec2 const     currentPos  = window->GetWindowPosition();
+    Vec2 const     currentSize = window->GetWindowDimensions();
+
+    m_projectileSystem->CollectEdgeHits(AABB2(currentPos, currentPos + currentSize), m_projectileEdgeHits);
+    if (m_projectileEdgeHits.empty()) return;
+
+    // Sum every edge hit first; the window subsystem turns the total into one animation per frame
+    Vec2 positionDelta  = Vec2::ZERO;
+    Vec2 dimensionDelta = Vec2::ZERO;
+
+    for (eProjectileEdge const edge : m_projectileEdgeHits)
+    {
+        switch (edge)
+        {
+        case eProjectileEdge::RIGHT:
+            // Right edge: expand width
+            positionDelta += Vec2(10, 0);
+            dimensionDelta += Vec2(10, 0);
+            break;
+        case eProjectileEdge::LEFT:
+            // Left edge: shift left and expand width
+            positionDelta += Vec2(-20, 0);
+            dimensionDelta += Vec2(10, 0);
+            break;
+        case eProjectileEdge::TOP:
+            // Top edge: shift up and expand height
+            positionDelta += Vec2(0, 10);
+            dimensionDelta += Vec2(0, 10);
+            break;
+        case eProjectileEdge::BOTTOM:
+            // Bottom edge: shift down and expand height
+            positionDelta += Vec2(0, -20);
+            dimensionDelta += Vec2(0, 10);
+            break;
+        }
+    }
+
+    g_windowSubsystem->RequestWindowGrowth(windowID, positionDelta, dimensionDelta, 0.1f);
+}
+
+//----------------------------------------------------------------------------------------------------
+// SeparateEnemies - Runs after every enemy has moved, so the push acts on this frame's positions.
+// Windows catch up on the enemy's next Update(), like any other position change.
+//----------------------------------------------------------------------------------------------------
+void Game::SeparateEnemies(float const deltaSeconds)
+{
+    m_crowdSeparation->Clear();
+    m_separationAgents.clear();
+
+    for (Entity* entity : m_entityList)
+    {
+        if (entity == nullptr || entity->IsDead() || !IsEnemy(entity)) continue;
+
+        m_crowdSeparation->AddAgent(entity->m_position, entity->m_physicRadius);
+        m_separationAgents.push_back(entity);
+    }
+
+    m_crowdSeparation->Solve(AABB2(Vec2::ZERO, Window::s_mainWindow->GetScreenDimensions()), deltaSeconds);
+
+    for (int i = 0; i < static_cast<int>(m_separationAgents.size()); ++i)
+    {
+        m_separationAgents[i]->m_position += m_crowdSeparation->GetDisplacement(i);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// FlushSpawnQueue - Runs what fits in this frame's spawn budget; the rest waits for the next frame
+//----------------------------------------------------------------------------------------------------
+void Game::FlushSpawnQueue()
+{
+    sSpawnCommand command;
+
+    m_spawnQueue->BeginFlush();
+
+    while (m_spawnQueue->BeginCommand(command))
+    {
+        ExecuteSpawnCommand(command);
+        m_spawnQueue->EndCommand();
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::AdjustForPauseAndTimeDistortion() const
 {
@@ -549,7 +767,7 @@ void Game::AdjustForPauseAndTimeDistortion() const
 //----------------------------------------------------------------------------------------------------
 void Game::RenderAttractMode() const
 {
-    VertexList_PCU verts1;
+    VertexList_PCU& verts1 = g_frameArena->AcquireVertexList();
     AddVertsForAABB2D(verts1, AABB2(Vec2::ZERO, Window::s_mainWindow->GetScreenDimensions()));
     g_renderer->SetModelConstants(Mat44{}, Rgba8(255, 255, 255, 100));
     g_renderer->SetBlendMode(eBlendMode::ALPHA);
@@ -571,19 +789,27 @@ void Game::RenderAttractMode() const
     DebugAddScreenText(Stringf("Viewport Dimensions(%.1f, %.1f)", Window::s_mainWindow->GetViewportDimensions().x, Window::s_mainWindow->GetViewportDimensions().y), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0, 80), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
     DebugAddScreenText(Stringf("Screen Dimensions(%.1f, %.1f)", Window::s_mainWindow->GetScreenDimensions().x, Window::s_mainWindow->GetScreenDimensions().y), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0, 100), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
 
-    for (Entity* entity : m_entityList)
+    VertexList_PCU& verts2 = g_frameArena->AcquireVertexList();
+    Vec2            offset = Vec2((1445 * 0.5f), (248 * 0.5f));
+    Player*         player = GetPlayer();
+    if (player != nullptr)
     {
-        if (entity && !entity->IsDead() && entity->m_name == "You")
+        // Render prep does not run on the attract screen, so the player's shape is drawn here
+        sRenderShape playerShape;
+        if (!player->IsDead() && player->GetRenderShape(playerShape))
         {
-            entity->Render();
+            VertexList_PCU& playerVerts = g_frameArena->AcquireVertexList();
+            AddVertsForRenderShape(playerVerts, playerShape);
+            g_renderer->SetModelConstants();
+            g_renderer->SetBlendMode(eBlendMode::OPAQUE);
+            g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+            g_renderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
+            g_renderer->SetDepthMode(eDepthMode::DISABLED);
+            g_renderer->BindTexture(nullptr);
+            g_renderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
+            g_renderer->DrawVertexArray(playerVerts);
         }
-    }
 
-    VertexList_PCU verts2;
-    Vec2           offset = Vec2((1445 * 0.5f), (248 * 0.5f));
-    Player*        player = GetPlayer();
-    if (player != nullptr)
-    {
         AddVertsForAABB2D(verts2, AABB2(Vec2(player->m_position - offset * 0.5f), Vec2(player->m_position + offset * 0.5f)));
         g_renderer->SetModelConstants(Mat44{}, Rgba8(255, 255, 255, 100));
         g_renderer->SetBlendMode(eBlendMode::ALPHA);
@@ -594,10 +820,12 @@ void Game::RenderAttractMode() const
         g_renderer->BindShader(nullptr);
         g_renderer->DrawVertexArray(verts2);
 
-        VertexList_PCU verts3;
-        Vec2           offset2    = Vec2(0, -80);
-        BitmapFont*    bitmapFont = g_resourceSubsystem->CreateOrGetBitmapFontFromFile("Data/Fonts/DaemonFont");
-        bitmapFont->AddVertsForTextInBox2D(verts3, Stringf("Press Space to Start\nWASD to move, LMB to shoot"), AABB2(Vec2(player->m_position - offset * 0.5f) + offset2, Vec2(player->m_position + offset * 0.5f) + offset2), 20.f, Rgba8::WHITE, 1.f, Vec2(0.5, 0.5f), eTextBoxMode::OVERRUN);
+        static String const attractPromptText = "Press Space to Start\nWASD to move, LMB to shoot";
+
+        VertexList_PCU& verts3 = g_frameArena->AcquireVertexList();
+        Vec2            offset2    = Vec2(0, -80);
+        BitmapFont*     bitmapFont = g_resourceSubsystem->CreateOrGetBitmapFontFromFile("Data/Fonts/DaemonFont");
+        bitmapFont->AddVertsForTextInBox2D(verts3, attractPromptText, AABB2(Vec2(player->m_position - offset * 0.5f) + offset2, Vec2(player->m_position + offset * 0.5f) + offset2), 20.f, Rgba8::WHITE, 1.f, Vec2(0.5, 0.5f), eTextBoxMode::OVERRUN);
 
         g_renderer->SetBlendMode(eBlendMode::ALPHA);
         g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
@@ -612,7 +840,7 @@ void Game::RenderAttractMode() const
 //----------------------------------------------------------------------------------------------------
 void Game::RenderGame() const
 {
-    VertexList_PCU verts1;
+    VertexList_PCU& verts1 = g_frameArena->AcquireVertexList();
     AddVertsForAABB2D(verts1, AABB2(Vec2::ZERO, Window::s_mainWindow->GetScreenDimensions()));
     g_renderer->SetModelConstants(Mat44{}, Rgba8(255, 255, 255, 100));
     g_renderer->SetBlendMode(eBlendMode::ALPHA);
@@ -623,31 +851,136 @@ void Game::RenderGame() const
     g_renderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
     g_renderer->DrawVertexArray(verts1);
 
-    for (Entity* entity : m_entityList)
+    // Entities without a render shape still draw themselves, underneath the prepared batch
+    for (Entity const* entity : m_unshapedEntities)
     {
-        if (entity && !entity->IsDead() && entity->IsChildWindowVisible())
-        {
-            entity->Render();
-        }
+        uint64_t const sampleStart = m_entityCostTracker->BeginSample();
+        entity->Render();
+        m_entityCostTracker->EndSample(*entity, eEntityCostPhase::RENDER, sampleStart);
     }
 
+    // Everything else was culled and turned into vertices by render prep, one draw call
+    g_renderPipeline->Submit();
+    m_entityCostTracker->AddRenderPrepCosts(g_renderPipeline->GetSubmittedPrepCosts());
+
     DebugAddScreenText(Stringf("Time: %.2f\nFPS: %.2f\nScale: %.1f", m_gameClock->GetTotalSeconds(), 1.f / m_gameClock->GetDeltaSeconds(), m_gameClock->GetTimeScale()), m_screenCamera->GetOrthographicTopRight() - Vec2(200.f, 60.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
     DebugAddScreenText(Stringf("Time: %.2f\nFPS: %.2f\nScale: %.1f", m_gameClock->GetTotalSeconds(), 1.f / m_gameClock->GetDeltaSeconds(), m_gameClock->GetTimeScale()), m_screenCamera->GetOrthographicBottomLeft(), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+
+    if (m_isStatsOverlayVisible)
+    {
+        RenderStatsOverlay();
+    }
+
+    if (m_isMemoryOverlayVisible)
+    {
+        RenderMemoryOverlay();
+    }
+
+    if (m_isEntityCostOverlayVisible)
+    {
+        RenderEntityCostOverlay();
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
-Triangle* Game::SpawnTriangle()
+// RenderStatsOverlay - Per-subsystem counters above the clock, bottom-left, toggled with I. Every line
+// is a Stringf the engine copies, so they stay off unless someone is looking at them.
+//----------------------------------------------------------------------------------------------------
+void Game::RenderStatsOverlay() const
 {
-    Vec2 const randomPos  = EnemyUtils::GetRandomSpawnPosition(Window::s_mainWindow->GetScreenDimensions());
-    int const  randomType = g_rng->RollRandomIntInRange(0, 1);
+    DebugAddScreenText(Stringf("Window Lookups: %zu OS Calls: %zu Geometry Commits: %zu", g_windowSubsystem->GetLookupCountLastFrame(), g_windowSubsystem->GetOSCallCountLastFrame(), g_windowSubsystem->GetGeometryCommitCountLastFrame()), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 60.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("Readback KB: %.1f Skipped Presents: %zu", static_cast<float>(g_windowSubsystem->GetReadbackBytesLastFrame()) / 1024.f, g_windowSubsystem->GetSkippedPresentCountLastFrame()), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 80.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("Entities Rendered: %d Culled: %d Total: %zu Verts: %zu Coin Stacks: %d Projectiles: %d", g_renderPipeline->GetRenderedEntityCount(), g_renderPipeline->GetCulledEntityCount(), m_entityList.size(), g_renderPipeline->GetVertexCount(), m_coinField->GetStackCount(), m_projectileSystem->GetProjectileCount()), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 100.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("Rewind: %zu/%zu snapshots (%.1f KB) Capture: %.0f us Restore: %.0f us%s", m_rewindBuffer->GetSnapshotCount(), m_rewindBuffer->GetCapacity(), static_cast<float>(m_rewindBuffer->GetStoredByteCount()) / 1024.f, m_lastCaptureMicroseconds, m_lastRestoreMicroseconds, m_isRewinding ? " REWINDING" : ""), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 140.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("Render Prep: %.2f ms Latency: %.2f ms (%llu frames) Overlapped: %.0f%%", g_renderPipeline->GetPrepMilliseconds(), g_renderPipeline->GetLatencyMilliseconds(), static_cast<unsigned long long>(g_renderPipeline->GetLatencyFrames()), g_renderPipeline->GetOverlappedPrepFraction() * 100.f), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 160.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("AI LOD: %s Thinks: %d Extrapolated: %d Deferred: %d Tiers: %d/%d/%d/%d AI: %.2f ms (budget %.1f)", m_aiScheduler->IsEnabled() ? "on" : "off", m_aiScheduler->GetThinkCount(), m_aiScheduler->GetExtrapolatedCount(), m_aiScheduler->GetDeferredCount(), m_aiScheduler->GetLodCount(eAILod::FULL), m_aiScheduler->GetLodCount(eAILod::HALF), m_aiScheduler->GetLodCount(eAILod::QUARTER), m_aiScheduler->GetLodCount(eAILod::HIDDEN), m_aiScheduler->GetThinkMilliseconds(), m_aiScheduler->GetBudgetMilliseconds()), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 180.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("Separation: %d agents Neighbours: %d Capped: %d Solve: %.2f ms", m_crowdSeparation->GetAgentCount(), m_crowdSeparation->GetNeighborCount(), m_crowdSeparation->GetCappedAgentCount(), m_crowdSeparation->GetSolveMilliseconds()), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 200.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("Spawn Queue: %s Pending: %d (%d/%d/%d) Peak: %d Ran: %d Worst: %.0f us Flush: %.0f us (budget %.0f)", m_spawnQueue->IsEnabled() ? "on" : "off", m_spawnQueue->GetPendingCount(), m_spawnQueue->GetPendingCount(eSpawnPriority::IMMEDIATE), m_spawnQueue->GetPendingCount(eSpawnPriority::GAMEPLAY), m_spawnQueue->GetPendingCount(eSpawnPriority::COSMETIC), m_spawnQueue->GetPeakPendingCount(), m_spawnQueue->GetExecutedCount(), m_spawnQueue->GetWorstCommandMicroseconds(), m_spawnQueue->GetFlushMicroseconds(), m_spawnQueue->GetBudgetMicroseconds()), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 220.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("Entity Cost: %s %.2f ms (update + render) Types: %zu", m_entityCostTracker->IsEnabled() ? "on" : "off", m_entityCostTracker->GetLastFrameMilliseconds(), m_entityCostTracker->GetSortedRowIndices().size()), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 240.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("Wave Start: precompute %s Worst Frame: %.2f ms (wave %d%s)", m_waveManager->IsPrecomputeEnabled() ? "on" : "off", m_waveManager->GetWaveStartWorstFrameSeconds() * 1000.f, m_waveManager->GetCurrentWaveNumber(), m_waveManager->IsMeasuringWaveStart() ? ", measuring" : ""), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 260.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("Frame Arena KB: %.1f Vertex Lists: %zu Overflows: %zu Heap Allocs: %s", static_cast<float>(g_frameArena->GetBytesUsedLastFrame()) / 1024.f, g_frameArena->GetVertexListCountLastFrame(), g_frameArena->GetOverflowCountLastFrame(), FrameArena::IS_COUNTING_HEAP_ALLOCATIONS ? Stringf("%zu", g_frameArena->GetHeapAllocationCountLastFrame()).c_str() : "not counted"), m_screenCamera->GetOrthographicBottomLeft() + Vec2(0.f, 120.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+}
+
+//----------------------------------------------------------------------------------------------------
+// RenderMemoryOverlay - One line per memory tag, top-left, toggled with M
+//----------------------------------------------------------------------------------------------------
+void Game::RenderMemoryOverlay() const
+{
+    Vec2 const topLeft = Vec2(m_screenCamera->GetOrthographicBottomLeft().x, m_screenCamera->GetOrthographicTopRight().y);
+
+    for (size_t i = 0; i < static_cast<size_t>(eMemoryTag::COUNT); ++i)
+    {
+        eMemoryTag const      tag   = static_cast<eMemoryTag>(i);
+        sMemoryTagStats const stats = MemoryTracker::GetStats(tag);
+
+        DebugAddScreenText(Stringf("%-10s Live KB: %9.1f Allocs: %6zu (total %8zu) Peak KB: %9.1f", MemoryTracker::GetTagName(tag), static_cast<float>(stats.m_liveBytes) / 1024.f, stats.m_liveAllocationCount, stats.m_totalAllocationCount, static_cast<float>(stats.m_highWaterBytes) / 1024.f), topLeft - Vec2(0.f, 20.f * static_cast<float>(i + 1)), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// RenderEntityCostOverlay - Most expensive entity types first, top-left under the memory overlay, toggled with C
+//----------------------------------------------------------------------------------------------------
+void Game::RenderEntityCostOverlay() const
+{
+    Vec2 const topLeft  = Vec2(m_screenCamera->GetOrthographicBottomLeft().x, m_screenCamera->GetOrthographicTopRight().y);
+    float      rowY     = 20.f * static_cast<float>(static_cast<int>(eMemoryTag::COUNT) + 2);
+    int const  rowCount = (std::min)(static_cast<int>(m_entityCostTracker->GetSortedRowIndices().size()), 12);
+
+    DebugAddScreenText(Stringf("%-20s %5s %10s %10s %10s %10s", "Entity Type", "Count", "Update ms", "Render ms", "Total ms", "Peak ms"), topLeft - Vec2(0.f, rowY), 20.f, Vec2::ZERO, 0.f, Rgba8::YELLOW, Rgba8::YELLOW);
+
+    for (int i = 0; i < rowCount; ++i)
+    {
+        sEntityCostRow const& row = m_entityCostTracker->GetRow(m_entityCostTracker->GetSortedRowIndices()[i]);
+        rowY += 20.f;
+
+        DebugAddScreenText(Stringf("%-20s %5d %10.3f %10.3f %10.3f %10.3f", row.m_typeName.c_str(), row.m_lastFrameCount, row.m_averageMilliseconds[static_cast<int>(eEntityCostPhase::UPDATE)], row.m_averageMilliseconds[static_cast<int>(eEntityCostPhase::RENDER)], row.GetAverageTotalMilliseconds(), row.m_peakFrameMilliseconds), topLeft - Vec2(0.f, rowY), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// FillRenderSnapshot - Copies out what render prep needs, at the end of the update, on the main thread
+//----------------------------------------------------------------------------------------------------
+void Game::FillRenderSnapshot(sRenderSnapshot& outSnapshot)
+{
+    outSnapshot.m_screenBounds = AABB2(Vec2::ZERO, Window::s_mainWindow->GetScreenDimensions());
+    m_unshapedEntities.clear();
+
+    if (m_gameState == eGameState::ATTRACT) return;
+
+    // Only pixels inside visible child windows ever reach the screen; the windows follow the batch
+    g_windowSubsystem->GetVisibleClientRects(outSnapshot.m_visibleWindowRects);
+    g_windowSubsystem->GetWindowGeometry(outSnapshot.m_windowGeometry);
+
+    for (Entity* entity : m_entityList)
+    {
+        if (entity == nullptr || entity->IsDead() || !entity->IsChildWindowVisible()) continue;
 
+        sRenderShape shape;
+        if (entity->GetRenderShape(shape))
+        {
+            shape.m_costRowIndex = static_cast<int16_t>(m_entityCostTracker->GetRowIndex(*entity));     // Render prep times the shape there
+            outSnapshot.m_shapes.push_back(shape);
+        }
+        else
+        {
+            m_unshapedEntities.push_back(entity);
+        }
+    }
+
+    m_coinField->AppendRenderShapes(outSnapshot.m_shapes);
+    m_projectileSystem->AppendRenderShapes(outSnapshot.m_shapes);
+}
+
+//----------------------------------------------------------------------------------------------------
+Triangle* Game::SpawnTriangle(Vec2 const& position, bool const hasChildWindow)
+{
     Triangle* triangle = new Triangle(
         s_nextEntityID++,
-        randomPos,
+        position,
         0.f,
         Rgba8::BLUE,
         true,
-        randomType
+        hasChildWindow
     );
 
     m_entityList.push_back(triangle);
@@ -655,18 +988,15 @@ Triangle* Game::SpawnTriangle()
 }
 
 //----------------------------------------------------------------------------------------------------
-Circle* Game::SpawnCircle()
+Circle* Game::SpawnCircle(Vec2 const& position, bool const hasChildWindow)
 {
-    Vec2 const randomPos  = EnemyUtils::GetRandomSpawnPosition(Window::s_mainWindow->GetScreenDimensions());
-    int const  randomType = g_rng->RollRandomIntInRange(0, 1);
-
     Circle* circle = new Circle(
         s_nextEntityID++,
-        randomPos,
+        position,
         0.f,
         Rgba8::GREEN,
         true,
-        randomType
+        hasChildWindow
     );
 
     m_entityList.push_back(circle);
@@ -674,18 +1004,15 @@ Circle* Game::SpawnCircle()
 }
 
 //----------------------------------------------------------------------------------------------------
-Octagon* Game::SpawnOctagon()
+Octagon* Game::SpawnOctagon(Vec2 const& position, bool const hasChildWindow)
 {
-    Vec2 const randomPos  = EnemyUtils::GetRandomSpawnPosition(Window::s_mainWindow->GetScreenDimensions());
-    int const  randomType = g_rng->RollRandomIntInRange(0, 1);
-
     Octagon* octagon = new Octagon(
         s_nextEntityID++,
-        randomPos,
+        position,
         0.f,
         Rgba8::MAGENTA,
         true,
-        randomType
+        hasChildWindow
     );
 
     m_entityList.push_back(octagon);
@@ -693,18 +1020,15 @@ Octagon* Game::SpawnOctagon()
 }
 
 //----------------------------------------------------------------------------------------------------
-Square* Game::SpawnSquare()
+Square* Game::SpawnSquare(Vec2 const& position, bool const hasChildWindow)
 {
-    Vec2 const randomPos  = EnemyUtils::GetRandomSpawnPosition(Window::s_mainWindow->GetScreenDimensions());
-    int const  randomType = g_rng->RollRandomIntInRange(0, 1);
-
     Square* square = new Square(
         s_nextEntityID++,
-        randomPos,
+        position,
         0.f,
         Rgba8::ORANGE,
         true,
-        randomType
+        hasChildWindow
     );
 
     m_entityList.push_back(square);
@@ -712,18 +1036,15 @@ Square* Game::SpawnSquare()
 }
 
 //----------------------------------------------------------------------------------------------------
-Pentagon* Game::SpawnPentagon()
+Pentagon* Game::SpawnPentagon(Vec2 const& position, bool const hasChildWindow)
 {
-    Vec2 const randomPos  = EnemyUtils::GetRandomSpawnPosition(Window::s_mainWindow->GetScreenDimensions());
-    int const  randomType = g_rng->RollRandomIntInRange(0, 1);
-
     Pentagon* pentagon = new Pentagon(
         s_nextEntityID++,
-        randomPos,
+        position,
         0.f,
         Rgba8::CYAN,
         true,
-        randomType
+        hasChildWindow
     );
 
     m_entityList.push_back(pentagon);
@@ -731,18 +1052,15 @@ Pentagon* Game::SpawnPentagon()
 }
 
 //----------------------------------------------------------------------------------------------------
-Hexagon* Game::SpawnHexagon()
+Hexagon* Game::SpawnHexagon(Vec2 const& position, bool const hasChildWindow)
 {
-    Vec2 const randomPos  = EnemyUtils::GetRandomSpawnPosition(Window::s_mainWindow->GetScreenDimensions());
-    int const  randomType = g_rng->RollRandomIntInRange(0, 1);
-
     Hexagon* hexagon = new Hexagon(
         s_nextEntityID++,
-        randomPos,
+        position,
         0.f,
         Rgba8(220, 50, 50, 255),  // dark red - distinct from Player's yellow
         true,
-        randomType,
+        hasChildWindow,
         true    // large hexagon can split
     );
 
@@ -750,6 +1068,23 @@ Hexagon* Game::SpawnHexagon()
     return hexagon;
 }
 
+//----------------------------------------------------------------------------------------------------
+Hexagon* Game::SpawnSplitHexagon(Vec2 const& position, bool const hasChildWindow)
+{
+    Hexagon* hexagon = new Hexagon(
+        s_nextEntityID++,
+        position,
+        0.f,
+        Rgba8(255, 100, 80, 255),  // lighter red - distinguishes split children from parent
+        true,
+        hasChildWindow,
+        false    // small hexagons cannot split
+    );
+
+    m_entityList.push_back(hexagon);
+    return hexagon;
+}
+
 //----------------------------------------------------------------------------------------------------
 // SpawnEntity - Uses WaveManager to select a random enemy type based on spawn weights,
 // then delegates to SpawnEnemyByType(). Falls back to spawning one of each type if
@@ -765,12 +1100,12 @@ void Game::SpawnEntity()
     else
     {
         // Fallback: spawn one of each (legacy behavior)
-        SpawnTriangle();
-        SpawnCircle();
-        SpawnOctagon();
-        SpawnSquare();
-        SpawnPentagon();
-        SpawnHexagon();
+        SpawnEnemyByType(eEnemyType::TRIANGLE);
+        SpawnEnemyByType(eEnemyType::CIRCLE);
+        SpawnEnemyByType(eEnemyType::OCTAGON);
+        SpawnEnemyByType(eEnemyType::SQUARE);
+        SpawnEnemyByType(eEnemyType::PENTAGON);
+        SpawnEnemyByType(eEnemyType::HEXAGON);
     }
 }
 
@@ -778,21 +1113,81 @@ void Game::SpawnEntity()
 // SpawnEnemyByType - Factory method that spawns the correct enemy class based on eEnemyType
 //----------------------------------------------------------------------------------------------------
 Entity* Game::SpawnEnemyByType(eEnemyType enemyType)
+{
+    Vec2 const randomPos  = EnemyUtils::GetRandomSpawnPosition(Window::s_mainWindow->GetScreenDimensions());
+    int const  randomType = g_rng->RollRandomIntInRange(0, 1);
+
+    return SpawnEnemyByType(enemyType, randomPos, randomType != 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+// SpawnEnemyByType - Spawns with a position / window choice rolled ahead of time (WaveManager precompute)
+//----------------------------------------------------------------------------------------------------
+Entity* Game::SpawnEnemyByType(eEnemyType const enemyType, Vec2 const& position, bool const hasChildWindow)
 {
     switch (enemyType)
     {
-    case eEnemyType::TRIANGLE:  return SpawnTriangle();
-    case eEnemyType::CIRCLE:    return SpawnCircle();
-    case eEnemyType::OCTAGON:   return SpawnOctagon();
-    case eEnemyType::SQUARE:    return SpawnSquare();
-    case eEnemyType::PENTAGON:  return SpawnPentagon();
-    case eEnemyType::HEXAGON:   return SpawnHexagon();
+    case eEnemyType::TRIANGLE:  return SpawnTriangle(position, hasChildWindow);
+    case eEnemyType::CIRCLE:    return SpawnCircle(position, hasChildWindow);
+    case eEnemyType::OCTAGON:   return SpawnOctagon(position, hasChildWindow);
+    case eEnemyType::SQUARE:    return SpawnSquare(position, hasChildWindow);
+    case eEnemyType::PENTAGON:  return SpawnPentagon(position, hasChildWindow);
+    case eEnemyType::HEXAGON:   return SpawnHexagon(position, hasChildWindow);
     default:
         DebuggerPrintf("SpawnEnemyByType: Unknown enemy type %d, falling back to Triangle.\n", static_cast<int>(enemyType));
-        return SpawnTriangle();
+        return SpawnTriangle(position, hasChildWindow);
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+// QueueEnemySpawn - Window-less enemies are gameplay; the window and widget of the rest are the
+// expensive part and wait behind them
+//----------------------------------------------------------------------------------------------------
+void Game::QueueEnemySpawn(eEnemyType const enemyType, Vec2 const& position, bool const hasChildWindow)
+{
+    sSpawnCommand command;
+    command.m_type           = eSpawnCommandType::ENEMY;
+    command.m_priority       = hasChildWindow ? eSpawnPriority::COSMETIC : eSpawnPriority::GAMEPLAY;
+    command.m_hasChildWindow = hasChildWindow;
+    command.m_enemyType      = enemyType;
+    command.m_position       = position;
+
+    m_spawnQueue->Enqueue(command);
+}
+
+//----------------------------------------------------------------------------------------------------
+// QueueSplitHexagon - The player just watched the parent die there, so children skip the budget
+// unless they bring a window
+//----------------------------------------------------------------------------------------------------
+void Game::QueueSplitHexagon(Vec2 const& position, bool const hasChildWindow)
+{
+    sSpawnCommand command;
+    command.m_type           = eSpawnCommandType::SPLIT_HEXAGON;
+    command.m_priority       = hasChildWindow ? eSpawnPriority::GAMEPLAY : eSpawnPriority::IMMEDIATE;
+    command.m_hasChildWindow = hasChildWindow;
+    command.m_enemyType      = eEnemyType::HEXAGON;
+    command.m_position       = position;
+
+    m_spawnQueue->Enqueue(command);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::ExecuteSpawnCommand(sSpawnCommand const& command)
+{
+    switch (command.m_type)
+    {
+    case eSpawnCommandType::ENEMY:         SpawnEnemyByType(command.m_enemyType, command.m_position, command.m_hasChildWindow); break;
+    case eSpawnCommandType::SPLIT_HEXAGON: SpawnSplitHexagon(command.m_position, command.m_hasChildWindow); break;
+    default:                               break;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::ReserveEntityStorage(size_t const additionalEntityCount)
+{
+    m_entityList.reserve(m_entityList.size() + additionalEntityCount);
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::DestroyEntity()
 {
@@ -803,6 +1198,11 @@ void Game::DestroyEntity()
         if (entity->m_name == "Shop") continue;
         entity->MarkAsDead();
     }
+
+    // Also drops the split children the loop above just queued
+    m_spawnQueue->Clear();
+    m_coinField->Clear();
+    m_projectileSystem->Clear();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -836,3 +1236,355 @@ void Game::SpawnShop()
 {
     m_entityList.push_back(new Shop(s_nextEntityID++, Window::s_mainWindow->GetScreenDimensions() * 0.5f, 0.f, Rgba8::BLACK, true, true));
 }
+
+//----------------------------------------------------------------------------------------------------
+// Snapshot layout
+// Header, wave / upgrade / coin / projectile state, then one record per live entity in list order.
+// The RNG is stored raw so the spawns rolled after a restore match the ones rolled the first time.
+//----------------------------------------------------------------------------------------------------
+static uint32_t const SNAPSHOT_MAGIC   = 0x50414E53;     // "SNAP"
+static uint32_t const SNAPSHOT_VERSION = 3;     // 3: subsystems and entities in length-prefixed sections, headers field by field
+
+static_assert(std::is_trivially_copyable_v<RandomNumberGenerator>, "The RNG state is snapshotted bit for bit");
+
+//----------------------------------------------------------------------------------------------------
+enum class eSnapshotEntityKind : uint8_t
+{
+    PLAYER,
+    SHOP,
+    ENEMY,
+};
+
+//----------------------------------------------------------------------------------------------------
+// Written and read one field at a time, so padding never reaches the buffer and a corrupt kind or type
+// byte is rejected instead of landing in an enum or a bool
+//----------------------------------------------------------------------------------------------------
+struct sSnapshotEntityHeader
+{
+    EntityID            m_entityID       = 0;
+    eSnapshotEntityKind m_kind           = eSnapshotEntityKind::ENEMY;
+    uint8_t             m_enemyType      = 0;
+    bool                m_hasChildWindow = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+static void WriteSnapshotEntityHeader(SnapshotWriter& writer, sSnapshotEntityHeader const& header)
+{
+    writer.Write(header.m_entityID);
+    writer.Write(static_cast<uint8_t>(header.m_kind));
+    writer.Write(header.m_enemyType);
+    writer.Write(static_cast<uint8_t>(header.m_hasChildWindow ? 1 : 0));
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ReadSnapshotEntityHeader(SnapshotReader& reader, sSnapshotEntityHeader& outHeader)
+{
+    uint8_t kind           = 0;
+    uint8_t hasChildWindow = 0;
+
+    reader.Read(outHeader.m_entityID);
+    reader.Read(kind);
+    reader.Read(outHeader.m_enemyType);
+    reader.Read(hasChildWindow);
+
+    if (!reader.IsValid()) return false;
+    if (kind > static_cast<uint8_t>(eSnapshotEntityKind::ENEMY) || hasChildWindow > 1) return false;
+    if (kind == static_cast<uint8_t>(eSnapshotEntityKind::ENEMY) && outHeader.m_enemyType >= static_cast<uint8_t>(eEnemyType::NUM_ENEMY_TYPES)) return false;
+
+    outHeader.m_kind           = static_cast<eSnapshotEntityKind>(kind);
+    outHeader.m_hasChildWindow = hasChildWindow == 1;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+static void WriteSnapshotSection(SnapshotWriter& writer, T const& owner)
+{
+    size_t const section = writer.BeginSection();
+    owner.WriteSnapshot(writer);
+    writer.EndSection(section);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Returns false if the owner did not read exactly the section's bytes (a writer/reader mismatch)
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+static bool ReadSnapshotSection(SnapshotReader& reader, T& owner)
+{
+    SnapshotReader section = reader.ReadSection();
+    owner.ReadSnapshot(section);
+    return section.IsValid() && section.IsAtEnd();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Snapshot layout: magic, version, game scalars, SNAPSHOT_SUBSYSTEM_SECTION_COUNT subsystem sections,
+// entity count, then per entity a header and a section. IsSnapshotLayoutValid walks all of it without
+// touching the game, so RestoreSnapshot can reject a bad buffer before it changes anything.
+//----------------------------------------------------------------------------------------------------
+static int const SNAPSHOT_SUBSYSTEM_SECTION_COUNT = 5;     // Waves, upgrades, coins, projectiles, spawn queue
+
+static bool IsSnapshotLayoutValid(std::vector<uint8_t> const& buffer)
+{
+    SnapshotReader reader(buffer.data(), buffer.size());
+
+    uint32_t              magic         = 0;
+    uint32_t              version       = 0;
+    int                   nextEntityID  = 0;
+    float                 spawnTimer    = 0.f;
+    float                 spawnInterval = 0.f;
+    RandomNumberGenerator rng;
+    reader.Read(magic);
+    reader.Read(version);
+    reader.Read(nextEntityID);
+    reader.Read(spawnTimer);
+    reader.Read(spawnInterval);
+    reader.Read(rng);
+
+    if (!reader.IsValid() || magic != SNAPSHOT_MAGIC || version != SNAPSHOT_VERSION) return false;
+
+    for (int i = 0; i < SNAPSHOT_SUBSYSTEM_SECTION_COUNT; ++i)
+    {
+        reader.ReadSection();
+    }
+
+    uint32_t entityCount = 0;
+    reader.Read(entityCount);
+
+    for (uint32_t i = 0; i < entityCount && reader.IsValid(); ++i)
+    {
+        sSnapshotEntityHeader header;
+        if (!ReadSnapshotEntityHeader(reader, header)) return false;
+        reader.ReadSection();
+    }
+
+    return reader.IsValid() && reader.IsAtEnd();
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool TryGetSnapshotEntityKind(Entity const* entity, eSnapshotEntityKind& outKind, eEnemyType& outEnemyType)
+{
+    String const& name = entity->m_name;
+
+    if (name == "You")
+    {
+        outKind = eSnapshotEntityKind::PLAYER;
+        return true;
+    }
+    if (name == "Shop")
+    {
+        outKind = eSnapshotEntityKind::SHOP;
+        return true;
+    }
+
+    outKind = eSnapshotEntityKind::ENEMY;
+
+    if (name == "Triangle") outEnemyType = eEnemyType::TRIANGLE;
+    else if (name == "Circle") outEnemyType = eEnemyType::CIRCLE;
+    else if (name == "Octagon") outEnemyType = eEnemyType::OCTAGON;
+    else if (name == "Square") outEnemyType = eEnemyType::SQUARE;
+    else if (name == "Pentagon") outEnemyType = eEnemyType::PENTAGON;
+    else if (name == "Hexagon") outEnemyType = eEnemyType::HEXAGON;
+    else return false;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// CaptureSnapshot - Overwrites outBuffer; its capacity is kept, so ring slots stop allocating once warm
+//----------------------------------------------------------------------------------------------------
+void Game::CaptureSnapshot(std::vector<uint8_t>& outBuffer)
+{
+    auto const startTime = std::chrono::steady_clock::now();
+
+    SnapshotWriter writer(outBuffer);
+    writer.Write(SNAPSHOT_MAGIC);
+    writer.Write(SNAPSHOT_VERSION);
+    writer.Write(s_nextEntityID);
+    writer.Write(m_spawnTimer);
+    writer.Write(m_spawnInterval);
+    writer.Write(*g_rng);
+
+    WriteSnapshotSection(writer, *m_waveManager);
+    WriteSnapshotSection(writer, *m_upgradeManager);
+    WriteSnapshotSection(writer, *m_coinField);
+    WriteSnapshotSection(writer, *m_projectileSystem);
+    WriteSnapshotSection(writer, *m_spawnQueue);
+
+    // Entities the snapshot cannot respawn (none today) are left out rather than restored as the wrong type
+    sSnapshotEntityHeader header;
+    eEnemyType            enemyType   = eEnemyType::TRIANGLE;
+    uint32_t              entityCount = 0;
+
+    for (Entity const* entity : m_entityList)
+    {
+        if (entity == nullptr || entity->IsDead()) continue;
+        if (TryGetSnapshotEntityKind(entity, header.m_kind, enemyType)) ++entityCount;
+    }
+    writer.Write(entityCount);
+
+    for (Entity const* entity : m_entityList)
+    {
+        if (entity == nullptr || entity->IsDead()) continue;
+        if (!TryGetSnapshotEntityKind(entity, header.m_kind, enemyType)) continue;
+
+        header.m_entityID       = entity->m_entityID;
+        header.m_enemyType      = static_cast<uint8_t>(enemyType);
+        header.m_hasChildWindow = entity->HasChildWindow();
+
+        WriteSnapshotEntityHeader(writer, header);
+        WriteSnapshotSection(writer, *entity);
+    }
+
+    m_lastCaptureMicroseconds = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+// RestoreSnapshot - Entities that still exist are overwritten in place, missing ones are respawned under
+// their old ID, and entities born after the capture are deleted without dying (no coins, no events).
+// Returns false, touching nothing, if the buffer is not a well-formed snapshot from this build.
+//----------------------------------------------------------------------------------------------------
+bool Game::RestoreSnapshot(std::vector<uint8_t> const& buffer)
+{
+    auto const startTime = std::chrono::steady_clock::now();
+
+    // Every length, count and header is checked before the first write to the game
+    if (!IsSnapshotLayoutValid(buffer))
+    {
+        DebuggerPrintf("RestoreSnapshot: Rejected a truncated or foreign snapshot (%zu bytes).\n", buffer.size());
+        return false;
+    }
+
+    SnapshotReader reader(buffer.data(), buffer.size());
+
+    uint32_t              magic        = 0;
+    uint32_t              version      = 0;
+    int                   nextEntityID = 0;
+    RandomNumberGenerator rng;
+    reader.Read(magic);
+    reader.Read(version);
+    reader.Read(nextEntityID);
+    reader.Read(m_spawnTimer);
+    reader.Read(m_spawnInterval);
+    reader.Read(rng);
+
+    // A section read that does not line up is a writer/reader mismatch in this build, not a bad buffer
+    bool areSectionsConsistent = true;
+    areSectionsConsistent &= ReadSnapshotSection(reader, *m_waveManager);
+    areSectionsConsistent &= ReadSnapshotSection(reader, *m_upgradeManager);
+    areSectionsConsistent &= ReadSnapshotSection(reader, *m_coinField);
+    areSectionsConsistent &= ReadSnapshotSection(reader, *m_projectileSystem);
+    areSectionsConsistent &= ReadSnapshotSection(reader, *m_spawnQueue);
+
+    // Dead entities have already given up their windows, so they are respawned rather than revived
+    m_restoreLookup.clear();
+    for (Entity*& entity : m_entityList)
+    {
+        if (entity == nullptr) continue;
+
+        if (entity->IsDead())
+        {
+            delete entity;
+            entity = nullptr;
+            continue;
+        }
+
+        m_restoreLookup[entity->m_entityID] = entity;
+    }
+
+    uint32_t entityCount = 0;
+    reader.Read(entityCount);
+
+    m_restoreOrder.clear();
+    m_restoreOrder.reserve(entityCount);
+
+    for (uint32_t i = 0; i < entityCount; ++i)
+    {
+        sSnapshotEntityHeader header;
+        ReadSnapshotEntityHeader(reader, header);
+
+        Entity* entity = nullptr;
+
+        auto const found = m_restoreLookup.find(header.m_entityID);
+        if (found != m_restoreLookup.end())
+        {
+            entity = found->second;
+            m_restoreLookup.erase(found);
+        }
+        else
+        {
+            // The spawn helpers hand out s_nextEntityID++, so point it at the recorded ID first
+            s_nextEntityID = static_cast<int>(header.m_entityID);
+
+            switch (header.m_kind)
+            {
+            case eSnapshotEntityKind::PLAYER: SpawnPlayer(); entity = m_entityList.back(); break;
+            case eSnapshotEntityKind::SHOP:   SpawnShop();   entity = m_entityList.back(); break;
+            case eSnapshotEntityKind::ENEMY:  entity = SpawnEnemyByType(static_cast<eEnemyType>(header.m_enemyType), Vec2::ZERO, header.m_hasChildWindow); break;
+            }
+        }
+
+        areSectionsConsistent &= ReadSnapshotSection(reader, *entity);
+        m_restoreOrder.push_back(entity);
+    }
+
+    // Whatever is left in the lookup was spawned after the capture
+    for (auto const& [entityID, entity] : m_restoreLookup)
+    {
+        delete entity;
+    }
+    m_restoreLookup.clear();
+
+    m_entityList.swap(m_restoreOrder);
+    m_restoreOrder.clear();
+
+    s_nextEntityID = nextEntityID;
+    *g_rng         = rng;
+
+    // The player's labels only change on hit / pickup events; bring them in line with the restored
+    // health and coins before the zero-step update places them in the window
+    Player* player = GetPlayer();
+    if (player != nullptr)
+    {
+        player->RefreshStatusWidgets();
+    }
+
+    if (!areSectionsConsistent)
+    {
+        DebuggerPrintf("RestoreSnapshot: A WriteSnapshot/ReadSnapshot pair disagrees on its section size.\n");
+    }
+
+    m_lastRestoreMicroseconds = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// UpdateRewind - Hold R to step back one capture per frame, Y to restart the current wave
+//----------------------------------------------------------------------------------------------------
+void Game::UpdateRewind()
+{
+    m_isRewinding = false;
+
+    if (m_gameState != eGameState::GAME) return;
+
+    if (g_input->WasKeyJustPressed(KEYCODE_Y) && !m_waveStartSnapshot.empty())
+    {
+        if (RestoreSnapshot(m_waveStartSnapshot))
+        {
+            m_rewindBuffer->Clear();
+            m_isRewinding = true;
+        }
+        return;
+    }
+
+    if (g_input->IsKeyDown(KEYCODE_R))
+    {
+        m_isRewinding = true;
+
+        std::vector<uint8_t> const* snapshot = m_rewindBuffer->PopNewest();
+        if (snapshot != nullptr)
+        {
+            RestoreSnapshot(*snapshot);
+        }
+    }
+}
@@ -5,7 +5,9 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 //----------------------------------------------------------------------------------------------------
+#include "Game/Framework/MemoryTracker.hpp"
 #include "Game/Gameplay/Entity.hpp"
+#include "Game/Gameplay/ProjectileSystem.hpp"
 #include "Game/Gameplay/Shop.hpp"
 #include "Game/Gameplay/WaveManager.hpp"
 //----------------------------------------------------------------------------------------------------
@@ -13,19 +15,25 @@
 #include "Engine/Core/EventSystem.hpp"
 #include "Engine/Core/Timer.hpp"
 //----------------------------------------------------------------------------------------------------
+#include <unordered_map>
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 class Camera;
 class Clock;
 class Player;
-class Bullet;
 class Circle;
 class Hexagon;
 class Octagon;
 class Pentagon;
 class Square;
 class Triangle;
-class Coin;
+class CoinField;
+class CrowdSeparation;
+class EntityCostTracker;
+class RewindBuffer;
+class SpawnQueue;
+struct sRenderSnapshot;
+struct sSpawnCommand;
 class UpgradeManager;
 
 //----------------------------------------------------------------------------------------------------
@@ -40,6 +48,8 @@ enum class eGameState : int8_t
 class Game
 {
 public:
+    GAME_MEMORY_TAG(eMemoryTag::GAME)
+
     //------------------------------------------------------------------------------------------------
     // Construct / Destruct
     //------------------------------------------------------------------------------------------------
@@ -51,6 +61,7 @@ public:
     //------------------------------------------------------------------------------------------------
     void Update();
     void Render() const;
+    void FillRenderSnapshot(sRenderSnapshot& outSnapshot);     // Called by App after Update(), for RenderPipeline
 
     //------------------------------------------------------------------------------------------------
     // Accessors / Mutators
@@ -60,12 +71,19 @@ public:
     Clock*               GetGameClock() const;
     Player*              GetPlayer() const;
     Shop*                GetShop() const;
+    ProjectileSystem*    GetProjectileSystem() const;
     WaveManager*         GetWaveManager() const;
     UpgradeManager*      GetUpgradeManager() const;
+    AIScheduler*         GetAIScheduler() const;
+    SpawnQueue*          GetSpawnQueue() const;
     Entity*              GetEntityByEntityID(EntityID const& entityID) const;
 
-    // Enemy spawning (used by WaveManager)
+    // Enemy spawning (used by WaveManager); Queue* calls run on a later flush, under the SpawnQueue budget
     Entity*              SpawnEnemyByType(eEnemyType enemyType);
+    Entity*              SpawnEnemyByType(eEnemyType enemyType, Vec2 const& position, bool hasChildWindow);
+    void                 QueueEnemySpawn(eEnemyType enemyType, Vec2 const& position, bool hasChildWindow);
+    void                 QueueSplitHexagon(Vec2 const& position, bool hasChildWindow);
+    void                 ReserveEntityStorage(size_t additionalEntityCount);
     static bool          IsEnemy(Entity const* entity);
 
     //------------------------------------------------------------------------------------------------
@@ -91,13 +109,20 @@ private:
     void UpdateFromInput();
     void HandleEntityCollision();
     void FireCollisionEvent(Entity* entityA, Entity* entityB);
-    void HandleBulletEnemyCollision(Bullet* bullet, Entity* enemy);
-    void HandleEnemyBulletPlayerCollision(Bullet* enemyBullet, Player* player);
-    void HandlePlayerCoinCollision(Player* player, Coin* coin);
+    void HandleProjectileCollision();
+    void HandleBulletEnemyCollision(Entity* enemy);
+    void HandleEnemyBulletPlayerCollision(Player* player);
     void HandlePlayerEnemyCollision(Player* player, Entity* enemy);
+    void UpdateCoinField(float deltaSeconds);
+    void UpdateProjectiles(float deltaSeconds);
+    void SeparateEnemies(float deltaSeconds);
+    void FlushSpawnQueue();
     void AdjustForPauseAndTimeDistortion() const;
     void RenderAttractMode() const;
     void RenderGame() const;
+    void RenderStatsOverlay() const;
+    void RenderMemoryOverlay() const;
+    void RenderEntityCostOverlay() const;
 
     //------------------------------------------------------------------------------------------------
     // Entity management
@@ -105,28 +130,69 @@ private:
     void      SpawnPlayer();
     void      SpawnShop();
     void      SpawnEntity();
-    Triangle* SpawnTriangle();
-    Circle*   SpawnCircle();
-    Octagon*  SpawnOctagon();
-    Square*   SpawnSquare();
-    Pentagon* SpawnPentagon();
-    Hexagon*  SpawnHexagon();
+    Triangle* SpawnTriangle(Vec2 const& position, bool hasChildWindow);
+    Circle*   SpawnCircle(Vec2 const& position, bool hasChildWindow);
+    Octagon*  SpawnOctagon(Vec2 const& position, bool hasChildWindow);
+    Square*   SpawnSquare(Vec2 const& position, bool hasChildWindow);
+    Pentagon* SpawnPentagon(Vec2 const& position, bool hasChildWindow);
+    Hexagon*  SpawnHexagon(Vec2 const& position, bool hasChildWindow);
+    Hexagon*  SpawnSplitHexagon(Vec2 const& position, bool hasChildWindow);
+    void      ExecuteSpawnCommand(sSpawnCommand const& command);
     void      DestroyEntity();
     void      ShowShop();
     void      DestroyShop();
 
+    //------------------------------------------------------------------------------------------------
+    // Rewind / instant retry
+    //------------------------------------------------------------------------------------------------
+    void CaptureSnapshot(std::vector<uint8_t>& outBuffer);
+    bool RestoreSnapshot(std::vector<uint8_t> const& buffer);
+    void UpdateRewind();
+
     //------------------------------------------------------------------------------------------------
     // Data members
     //------------------------------------------------------------------------------------------------
-    Camera*      m_screenCamera  = nullptr;
-    eGameState   m_gameState     = eGameState::ATTRACT;
-    Clock*       m_gameClock     = nullptr;
-    WaveManager*    m_waveManager    = nullptr;
-    UpgradeManager* m_upgradeManager = nullptr;
+    Camera*            m_screenCamera      = nullptr;
+    eGameState         m_gameState         = eGameState::ATTRACT;
+    Clock*             m_gameClock         = nullptr;
+    WaveManager*       m_waveManager       = nullptr;
+    UpgradeManager*    m_upgradeManager    = nullptr;
+    CoinField*         m_coinField         = nullptr;     // Dropped coins as SoA value stacks, kept out of m_entityList
+    ProjectileSystem*  m_projectileSystem  = nullptr;     // Every player and enemy bullet, kept out of m_entityList
+    AIScheduler*       m_aiScheduler       = nullptr;     // Enemy AI level of detail, toggled with L
+    CrowdSeparation*   m_crowdSeparation   = nullptr;     // Pushes stacked enemies apart after the AI moved them
+    SpawnQueue*        m_spawnQueue        = nullptr;     // Wave spawns and hexagon splits under a per-frame budget, toggled with B
+    EntityCostTracker* m_entityCostTracker = nullptr;     // Update / render cost per entity type, table toggled with C
+
+    std::vector<AABB2>   m_aiVisibleWindowRects;     // Reused by Update() for the AIScheduler
+    std::vector<Entity*> m_separationAgents;         // Reused by SeparateEnemies, same order as the agents
 
     float m_spawnTimer    = 0.0f;
     float m_spawnInterval = 10.0f;
 
     SoundPlaybackID m_attractPlaybackID;
     SoundPlaybackID m_ingamePlaybackID;
+
+    // Reused every frame by HandleProjectileCollision / UpdateProjectiles
+    std::vector<sProjectileTarget> m_projectileTargets;
+    std::vector<sProjectileHit>    m_projectileHits;
+    std::vector<eProjectileEdge>   m_projectileEdgeHits;
+    EventArgs                      m_collisionEventArgs;     // Reused by FireCollisionEvent
+
+    // Reused every frame by FillRenderSnapshot: the visible entities with no render shape (shop, debris),
+    // which RenderGame still draws through Render()
+    std::vector<Entity*> m_unshapedEntities;
+
+    bool m_isStatsOverlayVisible      = false;
+    bool m_isMemoryOverlayVisible     = false;
+    bool m_isEntityCostOverlayVisible = false;
+
+    // Rewind (hold R) walks back through m_rewindBuffer; instant retry (Y) restores the wave-start capture
+    RewindBuffer*                         m_rewindBuffer = nullptr;
+    std::vector<uint8_t>                  m_waveStartSnapshot;
+    std::unordered_map<EntityID, Entity*> m_restoreLookup;     // Reused by RestoreSnapshot
+    std::vector<Entity*>                  m_restoreOrder;      // Reused by RestoreSnapshot
+    bool                                  m_isRewinding             = false;
+    float                                 m_lastCaptureMicroseconds = 0.f;
+    float                                 m_lastRestoreMicroseconds = 0.f;
 };
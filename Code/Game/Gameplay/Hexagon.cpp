@@ -5,6 +5,9 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Gameplay/Hexagon.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameArena.hpp"
+#include "Game/Framework/RenderSnapshot.hpp"
+#include "Game/Framework/SnapshotStream.hpp"
 #include "Game/Gameplay/EnemyUtils.hpp"
 #include "Game/Gameplay/Game.hpp"
 #include "Game/Gameplay/Player.hpp"
@@ -63,11 +66,10 @@ Hexagon::Hexagon(EntityID const entityID,
 
     if (m_hasChildWindow)
     {
-        g_windowSubsystem->CreateChildWindow(m_entityID, m_name, static_cast<int>(m_position.x), static_cast<int>(m_position.y), 200, 200);
+        g_windowSubsystem->CreateChildWindow(this, m_name, static_cast<int>(m_position.x), static_cast<int>(m_position.y), ENEMY_WINDOW_SIZE, ENEMY_WINDOW_SIZE);
 
-        Window* window                = g_windowSubsystem->GetWindow(g_windowSubsystem->FindWindowIDByEntityID(m_entityID));
-        Vec2    windowClientPosition  = window->GetClientPosition();
-        Vec2    windowClientDimension = window->GetClientDimensions();
+        Vec2 windowClientPosition  = m_window->GetClientPosition();
+        Vec2 windowClientDimension = m_window->GetClientDimensions();
 
         m_healthWidget = g_widgetSubsystem->CreateWidget<ButtonWidget>(g_widgetSubsystem, Stringf("Health=%d", m_health), (int)windowClientPosition.x, (int)windowClientPosition.y, (int)windowClientDimension.x, (int)windowClientDimension.y, m_color);
         g_widgetSubsystem->AddWidget(m_healthWidget, 200);
@@ -104,17 +106,7 @@ void Hexagon::SpawnSplitHexagons()
 
         int const randomType = g_rng->RollRandomIntInRange(0, 1);
 
-        Hexagon* child = new Hexagon(
-            g_rng->RollRandomIntInRange(100, 1000),
-            spawnPos,
-            0.f,
-            Rgba8(255, 100, 80, 255),  // lighter red - distinguishes split children from parent
-            true,
-            randomType,
-            false    // small hexagons cannot split
-        );
-
-        g_game->m_entityList.push_back(child);
+        g_game->QueueSplitHexagon(spawnPos, randomType != 0);
     }
 }
 
@@ -125,15 +117,18 @@ void Hexagon::Update(float const deltaSeconds)
 
     if (m_hasChildWindow)
     {
-        WindowID    windowID   = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-        WindowData* windowData = g_windowSubsystem->GetWindowData(windowID);
-        m_healthWidget->SetPosition(windowData->m_window->GetClientPosition());
-        m_healthWidget->SetDimensions(windowData->m_window->GetClientDimensions());
-        m_healthWidget->SetText(Stringf("Health=%d", m_health));
-        windowData->m_window->SetClientPosition(m_position - windowData->m_window->GetClientDimensions() * 0.5f);
+        m_healthWidget->SetPosition(m_window->GetClientPosition());
+        m_healthWidget->SetDimensions(m_window->GetClientDimensions());
+        m_healthWidget->SetText(g_frameArena->Format("Health=%d", m_health));
+        m_window->SetClientPosition(m_position - m_window->GetClientDimensions() * 0.5f);
     }
     if (m_isDead) return;
 
+    UpdateScheduledAI(deltaSeconds);
+}
+
+void Hexagon::UpdateAI(float const deltaSeconds)
+{
     // Chase player
     Player* player = g_game->GetPlayer();
     if (player && !player->IsDead())
@@ -148,31 +143,11 @@ void Hexagon::Update(float const deltaSeconds)
     }
 }
 
-void Hexagon::Render() const
+bool Hexagon::GetRenderShape(sRenderShape& outShape) const
 {
-    // Render as a 6-sided polygon
-    VertexList_PCU verts;
-    constexpr int  NUM_SIDES = 6;
-
-    for (int i = 0; i < NUM_SIDES; ++i)
-    {
-        float const angle0 = 360.f / static_cast<float>(NUM_SIDES) * static_cast<float>(i);
-        float const angle1 = 360.f / static_cast<float>(NUM_SIDES) * static_cast<float>(i + 1);
-
-        Vec2 const vert0 = m_position + Vec2::MakeFromPolarDegrees(angle0, m_physicRadius);
-        Vec2 const vert1 = m_position + Vec2::MakeFromPolarDegrees(angle1, m_physicRadius);
-
-        AddVertsForTriangle2D(verts, m_position, vert0, vert1, m_color);
-    }
-
-    g_renderer->SetModelConstants();
-    g_renderer->SetBlendMode(eBlendMode::OPAQUE);
-    g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
-    g_renderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
-    g_renderer->SetDepthMode(eDepthMode::DISABLED);
-    g_renderer->BindTexture(nullptr);
-    g_renderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
-    g_renderer->DrawVertexArray(verts);
+    FillRenderShape(outShape, eRenderShape::POLYGON);
+    outShape.m_sideCount = 6;
+    return true;
 }
 
 void Hexagon::BounceOfWindow()
@@ -195,19 +170,31 @@ void Hexagon::UpdateFromInput(float deltaSeconds)
 
 void Hexagon::ShrinkWindow()
 {
-    WindowID windowID = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-    Window*  window   = g_windowSubsystem->GetWindow(windowID);
+    if (m_window == nullptr) return;
 
-    if (!g_windowSubsystem->IsWindowAnimating(windowID))
+    if (!g_windowSubsystem->IsWindowAnimating(m_windowID))
     {
-        Vec2 currentPos              = window->GetWindowPosition();
-        Vec2 currentSize             = window->GetWindowDimensions();
-        Vec2 currentClientDimensions = window->GetClientDimensions();
+        Vec2 currentPos              = m_window->GetWindowPosition();
+        Vec2 currentSize             = m_window->GetWindowDimensions();
+        Vec2 currentClientDimensions = m_window->GetClientDimensions();
         if (currentClientDimensions.x <= m_physicRadius * 2.5f || currentClientDimensions.y <= m_physicRadius * 2.5f) return;
 
         Vec2 newPos  = currentPos + Vec2(1, 1);
         Vec2 newSize = currentSize + Vec2(-1, -1);
-        g_windowSubsystem->AnimateWindowPositionAndDimensions(windowID, newPos, newSize, 0.1f);
+        g_windowSubsystem->AnimateWindowPositionAndDimensions(m_windowID, newPos, newSize, 0.1f);
     }
 }
 
+void Hexagon::WriteSnapshot(SnapshotWriter& writer) const
+{
+    Entity::WriteSnapshot(writer);
+    writer.Write(m_canSplit);
+    writer.Write(m_splitCount);
+}
+
+void Hexagon::ReadSnapshot(SnapshotReader& reader)
+{
+    Entity::ReadSnapshot(reader);
+    reader.Read(m_canSplit);
+    reader.Read(m_splitCount);
+}
@@ -19,12 +19,15 @@ public:
     ~Hexagon() override;
     void MarkAsDead() override;
     void Update(float deltaSeconds) override;
-    void Render() const override;
+    bool GetRenderShape(sRenderShape& outShape) const override;
     void BounceOfWindow();
     void UpdateFromInput(float deltaSeconds) override;
     void ShrinkWindow();
+    void WriteSnapshot(SnapshotWriter& writer) const override;
+    void ReadSnapshot(SnapshotReader& reader) override;
 
 private:
+    void UpdateAI(float deltaSeconds) override;
     void SpawnSplitHexagons();
 
     std::shared_ptr<ButtonWidget> m_healthWidget;
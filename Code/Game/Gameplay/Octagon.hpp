@@ -18,12 +18,15 @@ public:
     explicit Octagon(EntityID entityID, Vec2 const& position, float orientationDegrees, Rgba8 const& color, bool isVisible, bool hasChildWindow);
     ~Octagon() override;
     void Update(float deltaSeconds) override;
-    void Render() const override;
+    bool GetRenderShape(sRenderShape& outShape) const override;
     void BounceOfWindow();
     void UpdateFromInput(float deltaSeconds) override;
     void ShrinkWindow();
+    void WriteSnapshot(SnapshotWriter& writer) const override;
+    void ReadSnapshot(SnapshotReader& reader) override;
 
 private:
+    void UpdateAI(float deltaSeconds) override;
     void FireBulletAtPlayer();
 
     std::shared_ptr<ButtonWidget> m_healthWidget;
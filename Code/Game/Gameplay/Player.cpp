@@ -11,8 +11,12 @@
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Renderer/DebugRenderSystem.hpp"
 #include "Engine/Widget/WidgetSubsystem.hpp"
-#include "Game/Gameplay/Bullet.hpp"
+#include "Game/Framework/FrameArena.hpp"
+#include "Game/Framework/RenderSnapshot.hpp"
+#include "Game/Framework/SnapshotStream.hpp"
 #include "Game/Gameplay/Game.hpp"
+#include "Game/Gameplay/ProjectileSystem.hpp"
+#include "Game/Subsystem/Audio/AudioRequestQueue.hpp"
 #include "Game/Subsystem/Widget/ButtonWidget.hpp"
 
 //----------------------------------------------------------------------------------------------------
@@ -37,11 +41,10 @@ Player::Player(EntityID const entityID,
     g_eventSystem->SubscribeEventCallbackFunction("OnGameStateChanged", OnGameStateChanged);
     g_eventSystem->SubscribeEventCallbackFunction("OnCollisionEnter", OnCollisionEnter);
 
-    g_windowSubsystem->CreateChildWindow(m_entityID, m_name, 100, 100, (int)(1445 * 0.6f), (int)(248));
+    g_windowSubsystem->CreateChildWindow(this, m_name, 100, 100, (int)(1445 * 0.6f), (int)(248));
 
-    Window* window                = g_windowSubsystem->GetWindow(g_windowSubsystem->FindWindowIDByEntityID(m_entityID));
-    Vec2    windowClientPosition  = window->GetClientPosition();
-    Vec2    windowClientDimension = window->GetClientDimensions();
+    Vec2 windowClientPosition  = m_window->GetClientPosition();
+    Vec2 windowClientDimension = m_window->GetClientDimensions();
 
     m_coinWidget   = g_widgetSubsystem->CreateWidget<ButtonWidget>(g_widgetSubsystem, Stringf("Coin=%d", m_coin), (int)windowClientPosition.x, (int)windowClientPosition.y, (int)windowClientDimension.x, (int)windowClientDimension.y, m_color);
     m_healthWidget = g_widgetSubsystem->CreateWidget<ButtonWidget>(g_widgetSubsystem, Stringf("Health=%d/%d", m_health, m_maxHealth), (int)windowClientPosition.x, (int)windowClientPosition.y, (int)windowClientDimension.x, (int)windowClientDimension.y, m_color);
@@ -82,9 +85,7 @@ void Player::Update(float const deltaSeconds)
         ShrinkWindow();
     }
 
-    WindowID    windowID   = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-    WindowData* windowData = g_windowSubsystem->GetWindowData(windowID);
-    if (windowData == nullptr) return;
+    if (m_window == nullptr) return;
     // WindowRect  rect       = windowData->m_window->lastRect;
     // DebugAddScreenText(Stringf("Player Window Position(top:%ld, bottom:%ld, left:%ld, right:%ld)", rect.top, rect.bottom, rect.left, rect.right), Vec2(0.f, Window::s_mainWindow->GetScreenDimensions().y - 20.f), 20.f, Vec2::ZERO, 0.f);
     // DebugAddScreenText(Stringf("Player Window Dimensions(width:%.1f, height:%.1f)", windowData->m_window->GetWindowDimensions().x, windowData->m_window->GetWindowDimensions().y), Vec2(0.f, Window::s_mainWindow->GetScreenDimensions().y - 40.f), 20.f, Vec2::ZERO, 0.f);
@@ -93,10 +94,10 @@ void Player::Update(float const deltaSeconds)
     // DebugAddScreenText(Stringf("Player Client Position(width:%.1f, height:%.1f)", windowData->m_window->GetClientPosition().x, windowData->m_window->GetClientPosition().y), Vec2(0.f, Window::s_mainWindow->GetScreenDimensions().y - 100.f), 20.f, Vec2::ZERO, 0.f);
     // DebugAddScreenText(Stringf("Player Position(%.1f, %.1f)", m_position.x, m_position.y), Vec2(0.f, Window::s_mainWindow->GetScreenDimensions().y - 120.f), 20.f, Vec2::ZERO, 0.f);
 
-    m_coinWidget->SetPosition(windowData->m_window->GetClientPosition());
-    m_coinWidget->SetDimensions(windowData->m_window->GetClientDimensions());
-    m_healthWidget->SetPosition(windowData->m_window->GetClientPosition() + Vec2(0, 20));
-    m_healthWidget->SetDimensions(windowData->m_window->GetClientDimensions());
+    m_coinWidget->SetPosition(m_window->GetClientPosition());
+    m_coinWidget->SetDimensions(m_window->GetClientDimensions());
+    m_healthWidget->SetPosition(m_window->GetClientPosition() + Vec2(0, 20));
+    m_healthWidget->SetDimensions(m_window->GetClientDimensions());
 
 
     if (g_game->GetCurrentGameState() == eGameState::ATTRACT)
@@ -109,32 +110,25 @@ void Player::Update(float const deltaSeconds)
             float easedT = SmoothStep5(t);
 
             Vec2 currentDim = Interpolate(Vec2(1.f, 1.f), m_targetClientDimensions, easedT);
-            windowData->m_window->SetClientDimensions(currentDim);
+            m_window->SetClientDimensions(currentDim);
 
             if (t >= 1.0f)
             {
-                windowData->m_window->SetClientDimensions(m_targetClientDimensions);
+                m_window->SetClientDimensions(m_targetClientDimensions);
                 m_isScalingIn = false;
             }
         }
 
-        windowData->m_window->SetClientPosition(m_position - windowData->m_window->GetClientDimensions() * 0.5f);
+        m_window->SetClientPosition(m_position - m_window->GetClientDimensions() * 0.5f);
     }
 }
 
 //----------------------------------------------------------------------------------------------------
-void Player::Render() const
+bool Player::GetRenderShape(sRenderShape& outShape) const
 {
-    VertexList_PCU verts2;
-    AddVertsForDisc2D(verts2, m_position, m_physicRadius, m_thickness, m_color);
-    g_renderer->SetModelConstants();
-    g_renderer->SetBlendMode(eBlendMode::OPAQUE);
-    g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
-    g_renderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
-    g_renderer->SetDepthMode(eDepthMode::DISABLED);
-    g_renderer->BindTexture(nullptr);
-    g_renderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
-    g_renderer->DrawVertexArray(verts2);
+    FillRenderShape(outShape, eRenderShape::RING);
+    outShape.m_thickness = m_thickness;
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -179,12 +173,9 @@ void Player::UpdateFromInput(float const deltaSeconds)
 //----------------------------------------------------------------------------------------------------
 void Player::UpdateWindowFocus()
 {
-    WindowID    windowID   = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-    WindowData* windowData = g_windowSubsystem->GetWindowData(windowID);
-
-    if (windowData && windowData->m_window && windowData->m_window->GetWindowHandle())
+    if (m_window && m_window->GetWindowHandle())
     {
-        HWND hwnd = static_cast<HWND>(windowData->m_window->GetWindowHandle());
+        HWND hwnd = static_cast<HWND>(m_window->GetWindowHandle());
 
         // Only reset focus when the window has lost it
         if (GetForegroundWindow() != hwnd)
@@ -198,28 +189,22 @@ void Player::UpdateWindowFocus()
 //----------------------------------------------------------------------------------------------------
 void Player::FireBullet()
 {
-    Bullet* bullet = new Bullet(g_rng->RollRandomIntInRange(100, 1000), m_position, 0.f, Rgba8::WHITE, true, false);
-
-    Vec2 velocity      = (Window::s_mainWindow->GetCursorPositionOnScreen() - m_position).GetNormalized();
-    bullet->m_velocity = velocity;
+    Vec2 const direction = (Window::s_mainWindow->GetCursorPositionOnScreen() - m_position).GetNormalized();
+    g_game->GetProjectileSystem()->SpawnProjectile(m_position, direction, 500.f, 10.f, eProjectileFaction::PLAYER, Rgba8::WHITE);
 
-    g_game->m_entityList.push_back(bullet);
-    SoundID const attractBGM = g_audio->CreateOrGetSound("Data/Audio/shoot.mp3", eAudioSystemSoundDimension::Sound2D);
-    g_audio->StartSound(attractBGM, false, 1.f, 0.f, 1.f);
+    SoundID const shootSound = g_audio->CreateOrGetSound("Data/Audio/shoot.mp3", eAudioSystemSoundDimension::Sound2D);
+    g_audioRequestQueue->RequestSound(shootSound);
 }
 
 void Player::BounceOfWindow()
 {
-    WindowID    windowID   = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-    WindowData* windowData = g_windowSubsystem->GetWindowData(windowID);
-
-    if (windowData == nullptr) return;
+    if (m_window == nullptr) return;
 
     // Get window bounds
-    float windowLeft   = windowData->m_window->GetClientPosition().x;
-    float windowBottom = windowData->m_window->GetClientPosition().y;
-    float windowTop    = windowData->m_window->GetClientPosition().y + windowData->m_window->GetClientDimensions().y;
-    float windowRight  = windowData->m_window->GetClientPosition().x + windowData->m_window->GetClientDimensions().x;
+    float windowLeft   = m_window->GetClientPosition().x;
+    float windowBottom = m_window->GetClientPosition().y;
+    float windowTop    = m_window->GetClientPosition().y + m_window->GetClientDimensions().y;
+    float windowRight  = m_window->GetClientPosition().x + m_window->GetClientDimensions().x;
 
 
     float clampedX = GetClamped(m_position.x,
@@ -237,19 +222,18 @@ void Player::BounceOfWindow()
 
 void Player::ShrinkWindow()
 {
-    WindowID windowID = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-    Window*  window   = g_windowSubsystem->GetWindow(windowID);
+    if (m_window == nullptr) return;
 
-    if (!g_windowSubsystem->IsWindowAnimating(windowID))
+    if (!g_windowSubsystem->IsWindowAnimating(m_windowID))
     {
-        Vec2 currentPos              = window->GetWindowPosition();
-        Vec2 currentSize             = window->GetWindowDimensions();
-        Vec2 currentClientDimensions = window->GetClientDimensions();
+        Vec2 currentPos              = m_window->GetWindowPosition();
+        Vec2 currentSize             = m_window->GetWindowDimensions();
+        Vec2 currentClientDimensions = m_window->GetClientDimensions();
         if (currentClientDimensions.x <= m_physicRadius * 2.5f || currentClientDimensions.y <= m_physicRadius * 2.5f) return;
 
         Vec2 newPos  = currentPos + Vec2(1, 1);
         Vec2 newSize = currentSize + Vec2(-1, -1);
-        g_windowSubsystem->AnimateWindowPositionAndDimensions(windowID, newPos, newSize, 0.1f);
+        g_windowSubsystem->AnimateWindowPositionAndDimensions(m_windowID, newPos, newSize, 0.1f);
     }
 }
 
@@ -260,11 +244,9 @@ void Player::StartScaleInAnimation()
     m_isScalingIn            = true;
     m_scaleInTimer           = 0.f;
 
-    WindowID windowID = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-    Window*  window   = g_windowSubsystem->GetWindow(windowID);
-    if (window)
+    if (m_window)
     {
-        window->SetClientDimensions(Vec2(1.f, 1.f));
+        m_window->SetClientDimensions(Vec2(1.f, 1.f));
     }
 }
 
@@ -295,15 +277,10 @@ STATIC bool Player::OnCollisionEnter(EventArgs& args)
     EntityID entityBID = args.GetValue("entityBID", -1);
     Player*  player    = g_game->GetPlayer();
     Entity*  entity    = g_game->GetEntityByEntityID(entityBID);
-    if (entityA == "You" && entityB == "Coin")
-    {
-        player->IncreaseCoin(1);
-        player->m_coinWidget->SetText(Stringf("Coin=%d", player->m_coin));
-    }
-    else if (entityA == "You" && Game::IsEnemy(entity))
+    if (entityA == "You" && Game::IsEnemy(entity))
     {
         player->DecreaseHealth(1);
-        player->m_healthWidget->SetText(Stringf("Health=%d/%d", player->m_health, player->m_maxHealth));
+        player->m_healthWidget->SetText(g_frameArena->Format("Health=%d/%d", player->m_health, player->m_maxHealth));
         player->m_position += (player->m_position - entity->m_position);
     }
 
@@ -319,3 +296,36 @@ void Player::DecreaseCoin(int const amount)
 {
     m_coin -= amount;
 }
+
+//----------------------------------------------------------------------------------------------------
+// The fire-rate Timer runs on the engine clock, which is never rewound, so it is left as is
+//----------------------------------------------------------------------------------------------------
+void Player::WriteSnapshot(SnapshotWriter& writer) const
+{
+    Entity::WriteSnapshot(writer);
+    writer.Write(m_maxHealth);
+    writer.Write(m_coin);
+    writer.Write(m_isScalingIn);
+    writer.Write(m_scaleInTimer);
+    writer.Write(m_scaleInDuration);
+    writer.Write(m_targetClientDimensions);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Player::ReadSnapshot(SnapshotReader& reader)
+{
+    Entity::ReadSnapshot(reader);
+    reader.Read(m_maxHealth);
+    reader.Read(m_coin);
+    reader.Read(m_isScalingIn);
+    reader.Read(m_scaleInTimer);
+    reader.Read(m_scaleInDuration);
+    reader.Read(m_targetClientDimensions);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Player::RefreshStatusWidgets()
+{
+    m_healthWidget->SetText(g_frameArena->Format("Health=%d/%d", m_health, m_maxHealth));
+    m_coinWidget->SetText(g_frameArena->Format("Coin=%d", m_coin));
+}
@@ -20,11 +20,14 @@ public:
     ~Player() override;
 
     void Update(float deltaSeconds) override;
-    void Render() const override;
+    bool GetRenderShape(sRenderShape& outShape) const override;
 
     void                          UpdateFromInput(float deltaSeconds) override;
     void                          UpdateWindowFocus();
     void                          FireBullet();
+    void                          WriteSnapshot(SnapshotWriter& writer) const override;
+    void                          ReadSnapshot(SnapshotReader& reader) override;
+    void                          RefreshStatusWidgets();     // Health / coin labels, which otherwise only change on events
     std::shared_ptr<ButtonWidget> m_healthWidget;
     std::shared_ptr<ButtonWidget> m_coinWidget;
     int                           m_maxHealth = 0;
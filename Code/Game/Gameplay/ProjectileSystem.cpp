@@ -0,0 +1,332 @@
+//----------------------------------------------------------------------------------------------------
+// ProjectileSystem.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/ProjectileSystem.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/RenderSnapshot.hpp"
+#include "Game/Framework/SnapshotStream.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <emmintrin.h>
+
+//----------------------------------------------------------------------------------------------------
+ProjectileSystem::ProjectileSystem(sProjectileSystemConfig const& config)
+    : m_config(config),
+      m_targetIndex(config.m_targetCellSize)
+{
+    size_t const capacity = static_cast<size_t>((std::max)(0, m_config.m_initialCapacity));
+
+    m_positionX.reserve(capacity);
+    m_positionY.reserve(capacity);
+    m_previousX.reserve(capacity);
+    m_previousY.reserve(capacity);
+    m_velocityX.reserve(capacity);
+    m_velocityY.reserve(capacity);
+    m_radius.reserve(capacity);
+    m_lifetime.reserve(capacity);
+    m_faction.reserve(capacity);
+    m_color.reserve(capacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::SpawnProjectile(Vec2 const&              position,
+                                       Vec2 const&              direction,
+                                       float const              speed,
+                                       float const              radius,
+                                       eProjectileFaction const faction,
+                                       Rgba8 const&             color)
+{
+    m_positionX.push_back(position.x);
+    m_positionY.push_back(position.y);
+    m_previousX.push_back(position.x);
+    m_previousY.push_back(position.y);
+    m_velocityX.push_back(direction.x * speed);
+    m_velocityY.push_back(direction.y * speed);
+    m_radius.push_back(radius);
+    m_lifetime.push_back(m_config.m_lifetimeSeconds);
+    m_faction.push_back(static_cast<uint8_t>(faction));
+    m_color.push_back(color);
+
+    m_maxRadius = (std::max)(m_maxRadius, radius);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::Clear()
+{
+    m_positionX.clear();
+    m_positionY.clear();
+    m_previousX.clear();
+    m_previousY.clear();
+    m_velocityX.clear();
+    m_velocityY.clear();
+    m_radius.clear();
+    m_lifetime.clear();
+    m_faction.clear();
+    m_color.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::WriteSnapshot(SnapshotWriter& writer) const
+{
+    writer.WriteVector(m_positionX);
+    writer.WriteVector(m_positionY);
+    writer.WriteVector(m_previousX);
+    writer.WriteVector(m_previousY);
+    writer.WriteVector(m_velocityX);
+    writer.WriteVector(m_velocityY);
+    writer.WriteVector(m_radius);
+    writer.WriteVector(m_lifetime);
+    writer.WriteVector(m_faction);
+    writer.WriteVector(m_color);
+    writer.Write(m_maxRadius);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::ReadSnapshot(SnapshotReader& reader)
+{
+    reader.ReadVector(m_positionX);
+    reader.ReadVector(m_positionY);
+    reader.ReadVector(m_previousX);
+    reader.ReadVector(m_previousY);
+    reader.ReadVector(m_velocityX);
+    reader.ReadVector(m_velocityY);
+    reader.ReadVector(m_radius);
+    reader.ReadVector(m_lifetime);
+    reader.ReadVector(m_faction);
+    reader.ReadVector(m_color);
+    reader.Read(m_maxRadius);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::Update(float const deltaSeconds)
+{
+    RemoveExpiredProjectiles();
+    IntegrateProjectiles(deltaSeconds);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::AppendRenderShapes(std::vector<sRenderShape>& outShapes) const
+{
+    for (size_t i = 0; i < m_lifetime.size(); ++i)
+    {
+        if (!IsAlive(i)) continue;
+
+        sRenderShape& shape = outShapes.emplace_back();
+        shape.m_position    = Vec2(m_positionX[i], m_positionY[i]);
+        shape.m_radius      = m_radius[i];
+        shape.m_cullRadius  = m_radius[i];
+        shape.m_color       = m_color[i];
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// CollideWithTargets - Targets go into a uniform grid padded by the largest projectile radius; each
+// projectile queries it with the AABB of its swept center, then runs the exact swept test against
+// every candidate and keeps the earliest impact. Targets are treated as static over the step.
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::CollideWithTargets(eProjectileFaction const              faction,
+                                          std::vector<sProjectileTarget> const& targets,
+                                          AABB2 const&                          worldBounds,
+                                          std::vector<sProjectileHit>&          outHits)
+{
+    outHits.clear();
+    if (targets.empty() || m_lifetime.empty()) return;
+
+    m_targetIndex.Reset(worldBounds);
+
+    for (sProjectileTarget const& target : targets)
+    {
+        float const paddedRadius = target.m_radius + m_maxRadius;
+        m_targetIndex.AddRect(AABB2(target.m_position - Vec2(paddedRadius, paddedRadius), target.m_position + Vec2(paddedRadius, paddedRadius)));
+    }
+
+    uint8_t const factionValue = static_cast<uint8_t>(faction);
+
+    for (size_t i = 0; i < m_lifetime.size(); ++i)
+    {
+        if (m_faction[i] != factionValue || !IsAlive(i)) continue;
+
+        Vec2 const start = Vec2(m_previousX[i], m_previousY[i]);
+        Vec2 const end   = Vec2(m_positionX[i], m_positionY[i]);
+
+        AABB2 const sweptBounds = AABB2(Vec2((std::min)(start.x, end.x), (std::min)(start.y, end.y)),
+                                        Vec2((std::max)(start.x, end.x), (std::max)(start.y, end.y)));
+        m_targetIndex.QueryOverlapping(sweptBounds, m_candidateTargets);
+
+        int   firstTarget       = -1;
+        float firstTimeOfImpact = 1.f;
+
+        for (int const candidate : m_candidateTargets)
+        {
+            sProjectileTarget const& target = targets[candidate];
+
+            float timeOfImpact = 0.f;
+            if (!SweepDiscAgainstDisc(start, end, m_radius[i], target.m_position, target.m_radius, timeOfImpact)) continue;
+
+            // Ties go to the lower target index so the result never depends on grid order
+            if (firstTarget < 0 || timeOfImpact < firstTimeOfImpact || (timeOfImpact == firstTimeOfImpact && candidate < firstTarget))
+            {
+                firstTarget       = candidate;
+                firstTimeOfImpact = timeOfImpact;
+            }
+        }
+
+        if (firstTarget < 0) continue;
+
+        Vec2 const impactPosition = start + (end - start) * firstTimeOfImpact;
+        outHits.push_back(sProjectileHit{targets[firstTarget].m_targetIndex, impactPosition, firstTimeOfImpact});
+        Kill(i);
+    }
+
+    // Resolve in the order the impacts happened within the step, not in projectile storage order
+    std::stable_sort(outHits.begin(), outHits.end(), [](sProjectileHit const& a, sProjectileHit const& b)
+    {
+        return a.m_timeOfImpact < b.m_timeOfImpact;
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// SweepDiscAgainstDisc - Reduces to a ray from start against a circle of the summed radii around
+// the target: solve |start + t * move - center| = radius + targetRadius for the smallest t.
+//----------------------------------------------------------------------------------------------------
+STATIC bool ProjectileSystem::SweepDiscAgainstDisc(Vec2 const& start,
+                                                   Vec2 const& end,
+                                                   float const radius,
+                                                   Vec2 const& center,
+                                                   float const targetRadius,
+                                                   float&      outTimeOfImpact)
+{
+    float const touch    = radius + targetRadius;
+    Vec2 const  toStart  = start - center;
+    float const c        = toStart.GetLengthSquared() - touch * touch;
+
+    // Already touching at the start of the step
+    if (c <= 0.f)
+    {
+        outTimeOfImpact = 0.f;
+        return true;
+    }
+
+    Vec2 const  move = end - start;
+    float const a    = move.GetLengthSquared();
+    float const b    = toStart.x * move.x + toStart.y * move.y;
+
+    // Not moving, or moving away from the target
+    if (a <= 0.f || b >= 0.f) return false;
+
+    float const discriminant = b * b - a * c;
+    if (discriminant < 0.f) return false;
+
+    float const timeOfImpact = (-b - sqrtf(discriminant)) / a;
+    if (timeOfImpact > 1.f) return false;
+
+    outTimeOfImpact = timeOfImpact;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// CollectEdgeHits - Edges are tested right, left, top, bottom; a projectile reports only the first
+// edge it touches, with the same two-radius margin bullets always used against the player window.
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::CollectEdgeHits(AABB2 const& container, std::vector<eProjectileEdge>& outEdgeHits)
+{
+    outEdgeHits.clear();
+
+    for (size_t i = 0; i < m_lifetime.size(); ++i)
+    {
+        if (!IsAlive(i)) continue;
+
+        float const x      = m_positionX[i];
+        float const y      = m_positionY[i];
+        float const margin = m_radius[i] * 2.f;
+
+        if (x + margin > container.m_maxs.x)      outEdgeHits.push_back(eProjectileEdge::RIGHT);
+        else if (x - margin < container.m_mins.x) outEdgeHits.push_back(eProjectileEdge::LEFT);
+        else if (y + margin > container.m_maxs.y) outEdgeHits.push_back(eProjectileEdge::TOP);
+        else if (y - margin < container.m_mins.y) outEdgeHits.push_back(eProjectileEdge::BOTTOM);
+        else continue;
+
+        Kill(i);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// IntegrateProjectiles - Four projectiles per iteration with SSE2, scalar tail for the rest.
+// Dead projectiles are integrated too; they are never read before the next removal pass.
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::IntegrateProjectiles(float const deltaSeconds)
+{
+    size_t const count  = m_lifetime.size();
+    __m128 const vDelta = _mm_set1_ps(deltaSeconds);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 const positionX = _mm_loadu_ps(&m_positionX[i]);
+        __m128 const positionY = _mm_loadu_ps(&m_positionY[i]);
+        __m128 const velocityX = _mm_loadu_ps(&m_velocityX[i]);
+        __m128 const velocityY = _mm_loadu_ps(&m_velocityY[i]);
+        __m128 const lifetime  = _mm_loadu_ps(&m_lifetime[i]);
+
+        _mm_storeu_ps(&m_previousX[i], positionX);
+        _mm_storeu_ps(&m_previousY[i], positionY);
+        _mm_storeu_ps(&m_positionX[i], _mm_add_ps(positionX, _mm_mul_ps(velocityX, vDelta)));
+        _mm_storeu_ps(&m_positionY[i], _mm_add_ps(positionY, _mm_mul_ps(velocityY, vDelta)));
+        _mm_storeu_ps(&m_lifetime[i], _mm_sub_ps(lifetime, vDelta));
+    }
+
+    for (; i < count; ++i)
+    {
+        m_previousX[i] = m_positionX[i];
+        m_previousY[i] = m_positionY[i];
+        m_positionX[i] += m_velocityX[i] * deltaSeconds;
+        m_positionY[i] += m_velocityY[i] * deltaSeconds;
+        m_lifetime[i] -= deltaSeconds;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// RemoveExpiredProjectiles - Stable compaction so draw order and hit order stay spawn order
+//----------------------------------------------------------------------------------------------------
+void ProjectileSystem::RemoveExpiredProjectiles()
+{
+    size_t const count = m_lifetime.size();
+    size_t       write = 0;
+
+    for (size_t read = 0; read < count; ++read)
+    {
+        if (!IsAlive(read)) continue;
+
+        if (write != read)
+        {
+            m_positionX[write] = m_positionX[read];
+            m_positionY[write] = m_positionY[read];
+            m_previousX[write] = m_previousX[read];
+            m_previousY[write] = m_previousY[read];
+            m_velocityX[write] = m_velocityX[read];
+            m_velocityY[write] = m_velocityY[read];
+            m_radius[write]    = m_radius[read];
+            m_lifetime[write]  = m_lifetime[read];
+            m_faction[write]   = m_faction[read];
+            m_color[write]     = m_color[read];
+        }
+        ++write;
+    }
+
+    m_positionX.resize(write);
+    m_positionY.resize(write);
+    m_previousX.resize(write);
+    m_previousY.resize(write);
+    m_velocityX.resize(write);
+    m_velocityY.resize(write);
+    m_radius.resize(write);
+    m_lifetime.resize(write);
+    m_faction.resize(write);
+    m_color.resize(write);
+}
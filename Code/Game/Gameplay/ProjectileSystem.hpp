@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------------------------------
+// ProjectileSystem.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/MemoryTracker.hpp"
+#include "Game/Framework/RectSpatialIndex.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class SnapshotReader;
+class SnapshotWriter;
+struct sRenderShape;
+
+//----------------------------------------------------------------------------------------------------
+enum class eProjectileFaction : uint8_t
+{
+    PLAYER,
+    ENEMY,
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eProjectileEdge : uint8_t
+{
+    RIGHT,
+    LEFT,
+    TOP,
+    BOTTOM,
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sProjectileSystemConfig
+{
+    int   m_initialCapacity  = 1024;
+    float m_lifetimeSeconds  = 10.f;       // Safety net; projectiles normally die on a hit or a window edge
+    float m_targetCellSize   = 64.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Anything a projectile can hit; m_targetIndex is handed back untouched in sProjectileHit
+//----------------------------------------------------------------------------------------------------
+struct sProjectileTarget
+{
+    Vec2  m_position    = Vec2::ZERO;
+    float m_radius      = 0.f;
+    int   m_targetIndex = -1;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sProjectileHit
+{
+    int   m_targetIndex  = -1;
+    Vec2  m_position     = Vec2::ZERO;     // Projectile position at the moment of impact
+    float m_timeOfImpact = 0.f;            // Fraction of the last step, 0 = previous position, 1 = current
+};
+
+//----------------------------------------------------------------------------------------------------
+// ProjectileSystem
+// Every live bullet, player and enemy alike, as contiguous arrays. Projectiles are not entities:
+// they are integrated in one pass, collided through CollideWithTargets() and drawn in one batch.
+// A projectile is killed by zeroing its lifetime and removed on the next Update().
+// Collision is continuous: each projectile sweeps its disc along the segment it moved in the last
+// Update(), so a long frame cannot step a fast bullet over a small target.
+//----------------------------------------------------------------------------------------------------
+class ProjectileSystem
+{
+public:
+    GAME_MEMORY_TAG(eMemoryTag::PROJECTILE)
+
+    explicit ProjectileSystem(sProjectileSystemConfig const& config);
+
+    void SpawnProjectile(Vec2 const& position, Vec2 const& direction, float speed, float radius, eProjectileFaction faction, Rgba8 const& color);
+    void Clear();
+    void WriteSnapshot(SnapshotWriter& writer) const;
+    void ReadSnapshot(SnapshotReader& reader);
+
+    void Update(float deltaSeconds);
+    void AppendRenderShapes(std::vector<sRenderShape>& outShapes) const;     // One disc per live projectile, culled by render prep
+
+    // Kills every live projectile of the faction whose last step touched a target and reports one hit
+    // per projectile, against the first target touched; hits are sorted by time of impact
+    void CollideWithTargets(eProjectileFaction faction, std::vector<sProjectileTarget> const& targets, AABB2 const& worldBounds, std::vector<sProjectileHit>& outHits);
+
+    // Kills every live projectile touching or outside an edge of the container and reports which edge it hit
+    void CollectEdgeHits(AABB2 const& container, std::vector<eProjectileEdge>& outEdgeHits);
+
+    int GetProjectileCount() const { return static_cast<int>(m_lifetime.size()); }
+
+    // Moving disc (start -> end) against a static disc; returns the first touching fraction in [0, 1]
+    static bool SweepDiscAgainstDisc(Vec2 const& start, Vec2 const& end, float radius, Vec2 const& center, float targetRadius, float& outTimeOfImpact);
+
+private:
+    void IntegrateProjectiles(float deltaSeconds);
+    void RemoveExpiredProjectiles();
+    bool IsAlive(size_t index) const { return m_lifetime[index] > 0.f; }
+    void Kill(size_t index) { m_lifetime[index] = 0.f; }
+
+    sProjectileSystemConfig m_config;
+
+    // One entry per projectile, same index across every array
+    TrackedVector<float, eMemoryTag::PROJECTILE>   m_positionX;
+    TrackedVector<float, eMemoryTag::PROJECTILE>   m_positionY;
+    TrackedVector<float, eMemoryTag::PROJECTILE>   m_previousX;      // Position before the last integration step
+    TrackedVector<float, eMemoryTag::PROJECTILE>   m_previousY;
+    TrackedVector<float, eMemoryTag::PROJECTILE>   m_velocityX;
+    TrackedVector<float, eMemoryTag::PROJECTILE>   m_velocityY;
+    TrackedVector<float, eMemoryTag::PROJECTILE>   m_radius;
+    TrackedVector<float, eMemoryTag::PROJECTILE>   m_lifetime;
+    TrackedVector<uint8_t, eMemoryTag::PROJECTILE> m_faction;
+    TrackedVector<Rgba8, eMemoryTag::PROJECTILE>   m_color;
+
+    float            m_maxRadius = 0.f;     // Largest radius ever spawned, pads the target broadphase
+    RectSpatialIndex m_targetIndex;
+    std::vector<int> m_candidateTargets;
+};
@@ -5,6 +5,7 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Gameplay/Shop.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameArena.hpp"
 #include "Game/Gameplay/Game.hpp"
 #include "Game/Gameplay/Player.hpp"
 #include "Game/Subsystem/Widget/ButtonWidget.hpp"
@@ -33,11 +34,10 @@ Shop::Shop(EntityID const entityID,
 
     if (m_hasChildWindow)
     {
-        g_windowSubsystem->CreateChildWindow(m_entityID, m_name, static_cast<int>(m_position.x), static_cast<int>(m_position.y), 700, 500);
+        g_windowSubsystem->CreateChildWindow(this, m_name, static_cast<int>(m_position.x), static_cast<int>(m_position.y), 700, 500);
 
-        Window* window                = g_windowSubsystem->GetWindow(g_windowSubsystem->FindWindowIDByEntityID(m_entityID));
-        Vec2    windowClientPosition  = window->GetClientPosition();
-        Vec2    windowClientDimension = window->GetClientDimensions();
+        Vec2 windowClientPosition  = m_window->GetClientPosition();
+        Vec2 windowClientDimension = m_window->GetClientDimensions();
 
         m_itemWidgetA = g_widgetSubsystem->CreateWidget<ButtonWidget>(g_widgetSubsystem, Stringf("A=%d", m_health), (int)windowClientPosition.x, (int)windowClientPosition.y, (int)windowClientDimension.x, (int)windowClientDimension.y, m_color);
         m_itemWidgetB = g_widgetSubsystem->CreateWidget<ButtonWidget>(g_widgetSubsystem, Stringf("B=%d", m_health), (int)windowClientPosition.x, (int)windowClientPosition.y, (int)windowClientDimension.x, (int)windowClientDimension.y, m_color);
@@ -79,20 +79,15 @@ void Shop::Update(float const deltaSeconds)
 {
     Entity::Update(deltaSeconds);
 
-    if (m_hasChildWindow)
-    {
-        WindowID    windowID   = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-        WindowData* windowData = g_windowSubsystem->GetWindowData(windowID);
-        windowData->m_window->SetClientPosition(m_position - windowData->m_window->GetClientDimensions() * 0.5f);
-    }
-    WindowID    windowID   = g_windowSubsystem->FindWindowIDByEntityID(m_entityID);
-    WindowData* windowData = g_windowSubsystem->GetWindowData(windowID);
-    m_itemWidgetA->SetPosition(windowData->m_window->GetClientPosition() - Vec2(500, -200));
-    m_itemWidgetB->SetPosition(windowData->m_window->GetClientPosition() - Vec2(300, -200));
-    m_itemWidgetC->SetPosition(windowData->m_window->GetClientPosition() - Vec2(100, -200));
-    m_itemWidgetA->SetDimensions(windowData->m_window->GetClientDimensions());
-    m_itemWidgetB->SetDimensions(windowData->m_window->GetClientDimensions());
-    m_itemWidgetC->SetDimensions(windowData->m_window->GetClientDimensions());
+    if (m_window == nullptr) return;
+
+    m_window->SetClientPosition(m_position - m_window->GetClientDimensions() * 0.5f);
+    m_itemWidgetA->SetPosition(m_window->GetClientPosition() - Vec2(500, -200));
+    m_itemWidgetB->SetPosition(m_window->GetClientPosition() - Vec2(300, -200));
+    m_itemWidgetC->SetPosition(m_window->GetClientPosition() - Vec2(100, -200));
+    m_itemWidgetA->SetDimensions(m_window->GetClientDimensions());
+    m_itemWidgetB->SetDimensions(m_window->GetClientDimensions());
+    m_itemWidgetC->SetDimensions(m_window->GetClientDimensions());
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -101,7 +96,7 @@ void Shop::Render() const
     // if (!m_isVisible) return;
     //WindowID       windowID   = g_theWindowSubsystem->FindWindowIDByEntityID(m_entityID);
     // WindowData*    windowData = g_theWindowSubsystem->GetWindowData(windowID);
-    VertexList_PCU verts;
+    VertexList_PCU& verts = g_frameArena->AcquireVertexList();
     AddVertsForAABB2D(verts, AABB2(m_position - Vec2(100, 200), m_position + Vec2(100, 200)));
     AddVertsForAABB2D(verts, AABB2(m_position - Vec2(315, 200), m_position + Vec2(-115, 200)));
     AddVertsForAABB2D(verts, AABB2(m_position - Vec2(-115, 200), m_position + Vec2(315, 200)));
@@ -115,9 +110,16 @@ void Shop::Render() const
     g_renderer->DrawVertexArray(verts);
 
 
-    m_itemWidgetA->SetText(Stringf("speed"));
-    m_itemWidgetB->SetText(Stringf("health"));
-    m_itemWidgetC->SetText(Stringf("max   \nhealth"));
+    m_itemWidgetA->SetText("speed");
+    m_itemWidgetB->SetText("health");
+    m_itemWidgetC->SetText("max   \nhealth");
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 Shop::GetCosmeticBounds() const
+{
+    // Render() draws the three item panels side by side around m_position
+    return AABB2(m_position - Vec2(315.f, 200.f), m_position + Vec2(315.f, 200.f));
 }
 
 STATIC bool Shop::OnGameStateChanged(EventArgs& args)
@@ -162,15 +164,15 @@ void Shop::UpdateFromInput(float const deltaSeconds)
     else if (g_input->WasKeyJustPressed(NUMCODE_2))
     {
         player->m_health += 5;
-        player->m_healthWidget->SetText(Stringf("Health=%d/%d", player->m_health, player->m_maxHealth));
+        player->m_healthWidget->SetText(g_frameArena->Format("Health=%d/%d", player->m_health, player->m_maxHealth));
         player->m_coin -= 5;
-        player->m_coinWidget->SetText(Stringf("Coin=%d", player->m_coin));
+        player->m_coinWidget->SetText(g_frameArena->Format("Coin=%d", player->m_coin));
     }
     else if (g_input->WasKeyJustPressed(NUMCODE_3))
     {
         player->m_maxHealth += 5;
-        player->m_healthWidget->SetText(Stringf("Health=%d/%d", player->m_health, player->m_maxHealth));
+        player->m_healthWidget->SetText(g_frameArena->Format("Health=%d/%d", player->m_health, player->m_maxHealth));
         player->m_coin -= 10;
-        player->m_coinWidget->SetText(Stringf("Coin=%d", player->m_coin));
+        player->m_coinWidget->SetText(g_frameArena->Format("Coin=%d", player->m_coin));
     }
 }
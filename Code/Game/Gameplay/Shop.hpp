@@ -32,6 +32,7 @@ public:
 
     void Update(float deltaSeconds) override;
     void Render() const override;
+    AABB2 GetCosmeticBounds() const override;
 
 private:
     static bool OnGameStateChanged(EventArgs& args);
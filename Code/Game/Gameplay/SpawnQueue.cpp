@@ -0,0 +1,191 @@
+//----------------------------------------------------------------------------------------------------
+// SpawnQueue.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/SpawnQueue.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "Game/Framework/SnapshotStream.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int    PRIORITY_COUNT   = static_cast<int>(eSpawnPriority::COUNT);
+    constexpr float  PREDICTION_BLEND = 0.25f;     // Weight of the newest sample in the running average
+    constexpr size_t COMPACT_MIN_HEAD = 64;
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+SpawnQueue::SpawnQueue(sSpawnQueueConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void SpawnQueue::Enqueue(sSpawnCommand const& command)
+{
+    int const                   priority = static_cast<int>(command.m_priority);
+    std::vector<sSpawnCommand>& pending  = m_pending[priority];
+
+    if (m_heads[priority] >= COMPACT_MIN_HEAD && m_heads[priority] * 2 >= pending.size())
+    {
+        pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(m_heads[priority]));
+        m_heads[priority] = 0;
+    }
+
+    pending.push_back(command);
+    pending.back().m_enqueueFrame = m_frameIndex;
+
+    m_peakPendingCount = (std::max)(m_peakPendingCount, GetPendingCount());
+}
+
+//----------------------------------------------------------------------------------------------------
+void SpawnQueue::Clear()
+{
+    for (int p = 0; p < PRIORITY_COUNT; ++p)
+    {
+        m_pending[p].clear();
+        m_heads[p] = 0;
+    }
+
+    m_peakPendingCount = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SpawnQueue::BeginFlush()
+{
+    ++m_frameIndex;
+    m_flushStartSeconds        = GetNowSeconds();
+    m_budgetedCount            = 0;
+    m_executedCount            = 0;
+    m_deferredCount            = 0;
+    m_worstCommandMicroseconds = 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+// BeginCommand - Highest priority first. Once a budgeted front does not fit, lower priorities only
+// give up commands that are forced, so the budget never reorders work within the budgeted tiers.
+//----------------------------------------------------------------------------------------------------
+bool SpawnQueue::BeginCommand(sSpawnCommand& outCommand)
+{
+    double const now          = GetNowSeconds();
+    float const  spent        = static_cast<float>((now - m_flushStartSeconds) * 1000000.0);
+    bool         isOverBudget = false;
+
+    for (int p = 0; p < PRIORITY_COUNT; ++p)
+    {
+        if (m_heads[p] == m_pending[p].size()) continue;
+
+        sSpawnCommand const& front    = m_pending[p][m_heads[p]];
+        bool const           isForced = IsForced(front);
+
+        if (!isForced)
+        {
+            isOverBudget = isOverBudget || spent + GetPredictedMicroseconds(front) > m_config.m_budgetMicroseconds;
+            if (isOverBudget) continue;
+        }
+
+        outCommand      = front;
+        m_activeCommand = front;
+        m_budgetedCount += (front.m_priority != eSpawnPriority::IMMEDIATE) ? 1 : 0;
+
+        if (++m_heads[p] == m_pending[p].size())
+        {
+            m_pending[p].clear();
+            m_heads[p] = 0;
+        }
+
+        m_commandStartSeconds = now;
+        return true;
+    }
+
+    m_deferredCount     = GetPendingCount();
+    m_flushMicroseconds = spent;
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SpawnQueue::EndCommand()
+{
+    float const costMicroseconds = static_cast<float>((GetNowSeconds() - m_commandStartSeconds) * 1000000.0);
+    float&      predicted        = GetPredictedMicroseconds(m_activeCommand);
+
+    predicted = (predicted == 0.f) ? costMicroseconds : predicted + (costMicroseconds - predicted) * PREDICTION_BLEND;
+
+    m_worstCommandMicroseconds = (std::max)(m_worstCommandMicroseconds, costMicroseconds);
+    ++m_executedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// WriteSnapshot - Pending commands per priority, in execution order
+//----------------------------------------------------------------------------------------------------
+void SpawnQueue::WriteSnapshot(SnapshotWriter& writer) const
+{
+    for (int p = 0; p < PRIORITY_COUNT; ++p)
+    {
+        uint32_t const count = static_cast<uint32_t>(m_pending[p].size() - m_heads[p]);
+        writer.Write(count);
+        writer.WriteBytes(m_pending[p].data() + m_heads[p], count * sizeof(sSpawnCommand));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// ReadSnapshot - Must mirror WriteSnapshot; restored commands start waiting afresh
+//----------------------------------------------------------------------------------------------------
+void SpawnQueue::ReadSnapshot(SnapshotReader& reader)
+{
+    for (int p = 0; p < PRIORITY_COUNT; ++p)
+    {
+        reader.ReadVector(m_pending[p]);
+        m_heads[p] = 0;
+
+        for (sSpawnCommand& command : m_pending[p])
+        {
+            command.m_enqueueFrame = m_frameIndex;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int SpawnQueue::GetPendingCount() const
+{
+    int count = 0;
+
+    for (int p = 0; p < PRIORITY_COUNT; ++p)
+    {
+        count += static_cast<int>(m_pending[p].size() - m_heads[p]);
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------------------------
+int SpawnQueue::GetPendingCount(eSpawnPriority const priority) const
+{
+    int const p = static_cast<int>(priority);
+    return static_cast<int>(m_pending[p].size() - m_heads[p]);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool SpawnQueue::IsForced(sSpawnCommand const& command) const
+{
+    if (!m_config.m_isEnabled) return true;
+    if (command.m_priority == eSpawnPriority::IMMEDIATE) return true;
+    if (m_budgetedCount == 0) return true;     // Progress: one budgeted command per flush, whatever it costs
+
+    return m_frameIndex - command.m_enqueueFrame >= static_cast<uint32_t>(m_config.m_maxWaitFrames);
+}
+
+//----------------------------------------------------------------------------------------------------
+float& SpawnQueue::GetPredictedMicroseconds(sSpawnCommand const& command)
+{
+    return m_predictedMicroseconds[static_cast<int>(command.m_type)][command.m_hasChildWindow ? 1 : 0];
+}
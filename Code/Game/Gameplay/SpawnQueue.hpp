@@ -0,0 +1,117 @@
+//----------------------------------------------------------------------------------------------------
+// SpawnQueue.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Game/Gameplay/WaveManager.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+class SnapshotReader;
+class SnapshotWriter;
+
+//----------------------------------------------------------------------------------------------------
+// Drain order. Projectiles and coin stacks never come through here; they are pooled and always immediate.
+//----------------------------------------------------------------------------------------------------
+enum class eSpawnPriority : uint8_t
+{
+    IMMEDIATE,     // Next flush regardless of the budget (split children without a window)
+    GAMEPLAY,      // Budgeted (wave enemies without a window, split children with one)
+    COSMETIC,      // Budgeted after GAMEPLAY (wave enemies that open a child window and widget)
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eSpawnCommandType : uint8_t
+{
+    ENEMY,
+    SPLIT_HEXAGON,
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sSpawnCommand
+{
+    eSpawnCommandType m_type           = eSpawnCommandType::ENEMY;
+    eSpawnPriority    m_priority       = eSpawnPriority::GAMEPLAY;
+    bool              m_hasChildWindow = false;
+    eEnemyType        m_enemyType      = eEnemyType::TRIANGLE;
+    Vec2              m_position       = Vec2::ZERO;
+    uint32_t          m_enqueueFrame   = 0;     // Stamped by Enqueue()
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sSpawnQueueConfig
+{
+    bool  m_isEnabled          = true;       // Off, every flush drains the whole queue as spawning used to
+    float m_budgetMicroseconds = 1000.f;     // Per-frame spend on GAMEPLAY and COSMETIC commands
+    int   m_maxWaitFrames      = 30;         // A command this old runs regardless of the budget
+};
+
+//----------------------------------------------------------------------------------------------------
+// SpawnQueue
+// Spawns are recorded as commands and executed once per frame under a microsecond budget, so a wave
+// spawn landing on the same frame as a chain of hexagon splits is spread over the next few frames
+// instead of stacking window creation into one spike. Each command's cost is predicted from a running
+// average of its kind (type, with or without a child window); a budgeted command only starts if its
+// prediction fits in what is left. At least one budgeted command runs per flush, and m_maxWaitFrames
+// bounds how long any command can be held back, so a tight budget slows spawning but never stalls it.
+//----------------------------------------------------------------------------------------------------
+class SpawnQueue
+{
+public:
+    explicit SpawnQueue(sSpawnQueueConfig const& config);
+
+    void Enqueue(sSpawnCommand const& command);
+    void Clear();
+
+    // Once per frame: BeginFlush(), then while (BeginCommand(command)) { execute it; EndCommand(); }
+    void BeginFlush();
+    bool BeginCommand(sSpawnCommand& outCommand);
+    void EndCommand();
+
+    void WriteSnapshot(SnapshotWriter& writer) const;
+    void ReadSnapshot(SnapshotReader& reader);
+
+    void SetEnabled(bool const isEnabled) { m_config.m_isEnabled = isEnabled; }
+    bool IsEnabled() const { return m_config.m_isEnabled; }
+
+    // Instrumentation; executed / deferred / timings are as of the last flush
+    int   GetPendingCount() const;
+    int   GetPendingCount(eSpawnPriority priority) const;
+    int   GetPeakPendingCount() const { return m_peakPendingCount; }
+    int   GetExecutedCount() const { return m_executedCount; }
+    int   GetDeferredCount() const { return m_deferredCount; }
+    float GetFlushMicroseconds() const { return m_flushMicroseconds; }
+    float GetWorstCommandMicroseconds() const { return m_worstCommandMicroseconds; }
+    float GetBudgetMicroseconds() const { return m_config.m_budgetMicroseconds; }
+
+private:
+    bool   IsForced(sSpawnCommand const& command) const;
+    float& GetPredictedMicroseconds(sSpawnCommand const& command);
+
+    sSpawnQueueConfig m_config;
+
+    // One FIFO per priority; m_heads[p] is the next command, storage is compacted once it is half consumed
+    std::vector<sSpawnCommand> m_pending[static_cast<int>(eSpawnPriority::COUNT)];
+    size_t                     m_heads[static_cast<int>(eSpawnPriority::COUNT)] = {};
+
+    // Running average cost per command type, without / with a child window
+    float m_predictedMicroseconds[static_cast<int>(eSpawnCommandType::COUNT)][2] = {};
+
+    uint32_t      m_frameIndex          = 0;
+    double        m_flushStartSeconds   = 0.0;
+    double        m_commandStartSeconds = 0.0;
+    sSpawnCommand m_activeCommand;
+    int           m_budgetedCount       = 0;     // Budgeted commands run in the current flush
+
+    int   m_peakPendingCount         = 0;
+    int   m_executedCount            = 0;
+    int   m_deferredCount            = 0;
+    float m_flushMicroseconds        = 0.f;
+    float m_worstCommandMicroseconds = 0.f;
+};
@@ -18,11 +18,13 @@ public:
     explicit Square(EntityID entityID, Vec2 const& position, float orientationDegrees, Rgba8 const& color, bool isVisible, bool hasChildWindow);
     ~Square() override;
     void Update(float deltaSeconds) override;
-    void Render() const override;
+    bool GetRenderShape(sRenderShape& outShape) const override;
     void BounceOfWindow();
     void UpdateFromInput(float deltaSeconds) override;
     void ShrinkWindow();
 
 private:
+    void UpdateAI(float deltaSeconds) override;
+
     std::shared_ptr<ButtonWidget> m_healthWidget;
 };
@@ -19,11 +19,13 @@ public:
     ~Triangle() override;
     void UpdateWindowFocus();
     void Update(float deltaSeconds) override;
-    void Render() const override;
+    bool GetRenderShape(sRenderShape& outShape) const override;
     void BounceOfWindow();
     void UpdateFromInput(float deltaSeconds) override;
     void ShrinkWindow();
 
 private:
+    void UpdateAI(float deltaSeconds) override;
+
     std::shared_ptr<ButtonWidget> m_healthWidget;
 };
@@ -5,6 +5,7 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Gameplay/UpgradeManager.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Game/Framework/SnapshotStream.hpp"
 #include "Game/Gameplay/Game.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/EngineCommon.hpp"
@@ -177,3 +178,25 @@ Upgrade const* UpgradeManager::GetUpgrade(eUpgradeType type) const
 
 	return &m_upgrades[index];
 }
+
+//-----------------------------------------------------------------------------------------------
+// WriteSnapshot - Levels are the only upgrade state that changes during a run
+//-----------------------------------------------------------------------------------------------
+void UpgradeManager::WriteSnapshot(SnapshotWriter& writer) const
+{
+	for (Upgrade const& upgrade : m_upgrades)
+	{
+		writer.Write(upgrade.m_level);
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+// ReadSnapshot
+//-----------------------------------------------------------------------------------------------
+void UpgradeManager::ReadSnapshot(SnapshotReader& reader)
+{
+	for (Upgrade& upgrade : m_upgrades)
+	{
+		reader.Read(upgrade.m_level);
+	}
+}
@@ -9,6 +9,8 @@
 
 //----------------------------------------------------------------------------------------------------
 class Game;
+class SnapshotReader;
+class SnapshotWriter;
 
 //----------------------------------------------------------------------------------------------------
 // Upgrade Types Enumeration
@@ -63,6 +65,10 @@ public:
 	// Accessors
 	Upgrade const* GetUpgrade(eUpgradeType type) const;
 
+	// Rewind / retry snapshots (purchased levels only)
+	void WriteSnapshot(SnapshotWriter& writer) const;
+	void ReadSnapshot(SnapshotReader& reader);
+
 private:
 	// Game reference
 	Game* m_game = nullptr;
@@ -5,8 +5,13 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Gameplay/WaveManager.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Game/Framework/SnapshotStream.hpp"
+#include "Game/Gameplay/EnemyUtils.hpp"
 #include "Game/Gameplay/Game.hpp"
+#include "Game/Gameplay/SpawnQueue.hpp"
+#include "Game/Subsystem/Window/WindowSubsystem.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Engine/Core/Clock.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/EventSystem.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
@@ -32,10 +37,21 @@ WaveManager::~WaveManager()
 //-----------------------------------------------------------------------------------------------
 void WaveManager::Update(float deltaSeconds)
 {
+	MeasureWaveStartFrame();
+
 	// Wave transition: pause between waves
 	if (m_isInTransition)
 	{
 		m_waveTransitionTimer += deltaSeconds;
+
+		// Roll the next wave on the first idle frame, then pre-create child windows so its spawns recycle them
+		if (m_isPrecomputeEnabled && !m_hasPreparedWave)
+		{
+			PrepareNextWave();
+		}
+
+		g_windowSubsystem->WarmWindowPool(ENEMY_WINDOW_SIZE, ENEMY_WINDOW_SIZE);
+
 		if (m_waveTransitionTimer >= m_waveTransitionDelay)
 		{
 			m_isInTransition = false;
@@ -61,13 +77,14 @@ void WaveManager::Update(float deltaSeconds)
 		if (m_spawnTimer >= m_spawnInterval)
 		{
 			m_spawnTimer = 0.0f;
-			m_game->SpawnEnemyByType(SelectRandomEnemyType());
+			SpawnNextEnemy();
 			++m_enemiesSpawnedThisWave;
 		}
 	}
 
-	// Check for wave completion: all enemies spawned AND all killed
-	int const aliveEnemies = CountAliveEnemies();
+	// Check for wave completion: all enemies spawned AND all killed; queued spawns count as alive, or a
+	// wave could end between a hexagon split and its children appearing
+	int const aliveEnemies = CountAliveEnemies() + m_game->GetSpawnQueue()->GetPendingCount();
 	m_remainingEnemies = aliveEnemies;
 
 	if (m_enemiesSpawnedThisWave >= m_totalEnemiesInWave && aliveEnemies == 0)
@@ -86,13 +103,23 @@ void WaveManager::StartWave()
 	m_spawnTimer             = 0.0f;
 	m_enemiesSpawnedThisWave = 0;
 
-	// Build spawn weight table for this wave
-	BuildSpawnTable();
+	// Build spawn weight table for this wave (already built for it if the wave was prepared)
+	if (!m_hasPreparedWave)
+	{
+		BuildSpawnTable(m_currentWaveNumber);
+		m_preparedSpawns.clear();
+	}
+
+	m_hasPreparedWave   = false;
+	m_nextPreparedSpawn = 0;
 
 	// Calculate enemies for this wave using difficulty scaling
-	m_totalEnemiesInWave = static_cast<int>(m_baseEnemiesPerWave * powf(m_difficultyScaling, static_cast<float>(m_currentWaveNumber - 1)));
+	m_totalEnemiesInWave = CalculateEnemiesForWave(m_currentWaveNumber);
 	m_remainingEnemies   = m_totalEnemiesInWave;
 
+	m_waveStartMeasureTimer      = 0.0f;
+	m_waveStartWorstFrameSeconds = 0.0f;
+
 	// Scale spawn interval: faster spawns in later waves (min capped)
 	m_spawnInterval = m_baseSpawnInterval / (1.0f + 0.1f * static_cast<float>(m_currentWaveNumber - 1));
 	if (m_spawnInterval < m_minSpawnInterval)
@@ -155,10 +182,13 @@ void WaveManager::Reset()
 	m_isInTransition         = false;
 	m_waveTransitionTimer    = 0.0f;
 	m_spawnTable.clear();
+	m_hasPreparedWave        = false;
+	m_preparedSpawns.clear();
+	m_nextPreparedSpawn      = 0;
 }
 
 //-----------------------------------------------------------------------------------------------
-// CountAliveEnemies - Counts living enemies (excludes player, bullets, coins, shop, debris)
+// CountAliveEnemies - Counts living enemies (excludes player, shop, debris)
 //-----------------------------------------------------------------------------------------------
 int WaveManager::CountAliveEnemies() const
 {
@@ -174,13 +204,13 @@ int WaveManager::CountAliveEnemies() const
 }
 
 //-----------------------------------------------------------------------------------------------
-// BuildSpawnTable - Configures spawn weights based on current wave number
+// BuildSpawnTable - Configures spawn weights for the given wave number
 // Wave 1: Only Triangle, Circle, Octagon (basic enemies)
 // Wave 2: Adds Square (tanky)
 // Wave 3: Adds Pentagon (fast zigzag)
 // Wave 4+: All Tier 1 enemies including Hexagon (splitter)
 //-----------------------------------------------------------------------------------------------
-void WaveManager::BuildSpawnTable()
+void WaveManager::BuildSpawnTable(int const waveNumber)
 {
 	m_spawnTable.clear();
 
@@ -194,19 +224,19 @@ void WaveManager::BuildSpawnTable()
 	m_spawnTable.push_back({eEnemyType::OCTAGON, 20});
 
 	// Square - tanky slow chaser, introduced from wave 2
-	if (m_currentWaveNumber >= 2)
+	if (waveNumber >= 2)
 	{
 		m_spawnTable.push_back({eEnemyType::SQUARE, 10});
 	}
 
 	// Pentagon - fast zigzag, introduced from wave 3
-	if (m_currentWaveNumber >= 3)
+	if (waveNumber >= 3)
 	{
 		m_spawnTable.push_back({eEnemyType::PENTAGON, 15});
 	}
 
 	// Hexagon - splits on death, introduced from wave 4
-	if (m_currentWaveNumber >= 4)
+	if (waveNumber >= 4)
 	{
 		m_spawnTable.push_back({eEnemyType::HEXAGON, 10});
 	}
@@ -251,3 +281,126 @@ eEnemyType WaveManager::SelectRandomEnemyType() const
 	// Should never reach here, but fallback to last entry
 	return m_spawnTable.back().type;
 }
+
+//-----------------------------------------------------------------------------------------------
+// CalculateEnemiesForWave - Enemy count for a wave number using difficulty scaling
+//-----------------------------------------------------------------------------------------------
+int WaveManager::CalculateEnemiesForWave(int const waveNumber) const
+{
+	return static_cast<int>(m_baseEnemiesPerWave * powf(m_difficultyScaling, static_cast<float>(waveNumber - 1)));
+}
+
+//-----------------------------------------------------------------------------------------------
+// PrepareNextWave - Rolls the next wave's spawn schedule while the transition is idle
+// Type, spawn position and window choice are rolled here so the spawn timer only constructs
+// entities; entity storage is reserved up front. Enemy stats stay in the enemy constructors
+// because they read the live wave number and the shared RNG.
+//-----------------------------------------------------------------------------------------------
+void WaveManager::PrepareNextWave()
+{
+	int const nextWaveNumber = m_currentWaveNumber + 1;
+
+	BuildSpawnTable(nextWaveNumber);
+
+	int const  enemyCount       = CalculateEnemiesForWave(nextWaveNumber);
+	Vec2 const screenDimensions = Window::s_mainWindow->GetScreenDimensions();
+
+	m_preparedSpawns.clear();
+	m_preparedSpawns.reserve(static_cast<size_t>(enemyCount));
+
+	for (int i = 0; i < enemyCount; ++i)
+	{
+		PreparedSpawn spawn;
+		spawn.type           = SelectRandomEnemyType();
+		spawn.position       = EnemyUtils::GetRandomSpawnPosition(screenDimensions);
+		spawn.hasChildWindow = g_rng->RollRandomIntInRange(0, 1) != 0;
+		m_preparedSpawns.push_back(spawn);
+	}
+
+	m_game->ReserveEntityStorage(m_preparedSpawns.size());
+
+	m_nextPreparedSpawn = 0;
+	m_hasPreparedWave   = true;
+}
+
+//-----------------------------------------------------------------------------------------------
+// SpawnNextEnemy - Queues the next prepared spawn, or rolls one on the spot without a schedule
+//-----------------------------------------------------------------------------------------------
+void WaveManager::SpawnNextEnemy()
+{
+	if (m_nextPreparedSpawn < m_preparedSpawns.size())
+	{
+		PreparedSpawn const& spawn = m_preparedSpawns[m_nextPreparedSpawn++];
+		m_game->QueueEnemySpawn(spawn.type, spawn.position, spawn.hasChildWindow);
+		return;
+	}
+
+	// Same roll order as Game::SpawnEnemyByType(enemyType)
+	eEnemyType const enemyType      = SelectRandomEnemyType();
+	Vec2 const       position       = EnemyUtils::GetRandomSpawnPosition(Window::s_mainWindow->GetScreenDimensions());
+	bool const       hasChildWindow = g_rng->RollRandomIntInRange(0, 1) != 0;
+
+	m_game->QueueEnemySpawn(enemyType, position, hasChildWindow);
+}
+
+//-----------------------------------------------------------------------------------------------
+// MeasureWaveStartFrame - Tracks the worst unscaled frame time during the first moments of a wave
+//-----------------------------------------------------------------------------------------------
+void WaveManager::MeasureWaveStartFrame()
+{
+	if (!m_isWaveActive || m_waveStartMeasureTimer >= m_waveStartMeasureDuration) return;
+
+	float const frameSeconds = static_cast<float>(Clock::GetSystemClock().GetDeltaSeconds());
+	m_waveStartMeasureTimer += frameSeconds;
+
+	if (frameSeconds > m_waveStartWorstFrameSeconds)
+	{
+		m_waveStartWorstFrameSeconds = frameSeconds;
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+// WriteSnapshot - Wave counters, timers and the rolled schedule of the current / next wave
+//-----------------------------------------------------------------------------------------------
+void WaveManager::WriteSnapshot(SnapshotWriter& writer) const
+{
+	writer.Write(m_currentWaveNumber);
+	writer.Write(m_isWaveActive);
+	writer.Write(m_isBossActive);
+	writer.Write(m_remainingEnemies);
+	writer.Write(m_totalEnemiesInWave);
+	writer.Write(m_enemiesSpawnedThisWave);
+	writer.Write(m_spawnTimer);
+	writer.Write(m_spawnInterval);
+	writer.Write(m_waveTransitionTimer);
+	writer.Write(m_isInTransition);
+	writer.WriteVector(m_spawnTable);
+	writer.Write(m_hasPreparedWave);
+	writer.WriteVector(m_preparedSpawns);
+	writer.Write(static_cast<uint32_t>(m_nextPreparedSpawn));
+}
+
+//-----------------------------------------------------------------------------------------------
+// ReadSnapshot - Must mirror WriteSnapshot field for field
+//-----------------------------------------------------------------------------------------------
+void WaveManager::ReadSnapshot(SnapshotReader& reader)
+{
+	uint32_t nextPreparedSpawn = 0;
+
+	reader.Read(m_currentWaveNumber);
+	reader.Read(m_isWaveActive);
+	reader.Read(m_isBossActive);
+	reader.Read(m_remainingEnemies);
+	reader.Read(m_totalEnemiesInWave);
+	reader.Read(m_enemiesSpawnedThisWave);
+	reader.Read(m_spawnTimer);
+	reader.Read(m_spawnInterval);
+	reader.Read(m_waveTransitionTimer);
+	reader.Read(m_isInTransition);
+	reader.ReadVector(m_spawnTable);
+	reader.Read(m_hasPreparedWave);
+	reader.ReadVector(m_preparedSpawns);
+	reader.Read(nextPreparedSpawn);
+
+	m_nextPreparedSpawn = (std::min)(static_cast<size_t>(nextPreparedSpawn), m_preparedSpawns.size());
+}
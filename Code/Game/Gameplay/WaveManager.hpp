@@ -7,10 +7,14 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Framework/GameCommon.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Engine/Math/Vec2.hpp"
+//----------------------------------------------------------------------------------------------------
 #include <vector>
 
 //----------------------------------------------------------------------------------------------------
 class Game;
+class SnapshotReader;
+class SnapshotWriter;
 
 //----------------------------------------------------------------------------------------------------
 // Enemy type identifiers for spawn weight system
@@ -44,6 +48,16 @@ struct SpawnWeightEntry
 	int        weight = 1;
 };
 
+//----------------------------------------------------------------------------------------------------
+// Prepared spawn: everything rolled for one enemy of the next wave while the transition runs
+//----------------------------------------------------------------------------------------------------
+struct PreparedSpawn
+{
+	eEnemyType type           = eEnemyType::TRIANGLE;
+	Vec2       position       = Vec2::ZERO;
+	bool       hasChildWindow = false;
+};
+
 //----------------------------------------------------------------------------------------------------
 // WaveManager Class
 // Manages wave-based enemy spawning system with progressive difficulty
@@ -61,6 +75,10 @@ public:
 	void CompleteWave();
 	void Reset();
 
+	// Rewind / retry snapshots (wave state only; configuration is not captured)
+	void WriteSnapshot(SnapshotWriter& writer) const;
+	void ReadSnapshot(SnapshotReader& reader);
+
 	// Spawn weight system
 	eEnemyType SelectRandomEnemyType() const;
 
@@ -73,11 +91,23 @@ public:
 	int  GetTotalEnemiesInWave() const { return m_totalEnemiesInWave; }
 	std::vector<SpawnWeightEntry> const& GetSpawnTable() const { return m_spawnTable; }
 
+	// Next-wave schedule precomputed during the transition, and wave-start frame time measurement
+	void  SetPrecomputeEnabled(bool isEnabled) { m_isPrecomputeEnabled = isEnabled; }
+	bool  IsPrecomputeEnabled() const { return m_isPrecomputeEnabled; }
+	float GetWaveStartWorstFrameSeconds() const { return m_waveStartWorstFrameSeconds; }     // Shown on the debug overlay
+	bool  IsMeasuringWaveStart() const { return m_isWaveActive && m_waveStartMeasureTimer < m_waveStartMeasureDuration; }
+
 private:
 	// Spawn table management
-	void BuildSpawnTable();
+	void BuildSpawnTable(int waveNumber);
 	int  GetTotalSpawnWeight() const;
 	int  CountAliveEnemies() const;
+	int  CalculateEnemiesForWave(int waveNumber) const;
+
+	// Schedule precompute / measurement
+	void PrepareNextWave();
+	void SpawnNextEnemy();
+	void MeasureWaveStartFrame();
 
 	// Game reference
 	Game* m_game = nullptr;
@@ -107,4 +137,15 @@ private:
 
 	// Spawn weight table for current wave
 	std::vector<SpawnWeightEntry> m_spawnTable;
+
+	// Next wave's schedule, precomputed on the main thread during the transition and consumed in order by the spawn timer
+	bool                       m_isPrecomputeEnabled = true;
+	bool                       m_hasPreparedWave     = false;
+	std::vector<PreparedSpawn> m_preparedSpawns;
+	size_t                     m_nextPreparedSpawn   = 0;
+
+	// Worst real frame time seen right after StartWave (compare with precompute on / off)
+	float m_waveStartMeasureTimer      = 0.0f;
+	float m_waveStartMeasureDuration   = 3.0f;   // Seconds after StartWave that count as "wave start"
+	float m_waveStartWorstFrameSeconds = 0.0f;
 };
@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------------------------------
+// AudioBackend.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Audio/AudioBackend.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+SoundPlaybackID EngineAudioBackend::StartSound(SoundID const soundID,
+                                               float const   volume,
+                                               float const   balance,
+                                               float const   speed)
+{
+    return g_audio->StartSound(soundID, false, volume, balance, speed);
+}
+
+void EngineAudioBackend::StopSound(SoundPlaybackID const playbackID)
+{
+    g_audio->StopSound(playbackID);
+}
+
+bool EngineAudioBackend::IsPlaying(SoundPlaybackID const playbackID) const
+{
+    return g_audio->IsPlaying(playbackID);
+}
+
+//----------------------------------------------------------------------------------------------------
+SoundPlaybackID NullAudioBackend::StartSound(SoundID const soundID,
+                                             float const   volume,
+                                             float const   balance,
+                                             float const   speed)
+{
+    UNUSED(soundID)
+    UNUSED(balance)
+    UNUSED(speed)
+
+    ++m_startSoundCount;
+    m_lastStartVolume = volume;
+
+    SoundPlaybackID const playbackID = m_nextPlaybackID++;
+    m_playingVoices.insert(playbackID);
+    return playbackID;
+}
+
+void NullAudioBackend::StopSound(SoundPlaybackID const playbackID)
+{
+    ++m_stopSoundCount;
+    m_playingVoices.erase(playbackID);
+}
+
+bool NullAudioBackend::IsPlaying(SoundPlaybackID const playbackID) const
+{
+    return m_playingVoices.contains(playbackID);
+}
@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------------------------------
+// AudioBackend.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <unordered_set>
+
+#include "Engine/Audio/AudioSystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// IAudioBackend
+// The only place AudioRequestQueue reaches the audio device. A null implementation can be plugged in
+// through sAudioRequestQueueConfig to count voices without FMOD or a sound card.
+//----------------------------------------------------------------------------------------------------
+class IAudioBackend
+{
+public:
+    virtual ~IAudioBackend() = default;
+
+    virtual SoundPlaybackID StartSound(SoundID soundID, float volume, float balance, float speed) = 0;
+    virtual void            StopSound(SoundPlaybackID playbackID) = 0;
+    virtual bool            IsPlaying(SoundPlaybackID playbackID) const = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// EngineAudioBackend
+// Default backend used by the game; forwards to g_audio.
+//----------------------------------------------------------------------------------------------------
+class EngineAudioBackend : public IAudioBackend
+{
+public:
+    SoundPlaybackID StartSound(SoundID soundID, float volume, float balance, float speed) override;
+    void            StopSound(SoundPlaybackID playbackID) override;
+    bool            IsPlaying(SoundPlaybackID playbackID) const override;
+};
+
+//----------------------------------------------------------------------------------------------------
+// NullAudioBackend
+// Plays nothing; voices stay "playing" until stopped or FinishAllVoices() is called.
+//----------------------------------------------------------------------------------------------------
+class NullAudioBackend : public IAudioBackend
+{
+public:
+    SoundPlaybackID StartSound(SoundID soundID, float volume, float balance, float speed) override;
+    void            StopSound(SoundPlaybackID playbackID) override;
+    bool            IsPlaying(SoundPlaybackID playbackID) const override;
+
+    void   FinishAllVoices() { m_playingVoices.clear(); }
+    size_t GetStartSoundCount() const { return m_startSoundCount; }
+    size_t GetStopSoundCount() const { return m_stopSoundCount; }
+    float  GetLastStartVolume() const { return m_lastStartVolume; }
+
+private:
+    std::unordered_set<SoundPlaybackID> m_playingVoices;
+    SoundPlaybackID                     m_nextPlaybackID  = 1;
+    size_t                              m_startSoundCount = 0;
+    size_t                              m_stopSoundCount  = 0;
+    float                               m_lastStartVolume = 0.f;
+};
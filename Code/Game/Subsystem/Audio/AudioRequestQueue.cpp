@@ -0,0 +1,121 @@
+//----------------------------------------------------------------------------------------------------
+// AudioRequestQueue.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Audio/AudioRequestQueue.hpp"
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+AudioRequestQueue::AudioRequestQueue(sAudioRequestQueueConfig const& config)
+    : m_config(config)
+{
+    if (m_config.m_backend == nullptr)
+    {
+        m_ownedBackend = std::make_unique<EngineAudioBackend>();
+    }
+
+    m_backend = m_config.m_backend != nullptr ? m_config.m_backend : m_ownedBackend.get();
+}
+
+void AudioRequestQueue::RequestSound(SoundID const soundID,
+                                     float const   volume,
+                                     float const   balance,
+                                     float const   speed)
+{
+    ++m_requestCount;
+
+    // A frame only ever has a handful of distinct sounds, so a linear scan beats hashing
+    for (AudioRequestData& request : m_pendingRequests)
+    {
+        if (request.m_soundID != soundID) continue;
+
+        request.m_volume = (std::max)(request.m_volume, volume);
+        ++request.m_requestCount;
+        return;
+    }
+
+    m_pendingRequests.push_back(AudioRequestData{soundID, volume, balance, speed, 1});
+}
+
+void AudioRequestQueue::SetSoundLimit(SoundID const           soundID,
+                                      int const               maxVoices,
+                                      eVoiceStealPolicy const stealPolicy)
+{
+    SoundVoiceData& voiceData = GetOrCreateVoiceData(soundID);
+    voiceData.m_maxVoices     = (std::max)(maxVoices, 1);
+    voiceData.m_stealPolicy   = stealPolicy;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Flush - Requests are resolved in the order they were first made this frame
+//----------------------------------------------------------------------------------------------------
+void AudioRequestQueue::Flush()
+{
+    m_requestCountLastFrame       = m_requestCount;
+    m_startedVoiceCountLastFrame  = 0;
+    m_rejectedVoiceCountLastFrame = 0;
+    m_stolenVoiceCountLastFrame   = 0;
+    m_requestCount                = 0;
+
+    for (AudioRequestData const& request : m_pendingRequests)
+    {
+        SoundVoiceData& voiceData = GetOrCreateVoiceData(request.m_soundID);
+        PruneFinishedVoices(voiceData);
+
+        if (static_cast<int>(voiceData.m_activeVoices.size()) >= voiceData.m_maxVoices)
+        {
+            if (voiceData.m_stealPolicy == eVoiceStealPolicy::REJECT_NEW)
+            {
+                ++m_rejectedVoiceCountLastFrame;
+                continue;
+            }
+
+            m_backend->StopSound(voiceData.m_activeVoices.front());
+            voiceData.m_activeVoices.erase(voiceData.m_activeVoices.begin());
+            ++m_stolenVoiceCountLastFrame;
+        }
+
+        float const coalescedScale = (std::min)(1.f + m_config.m_volumePerCoalescedRequest * static_cast<float>(request.m_requestCount - 1), m_config.m_maxCoalescedVolumeScale);
+
+        SoundPlaybackID const playbackID = m_backend->StartSound(request.m_soundID, request.m_volume * coalescedScale, request.m_balance, request.m_speed);
+        voiceData.m_activeVoices.push_back(playbackID);
+        ++m_startedVoiceCountLastFrame;
+    }
+
+    m_pendingRequests.clear();
+}
+
+void AudioRequestQueue::StopAll()
+{
+    for (auto& [soundID, voiceData] : m_voices)
+    {
+        for (SoundPlaybackID const playbackID : voiceData.m_activeVoices)
+        {
+            m_backend->StopSound(playbackID);
+        }
+        voiceData.m_activeVoices.clear();
+    }
+
+    m_pendingRequests.clear();
+}
+
+SoundVoiceData& AudioRequestQueue::GetOrCreateVoiceData(SoundID const soundID)
+{
+    auto [voiceIt, isNew] = m_voices.try_emplace(soundID);
+    if (isNew)
+    {
+        voiceIt->second.m_maxVoices   = (std::max)(m_config.m_defaultMaxVoices, 1);
+        voiceIt->second.m_stealPolicy = m_config.m_defaultStealPolicy;
+    }
+    return voiceIt->second;
+}
+
+void AudioRequestQueue::PruneFinishedVoices(SoundVoiceData& voiceData) const
+{
+    std::erase_if(voiceData.m_activeVoices, [this](SoundPlaybackID const playbackID)
+    {
+        return !m_backend->IsPlaying(playbackID);
+    });
+}
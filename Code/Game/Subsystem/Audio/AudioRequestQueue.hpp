@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------------------------------
+// AudioRequestQueue.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Game/Subsystem/Audio/AudioBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eVoiceStealPolicy : uint8_t
+{
+    STEAL_OLDEST,     // Stop the longest-running voice of the sound to make room
+    REJECT_NEW,       // Drop the new request while every voice is busy
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioRequestQueueConfig
+{
+    IAudioBackend*    m_backend                   = nullptr;     // Optional; AudioRequestQueue owns an EngineAudioBackend when nullptr
+    int               m_defaultMaxVoices          = 4;           // Concurrent voices per SoundID unless SetSoundLimit says otherwise
+    eVoiceStealPolicy m_defaultStealPolicy        = eVoiceStealPolicy::STEAL_OLDEST;
+    float             m_volumePerCoalescedRequest = 0.1f;        // Extra volume for every duplicate folded into one voice
+    float             m_maxCoalescedVolumeScale   = 2.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+// One sound requested this frame; duplicates of the same SoundID are folded into it
+//----------------------------------------------------------------------------------------------------
+struct AudioRequestData
+{
+    SoundID m_soundID      = 0;
+    float   m_volume       = 1.f;
+    float   m_balance      = 0.f;
+    float   m_speed        = 1.f;
+    int     m_requestCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct SoundVoiceData
+{
+    int                          m_maxVoices   = 0;
+    eVoiceStealPolicy            m_stealPolicy = eVoiceStealPolicy::STEAL_OLDEST;
+    std::vector<SoundPlaybackID> m_activeVoices;     // Oldest first
+};
+
+//----------------------------------------------------------------------------------------------------
+// AudioRequestQueue
+// Gameplay one-shots are requested here instead of started directly. Identical requests in a frame
+// become one voice whose volume grows with the number of requests, each SoundID is held to a
+// concurrent voice limit, and Flush() starts everything once per frame after the game update.
+// Looping music keeps using g_audio directly since it needs to hold on to its playback ID.
+//----------------------------------------------------------------------------------------------------
+class AudioRequestQueue
+{
+public:
+    explicit AudioRequestQueue(sAudioRequestQueueConfig const& config);
+
+    void RequestSound(SoundID soundID, float volume = 1.f, float balance = 0.f, float speed = 1.f);
+    void SetSoundLimit(SoundID soundID, int maxVoices, eVoiceStealPolicy stealPolicy);
+    void Flush();
+    void StopAll();
+
+    // Instrumentation
+    size_t GetRequestCountLastFrame() const { return m_requestCountLastFrame; }
+    size_t GetStartedVoiceCountLastFrame() const { return m_startedVoiceCountLastFrame; }
+    size_t GetRejectedVoiceCountLastFrame() const { return m_rejectedVoiceCountLastFrame; }
+    size_t GetStolenVoiceCountLastFrame() const { return m_stolenVoiceCountLastFrame; }
+
+private:
+    SoundVoiceData& GetOrCreateVoiceData(SoundID soundID);
+    void            PruneFinishedVoices(SoundVoiceData& voiceData) const;
+
+    sAudioRequestQueueConfig                    m_config;
+    std::unique_ptr<IAudioBackend>              m_ownedBackend;
+    IAudioBackend*                              m_backend = nullptr;
+    std::vector<AudioRequestData>               m_pendingRequests;     // Request order, one entry per SoundID
+    std::unordered_map<SoundID, SoundVoiceData> m_voices;
+
+    size_t m_requestCount                = 0;
+    size_t m_requestCountLastFrame       = 0;
+    size_t m_startedVoiceCountLastFrame  = 0;
+    size_t m_rejectedVoiceCountLastFrame = 0;
+    size_t m_stolenVoiceCountLastFrame   = 0;
+};
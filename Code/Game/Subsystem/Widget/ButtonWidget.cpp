@@ -5,7 +5,9 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Subsystem/Widget/ButtonWidget.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameArena.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/MemoryTracker.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
@@ -28,12 +30,20 @@ ButtonWidget::ButtonWidget([[maybe_unused]] WidgetSubsystem* owner,
       m_color(color)
 {
     SetName("ButtonWidget_" + text);
+
+    // Widgets are created by the engine's WidgetSubsystem, so the object is charged here rather than in operator new
+    MemoryTracker::RecordAllocation(eMemoryTag::WIDGET, sizeof(ButtonWidget));
+}
+
+ButtonWidget::~ButtonWidget()
+{
+    MemoryTracker::RecordFree(eMemoryTag::WIDGET, sizeof(ButtonWidget));
 }
 
 void ButtonWidget::Draw() const
 {
-    VertexList_PCU verts;
-    BitmapFont*    bitmapFont = g_resourceSubsystem->CreateOrGetBitmapFontFromFile("Data/Fonts/DaemonFont");
+    VertexList_PCU& verts = g_frameArena->AcquireVertexList();
+    BitmapFont*     bitmapFont = g_resourceSubsystem->CreateOrGetBitmapFontFromFile("Data/Fonts/DaemonFont");
     bitmapFont->AddVertsForTextInBox2D(verts, m_text, AABB2(Vec2(m_x, m_y), Vec2(m_x + m_width, m_y + m_height)), 20.f, m_color, 1.f, Vec2(1, 0), eTextBoxMode::OVERRUN);
     g_renderer->BindTexture(&bitmapFont->GetTexture());
     g_renderer->DrawVertexArray(verts);
@@ -43,9 +53,11 @@ void ButtonWidget::Update()
 {
 }
 
-void ButtonWidget::SetText(String const& text)
+void ButtonWidget::SetText(std::string_view const text)
 {
-    m_text = text;
+    if (m_text == text) return;
+
+    m_text.assign(text);
 }
 
 String ButtonWidget::GetText() const
@@ -4,6 +4,8 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
+#include <string_view>
+
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Widget/IWidget.hpp"
@@ -13,11 +15,12 @@ class ButtonWidget : public IWidget
 {
 public:
     ButtonWidget(WidgetSubsystem* owner, String const& text, int x, int y, int width, int height, Rgba8 const& color);
+    ~ButtonWidget();
 
     void Draw() const override;
     void Update() override;
 
-    void   SetText(String const& text);
+    void   SetText(std::string_view text);     // No-op when the text is unchanged, so per-frame labels do not reallocate
     String GetText() const;
     void   SetPosition(Vec2 const& newPosition);
     void   SetDimensions(Vec2 const& newDimensions);
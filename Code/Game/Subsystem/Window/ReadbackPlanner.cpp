@@ -0,0 +1,164 @@
+//----------------------------------------------------------------------------------------------------
+// ReadbackPlanner.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Window/ReadbackPlanner.hpp"
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+bool ReadbackPlanner::DoRectsTouch(sPixelRect const& a, sPixelRect const& b)
+{
+    return a.m_left <= b.m_right && b.m_left <= a.m_right &&
+        a.m_top <= b.m_bottom && b.m_top <= a.m_bottom;
+}
+
+bool ReadbackPlanner::DoRectsOverlap(sPixelRect const& a, sPixelRect const& b)
+{
+    return a.m_left < b.m_right && b.m_left < a.m_right &&
+        a.m_top < b.m_bottom && b.m_top < a.m_bottom;
+}
+
+sPixelRect ReadbackPlanner::GetUnion(sPixelRect const& a, sPixelRect const& b)
+{
+    sPixelRect result;
+    result.m_left   = std::min(a.m_left, b.m_left);
+    result.m_top    = std::min(a.m_top, b.m_top);
+    result.m_right  = std::max(a.m_right, b.m_right);
+    result.m_bottom = std::max(a.m_bottom, b.m_bottom);
+    return result;
+}
+
+sPixelRect ReadbackPlanner::GetIntersection(sPixelRect const& a, sPixelRect const& b)
+{
+    sPixelRect result;
+    result.m_left   = std::max(a.m_left, b.m_left);
+    result.m_top    = std::max(a.m_top, b.m_top);
+    result.m_right  = std::min(a.m_right, b.m_right);
+    result.m_bottom = std::min(a.m_bottom, b.m_bottom);
+    return result;
+}
+
+sPixelRect ReadbackPlanner::GetClipped(sPixelRect const& rect, int const backbufferWidth, int const backbufferHeight)
+{
+    sPixelRect result;
+    result.m_left   = std::clamp(rect.m_left, 0, backbufferWidth);
+    result.m_top    = std::clamp(rect.m_top, 0, backbufferHeight);
+    result.m_right  = std::clamp(rect.m_right, 0, backbufferWidth);
+    result.m_bottom = std::clamp(rect.m_bottom, 0, backbufferHeight);
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+// GetRectMinusRect - Full-width bands above and below the cut, then the pieces left and right of it
+//----------------------------------------------------------------------------------------------------
+int ReadbackPlanner::GetRectMinusRect(sPixelRect const& rect, sPixelRect const& cut, sPixelRect outPieces[4])
+{
+    sPixelRect const overlap = GetIntersection(rect, cut);
+    if (overlap.IsEmpty())
+    {
+        outPieces[0] = rect;
+        return 1;
+    }
+
+    sPixelRect const candidates[4] =
+    {
+        {rect.m_left, rect.m_top, rect.m_right, overlap.m_top},
+        {rect.m_left, overlap.m_bottom, rect.m_right, rect.m_bottom},
+        {rect.m_left, overlap.m_top, overlap.m_left, overlap.m_bottom},
+        {overlap.m_right, overlap.m_top, rect.m_right, overlap.m_bottom},
+    };
+
+    int pieceCount = 0;
+    for (sPixelRect const& candidate : candidates)
+    {
+        if (!candidate.IsEmpty()) outPieces[pieceCount++] = candidate;
+    }
+    return pieceCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// MergeTouchingRects - Two rects merge only when their bounding box adds no pixel neither of them
+// covers, which holds for rects sharing a full edge or nested ones, but not for crossing or corner-
+// touching rects (a 100 x 1000 and a 1000 x 100 cross would become 1000 x 1000). Overlaps that stay
+// separate have the shared pixels cut out of one of the two. Cuts shrink the summed area, merges
+// never grow it and lower the count, so the loop ends.
+//----------------------------------------------------------------------------------------------------
+void ReadbackPlanner::MergeTouchingRects(std::vector<sPixelRect>& inOutRects)
+{
+    bool hasChanged = true;
+
+    while (hasChanged)
+    {
+        hasChanged = false;
+
+        for (size_t i = 0; i < inOutRects.size(); ++i)
+        {
+            for (size_t j = i + 1; j < inOutRects.size();)
+            {
+                sPixelRect const a = inOutRects[i];
+                sPixelRect const b = inOutRects[j];
+
+                if (!DoRectsTouch(a, b))
+                {
+                    ++j;
+                    continue;
+                }
+
+                sPixelRect const combined = GetUnion(a, b);
+                if (combined.GetArea() <= a.GetArea() + b.GetArea() - GetIntersection(a, b).GetArea())
+                {
+                    inOutRects[i] = combined;
+                    inOutRects[j] = inOutRects.back();
+                    inOutRects.pop_back();
+                    hasChanged = true;
+                    continue;
+                }
+
+                if (!DoRectsOverlap(a, b))
+                {
+                    ++j;
+                    continue;
+                }
+
+                // Replace b by what is left of it outside a; slot j now holds another rect, so j stays
+                sPixelRect pieces[4];
+                int const  pieceCount = GetRectMinusRect(b, a, pieces);
+
+                inOutRects[j] = inOutRects.back();
+                inOutRects.pop_back();
+                inOutRects.insert(inOutRects.end(), pieces, pieces + pieceCount);
+                hasChanged = true;
+            }
+        }
+    }
+}
+
+void ReadbackPlanner::BuildReadbackPlan(std::vector<sPixelRect>& rects,
+                                        int const                backbufferWidth,
+                                        int const                backbufferHeight,
+                                        int const                bytesPerPixel,
+                                        sReadbackPlan&           outPlan)
+{
+    outPlan.m_rects.clear();
+    outPlan.m_bytesToCopy    = 0;
+    outPlan.m_fullFrameBytes = static_cast<size_t>(backbufferWidth) * static_cast<size_t>(backbufferHeight) * static_cast<size_t>(bytesPerPixel);
+
+    for (sPixelRect const& rect : rects)
+    {
+        sPixelRect const clipped = GetClipped(rect, backbufferWidth, backbufferHeight);
+        if (!clipped.IsEmpty())
+        {
+            outPlan.m_rects.push_back(clipped);
+        }
+    }
+
+    rects.clear();
+    MergeTouchingRects(outPlan.m_rects);
+
+    for (sPixelRect const& rect : outPlan.m_rects)
+    {
+        outPlan.m_bytesToCopy += rect.GetArea() * static_cast<size_t>(bytesPerPixel);
+    }
+}
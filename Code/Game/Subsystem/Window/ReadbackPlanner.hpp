@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------------------------------
+// ReadbackPlanner.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Pixel rect in backbuffer space (top-left origin, right / bottom exclusive)
+//----------------------------------------------------------------------------------------------------
+struct sPixelRect
+{
+    int m_left   = 0;
+    int m_top    = 0;
+    int m_right  = 0;
+    int m_bottom = 0;
+
+    int    GetWidth() const { return m_right - m_left; }
+    int    GetHeight() const { return m_bottom - m_top; }
+    bool   IsEmpty() const { return m_right <= m_left || m_bottom <= m_top; }
+    size_t GetArea() const { return IsEmpty() ? 0 : static_cast<size_t>(GetWidth()) * static_cast<size_t>(GetHeight()); }
+};
+
+//----------------------------------------------------------------------------------------------------
+// Rects to read back from the staging texture this frame, and what that costs
+//----------------------------------------------------------------------------------------------------
+struct sReadbackPlan
+{
+    std::vector<sPixelRect> m_rects;
+    size_t                  m_bytesToCopy    = 0;
+    size_t                  m_fullFrameBytes = 0;
+
+    bool IsEmpty() const { return m_rects.empty(); }
+};
+
+//----------------------------------------------------------------------------------------------------
+// ReadbackPlanner
+// Platform-independent planning of which backbuffer pixels the child windows need. Client rects are
+// clipped to the backbuffer, then merged where the union costs no extra pixels and split where they
+// overlap, so the plan covers exactly the visible pixels and none twice.
+//
+// The engine only reads back the whole staging texture, so WindowSubsystem uses the plan to skip
+// the readback when it is empty and reports m_bytesToCopy as what a region copy would move.
+//----------------------------------------------------------------------------------------------------
+namespace ReadbackPlanner
+{
+    bool       DoRectsTouch(sPixelRect const& a, sPixelRect const& b);       // Overlapping or sharing an edge or corner
+    bool       DoRectsOverlap(sPixelRect const& a, sPixelRect const& b);     // At least one pixel in both
+    sPixelRect GetUnion(sPixelRect const& a, sPixelRect const& b);
+    sPixelRect GetIntersection(sPixelRect const& a, sPixelRect const& b);
+    sPixelRect GetClipped(sPixelRect const& rect, int backbufferWidth, int backbufferHeight);
+    int        GetRectMinusRect(sPixelRect const& rect, sPixelRect const& cut, sPixelRect outPieces[4]);     // Returns the piece count
+
+    // In place; afterwards no two rects overlap and no two touching rects could merge for free
+    void MergeTouchingRects(std::vector<sPixelRect>& inOutRects);
+
+    // Clips, merges and sizes the copy; rects is scratch storage and is consumed
+    void BuildReadbackPlan(std::vector<sPixelRect>& rects,
+                           int                      backbufferWidth,
+                           int                      backbufferHeight,
+                           int                      bytesPerPixel,
+                           sReadbackPlan&           outPlan);
+}
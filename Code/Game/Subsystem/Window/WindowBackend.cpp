@@ -0,0 +1,208 @@
+//----------------------------------------------------------------------------------------------------
+// WindowBackend.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Window/WindowBackend.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <utility>
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Platform/Window.hpp"
+
+//----------------------------------------------------------------------------------------------------
+std::unique_ptr<IWindowBackend> CreatePlatformWindowBackend(wchar_t const* iconFilePath)
+{
+    return std::make_unique<Win32WindowBackend>(iconFilePath);
+}
+
+//----------------------------------------------------------------------------------------------------
+Win32WindowBackend::Win32WindowBackend(wchar_t const* iconFilePath)
+    : m_iconFilePath(iconFilePath)
+{
+}
+
+void* Win32WindowBackend::CreateNativeWindow(String const& title,
+                                             int const     x,
+                                             int const     y,
+                                             int const     width,
+                                             int const     height)
+{
+    // Convert title to wide string
+    std::wstring wTitle;
+    wTitle.resize(title.size());
+    MultiByteToWideChar(CP_UTF8, 0, title.c_str(), static_cast<int>(title.size()), wTitle.data(), static_cast<int>(wTitle.size()));
+
+    // Register window class (only once)
+    static bool classRegistered = false;
+    if (!classRegistered)
+    {
+        WNDCLASS wc      = {};
+        wc.lpfnWndProc   = reinterpret_cast<WNDPROC>(GetWindowLongPtr(static_cast<HWND>(Window::s_mainWindow->GetWindowHandle()), GWLP_WNDPROC));
+        wc.hInstance     = GetModuleHandle(nullptr);
+        wc.lpszClassName = L"ChildWindow";
+        wc.hbrBackground = reinterpret_cast<HBRUSH>(COLOR_WINDOW + 1);
+        wc.hCursor       = LoadCursor(nullptr, IDC_ARROW);
+        wc.hIcon         = static_cast<HICON>(LoadImage(
+            nullptr,
+            m_iconFilePath,
+            IMAGE_ICON,
+            32, 32,
+            LR_LOADFROMFILE
+        ));
+        RegisterClass(&wc);
+        classRegistered = true;
+    }
+
+    // Adjust window size so the client area matches the specified width and height
+    RECT rect = {0, 0, width, height};
+    AdjustWindowRectEx(&rect, WS_OVERLAPPEDWINDOW, FALSE, 0);
+
+    int adjustedWidth  = rect.right - rect.left;
+    int adjustedHeight = rect.bottom - rect.top;
+
+    HWND hwnd = CreateWindowEx(
+        0,
+        L"ChildWindow",
+        wTitle.c_str(),
+        WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU,
+        x, y, adjustedWidth, adjustedHeight,
+        nullptr,
+        nullptr,
+        GetModuleHandle(nullptr),
+        nullptr
+    );
+
+    return hwnd;
+}
+
+void Win32WindowBackend::PlaceNativeWindow(void* windowHandle, int const x, int const y, int const width, int const height)
+{
+    // Same frame adjustment as CreateNativeWindow, so a recycled window's client area lands where a new one's would
+    RECT rect = {0, 0, width, height};
+    AdjustWindowRectEx(&rect, WS_OVERLAPPEDWINDOW, FALSE, 0);
+
+    SetWindowPos(static_cast<HWND>(windowHandle), nullptr, x, y, rect.right - rect.left, rect.bottom - rect.top, SWP_NOZORDER | SWP_NOOWNERZORDER | SWP_NOACTIVATE);
+}
+
+void* Win32WindowBackend::GetNativeDisplayContext(void* windowHandle)
+{
+    return GetDC(static_cast<HWND>(windowHandle));
+}
+
+void Win32WindowBackend::GetNativeClientRect(void* windowHandle, Vec2& outClientPosition, Vec2& outClientDimensions)
+{
+    HWND const hwnd = static_cast<HWND>(windowHandle);
+
+    // Get client rectangle in client coordinates
+    RECT clientRect;
+    GetClientRect(hwnd, &clientRect);
+
+    // Convert client area top-left corner to screen coordinates
+    POINT clientTopLeft = {0, 0};
+    ClientToScreen(hwnd, &clientTopLeft);
+
+    int const clientWidth  = clientRect.right - clientRect.left;
+    int const clientHeight = clientRect.bottom - clientRect.top;
+    int const screenHeight = GetSystemMetrics(SM_CYSCREEN);
+
+    // Flip Y for the engine coordinate system (bottom-left origin)
+    outClientPosition   = Vec2(static_cast<float>(clientTopLeft.x), static_cast<float>(screenHeight - (clientTopLeft.y + clientHeight)));
+    outClientDimensions = Vec2(static_cast<float>(clientWidth), static_cast<float>(clientHeight));
+}
+
+void Win32WindowBackend::ShowNativeWindow(void* windowHandle, bool const isVisible)
+{
+    ShowWindow(static_cast<HWND>(windowHandle), isVisible ? SW_SHOW : SW_HIDE);
+}
+
+void Win32WindowBackend::SetNativeWindowTitle(void* windowHandle, String const& title)
+{
+    std::wstring wTitle;
+    wTitle.resize(title.size());
+    MultiByteToWideChar(CP_UTF8, 0, title.c_str(), static_cast<int>(title.size()), wTitle.data(), static_cast<int>(wTitle.size()));
+
+    SetWindowTextW(static_cast<HWND>(windowHandle), wTitle.c_str());
+}
+
+void Win32WindowBackend::CommitWindowGeometry(std::vector<sWindowGeometry> const& geometries)
+{
+    if (geometries.empty()) return;
+
+    int const screenHeight = GetSystemMetrics(SM_CYSCREEN);
+    UINT const flags       = SWP_NOZORDER | SWP_NOOWNERZORDER | SWP_NOACTIVATE;
+
+    HDWP deferHandle = BeginDeferWindowPos(static_cast<int>(geometries.size()));
+
+    for (sWindowGeometry const& geometry : geometries)
+    {
+        HWND const hwnd = static_cast<HWND>(geometry.m_windowHandle);
+
+        // Flip the client rect back to Win32 top-left space and grow it by the window frame
+        int const clientWidth  = static_cast<int>(std::lround(geometry.m_clientDimensions.x));
+        int const clientHeight = static_cast<int>(std::lround(geometry.m_clientDimensions.y));
+        int const clientLeft   = static_cast<int>(std::lround(geometry.m_clientPosition.x));
+        int const clientTop    = screenHeight - static_cast<int>(std::lround(geometry.m_clientPosition.y)) - clientHeight;
+
+        RECT rect = {clientLeft, clientTop, clientLeft + clientWidth, clientTop + clientHeight};
+        AdjustWindowRectEx(&rect, static_cast<DWORD>(GetWindowLong(hwnd, GWL_STYLE)), FALSE, static_cast<DWORD>(GetWindowLong(hwnd, GWL_EXSTYLE)));
+
+        int const x      = rect.left;
+        int const y      = rect.top;
+        int const width  = rect.right - rect.left;
+        int const height = rect.bottom - rect.top;
+
+        if (deferHandle != nullptr)
+        {
+            deferHandle = DeferWindowPos(deferHandle, hwnd, nullptr, x, y, width, height, flags);
+            if (deferHandle != nullptr) continue;
+        }
+
+        // DeferWindowPos frees the batch on failure, this window included; place it and the rest one by one
+        SetWindowPos(hwnd, nullptr, x, y, width, height, flags);
+    }
+
+    if (deferHandle != nullptr)
+    {
+        EndDeferWindowPos(deferHandle);
+    }
+}
+
+void Win32WindowBackend::SortTopmostFirst(std::vector<void*>& inOutWindowHandles)
+{
+    if (inOutWindowHandles.size() < 2) return;
+
+    m_zOrderByHandle.clear();
+    for (void* windowHandle : inOutWindowHandles)
+    {
+        m_zOrderByHandle.emplace_back(windowHandle, INT_MAX);
+    }
+
+    std::sort(m_zOrderByHandle.begin(), m_zOrderByHandle.end());
+
+    auto const findZOrder = [this](void* windowHandle)
+    {
+        return std::lower_bound(m_zOrderByHandle.begin(), m_zOrderByHandle.end(), std::pair<void*, int>(windowHandle, INT_MIN));
+    };
+
+    // Walk top-level windows from the top of the z-order down, stopping once every handle is ranked
+    size_t rankedCount = 0;
+    int    rank        = 0;
+
+    for (HWND hwnd = GetTopWindow(nullptr); hwnd != nullptr && rankedCount < m_zOrderByHandle.size(); hwnd = GetWindow(hwnd, GW_HWNDNEXT), ++rank)
+    {
+        auto windowIt = findZOrder(hwnd);
+        if (windowIt == m_zOrderByHandle.end() || windowIt->first != hwnd) continue;
+
+        windowIt->second = rank;
+        ++rankedCount;
+    }
+
+    std::stable_sort(inOutWindowHandles.begin(), inOutWindowHandles.end(), [&findZOrder](void* a, void* b)
+    {
+        return findZOrder(a)->second < findZOrder(b)->second;
+    });
+}
@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------------------------------
+// WindowBackend.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Desired client rect of one child window, in engine screen space (bottom-left origin)
+//----------------------------------------------------------------------------------------------------
+struct sWindowGeometry
+{
+    void* m_windowHandle     = nullptr;
+    Vec2  m_clientPosition   = Vec2::ZERO;
+    Vec2  m_clientDimensions = Vec2::ZERO;
+};
+
+//----------------------------------------------------------------------------------------------------
+// IWindowBackend
+// Every call that reaches the OS for a child window goes through this interface. WindowSubsystem
+// only calls it when the committed state of a window actually changes, and a fake implementation
+// can be plugged in through sWindowSubsystemConfig to count OS calls without a real desktop.
+//----------------------------------------------------------------------------------------------------
+class IWindowBackend
+{
+public:
+    virtual ~IWindowBackend() = default;
+
+    virtual void* CreateNativeWindow(String const& title, int x, int y, int width, int height) = 0;                   // Created hidden
+    virtual void  PlaceNativeWindow(void* windowHandle, int x, int y, int width, int height) = 0;                     // Same placement as CreateNativeWindow
+    virtual void* GetNativeDisplayContext(void* windowHandle) = 0;
+    virtual void  GetNativeClientRect(void* windowHandle, Vec2& outClientPosition, Vec2& outClientDimensions) = 0;     // Engine screen space
+    virtual void  ShowNativeWindow(void* windowHandle, bool isVisible) = 0;
+    virtual void  SetNativeWindowTitle(void* windowHandle, String const& title) = 0;
+    virtual void  CommitWindowGeometry(std::vector<sWindowGeometry> const& geometries) = 0;                           // One batch per frame, changed windows only
+    virtual void  SortTopmostFirst(std::vector<void*>& inOutWindowHandles) = 0;                                       // Current OS z-order
+};
+
+//----------------------------------------------------------------------------------------------------
+// Win32WindowBackend
+// Default backend used by the game; geometry is committed with a single DeferWindowPos batch.
+//----------------------------------------------------------------------------------------------------
+class Win32WindowBackend : public IWindowBackend
+{
+public:
+    explicit Win32WindowBackend(wchar_t const* iconFilePath = nullptr);
+
+    void* CreateNativeWindow(String const& title, int x, int y, int width, int height) override;
+    void  PlaceNativeWindow(void* windowHandle, int x, int y, int width, int height) override;
+    void* GetNativeDisplayContext(void* windowHandle) override;
+    void  GetNativeClientRect(void* windowHandle, Vec2& outClientPosition, Vec2& outClientDimensions) override;
+    void  ShowNativeWindow(void* windowHandle, bool isVisible) override;
+    void  SetNativeWindowTitle(void* windowHandle, String const& title) override;
+    void  CommitWindowGeometry(std::vector<sWindowGeometry> const& geometries) override;
+    void  SortTopmostFirst(std::vector<void*>& inOutWindowHandles) override;
+
+private:
+    wchar_t const*                     m_iconFilePath = nullptr;
+    std::vector<std::pair<void*, int>> m_zOrderByHandle;     // Reused every frame by SortTopmostFirst; z-order rank per handle, sorted by handle
+};
+
+//----------------------------------------------------------------------------------------------------
+// Backend WindowSubsystem owns when sWindowSubsystemConfig::m_backend is nullptr; defined next to the
+// platform implementation so the subsystem itself carries no platform dependency
+//----------------------------------------------------------------------------------------------------
+std::unique_ptr<IWindowBackend> CreatePlatformWindowBackend(wchar_t const* iconFilePath);
@@ -5,18 +5,25 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Subsystem/Window/WindowSubsystem.hpp"
 
-#include <dxgi1_2.h>
+#include <algorithm>
+#include <cmath>
 
-#include "Engine/Core/Clock.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
-#include "Engine/Input/InputSystem.hpp"
-#include "Game/Gameplay/Game.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/FrameArena.hpp"
 
 //----------------------------------------------------------------------------------------------------
 WindowSubsystem::WindowSubsystem(sWindowSubsystemConfig const& config)
     : m_config(config)
 {
+    if (m_config.m_backend == nullptr)
+    {
+        m_ownedBackend = CreatePlatformWindowBackend(m_config.m_iconFilePath);
+    }
+
+    m_backend = m_config.m_backend != nullptr ? m_config.m_backend : m_ownedBackend.get();
 }
 
 void WindowSubsystem::StartUp()
@@ -25,12 +32,18 @@ void WindowSubsystem::StartUp()
 
 void WindowSubsystem::BeginFrame()
 {
+    m_lookupCountLastFrame = m_lookupCount;
+    m_lookupCount          = 0;
+    m_osCallCountLastFrame = m_osCallCount;
+    m_osCallCount          = 0;
 }
 
-void WindowSubsystem::Update()
+void WindowSubsystem::Update(float const deltaSeconds, bool const isGameplayRunning)
 {
-    if (g_game->GetCurrentGameState() == eGameState::SHOP || g_game->GetCurrentGameState() == eGameState::ATTRACT) return;
-    float const deltaSeconds = static_cast<float>(g_game->GetGameClock()->GetDeltaSeconds());
+    ResolveWindowGrowthRequests();
+
+    m_isGameplayRunning = isGameplayRunning;
+    if (!isGameplayRunning) return;
 
     UpdateWindowAnimations(deltaSeconds);
 
@@ -38,8 +51,6 @@ void WindowSubsystem::Update()
     {
         if (!windowData.m_isActive || !windowData.m_window) continue;
 
-        windowData.m_window->UpdatePosition();
-
         // NOTE: Swap chain resizing is disabled due to DirectX limitations
         // The Engine's UpdateDimension() has a bug that causes infinite resize loops
         // (it compares client rect dimensions to window dimensions, which are never equal)
@@ -52,18 +63,37 @@ void WindowSubsystem::Update()
     }
 }
 
-void WindowSubsystem::Render()
+void WindowSubsystem::Render(std::vector<sWindowGeometry> const& drawnGeometry)
 {
-    g_renderer->ReadStagingTextureToPixelData();
+    IndexWindowsByHandle();
+    CommitWindowGeometry(drawnGeometry);
 
-    for (auto& [windowId, windowData] : m_windowList)
+    // Only the pixels behind visible child windows are ever presented; nothing to read back without them
+    PlanStagingReadback();
+    ClassifyPresentVisibility();
+
+    m_skippedPresentCountLastFrame = 0;
+
+    if (m_readbackPlan.IsEmpty())
     {
-        if (!windowData.m_isActive || !windowData.m_window) continue;
+        m_readbackBytesLastFrame       = 0;
+        m_skippedPresentCountLastFrame = m_presentCandidates.size();
+        return;
+    }
 
-        if (windowData.m_window->m_shouldUpdatePosition)
+    // The engine copies the whole staging texture; the plan only decides whether a copy is needed at all
+    g_renderer->ReadStagingTextureToPixelData();
+    m_readbackBytesLastFrame = m_readbackPlan.m_fullFrameBytes;
+
+    for (size_t i = 0; i < m_presentCandidates.size(); ++i)
+    {
+        if (m_presentVisibility[i] != eWindowVisibility::VISIBLE)
         {
-            g_renderer->RenderViewportToWindow(*windowData.m_window);
+            ++m_skippedPresentCountLastFrame;
+            continue;
         }
+
+        PresentWindow(*m_presentCandidates[i]);
     }
 }
 
@@ -106,9 +136,9 @@ WindowID WindowSubsystem::CreateChildWindow(EntityID const owner,
         return existingIt->second;
     }
 
-    HWND hwnd = CreateOSWindow(windowTitle, x, y, width, height);
+    WindowData windowData = AcquireWindowData(windowTitle, x, y, width, height);
 
-    if (!hwnd)
+    if (!windowData.m_window)
     {
         DebuggerPrintf("CreateWindowInternal: Failed to create OS window.\n");
         return INVALID_WINDOW_ID;
@@ -116,41 +146,39 @@ WindowID WindowSubsystem::CreateChildWindow(EntityID const owner,
 
     WindowID newId = m_nextWindowID++;
 
-    sWindowConfig config;
-    config.m_windowType  = eWindowType::WINDOWED;
-    config.m_aspectRatio = static_cast<float>(width) / static_cast<float>(height);
-    config.m_windowTitle = windowTitle;
-
-    std::unique_ptr<Window> newWindow = std::make_unique<Window>(config);
-
-    newWindow->SetWindowHandle(hwnd);
-    newWindow->SetDisplayContext(GetDC(hwnd));
-
-    newWindow->SetWindowDimensions(Vec2(static_cast<float>(width), static_cast<float>(height)));
-    newWindow->SetWindowPosition(Vec2(static_cast<float>(x), static_cast<float>(y)));
-    newWindow->m_shouldUpdatePosition = true;
-
-    // Initialize client position to prevent crash when GetClientPosition() is called
-    InitializeWindowClientPosition(newWindow.get(), hwnd);
-
-    std::unordered_set const ownerSet = {owner};
-    WindowData               windowData;
-    windowData.m_window = std::move(newWindow);
-    windowData.m_owners = ownerSet;
+    windowData.m_owners = {owner};
     windowData.m_name   = windowTitle;
     m_windowList.emplace(newId, std::move(windowData));
 
     m_actorToWindow[owner] = newId;
 
-    if (g_renderer)
+    CommitWindowVisibility(m_windowList[newId], true);
+
+    DebuggerPrintf("CreateWindowInternal: Created window %d '%s' for actor %llu.\n", newId, windowTitle.c_str(), static_cast<unsigned long long>(owner));
+    return newId;
+}
+
+WindowID WindowSubsystem::CreateChildWindow(Entity* const  owner,
+                                            String const&  windowTitle,
+                                            int const      x,
+                                            int const      y,
+                                            int const      width,
+                                            int const      height)
+{
+    if (owner == nullptr)
     {
-        g_renderer->CreateWindowSwapChain(*m_windowList[newId].m_window);
+        DebuggerPrintf("CreateChildWindow: Owner entity is nullptr.\n");
+        return INVALID_WINDOW_ID;
     }
 
-    ShowWindow(hwnd, SW_SHOW);
+    WindowID const windowID = CreateChildWindow(owner->m_entityID, windowTitle, x, y, width, height);
+    if (windowID == INVALID_WINDOW_ID) return INVALID_WINDOW_ID;
 
-    DebuggerPrintf("CreateWindowInternal: Created window %d '%s' for actor %llu.\n", newId, windowTitle.c_str(), static_cast<unsigned long long>(owner));
-    return newId;
+    // Let the entity cache its WindowID / WindowData* so per-frame access skips the hash lookups
+    m_boundEntities[owner->m_entityID] = owner;
+    NotifyEntityWindowBound(owner->m_entityID, windowID);
+
+    return windowID;
 }
 
 bool WindowSubsystem::AddEntityToWindow(WindowID windowID, EntityID entityID)
@@ -202,6 +230,7 @@ bool WindowSubsystem::RemoveEntityFromWindow(WindowID windowID, EntityID entityI
 
     owners.erase(actorIt);
     m_actorToWindow.erase(entityID);
+    NotifyEntityWindowUnbound(entityID);
 
     // Auto-destroy window when it has no remaining owners
     if (owners.empty())
@@ -229,14 +258,12 @@ void WindowSubsystem::DestroyWindow(WindowID windowID)
     for (EntityID actorId : windowIt->second.m_owners)
     {
         m_actorToWindow.erase(actorId);
+        NotifyEntityWindowUnbound(actorId);
     }
 
-    if (windowIt->second.m_window)
-    {
-        windowIt->second.m_window->Shutdown();
-    }
-
+    ReleaseWindowData(std::move(windowIt->second));
     m_windowList.erase(windowIt);
+    m_windowAnimations.erase(windowID);
 
     DebuggerPrintf("DestroyWindow: Window %d destroyed.\n", windowID);
 }
@@ -245,34 +272,80 @@ void WindowSubsystem::DestroyAllWindows()
 {
     for (auto& [windowId, windowData] : m_windowList)
     {
-        if (windowData.m_window)
-        {
-            windowData.m_window->Shutdown();
-        }
+        ShutdownWindowData(windowData);
+    }
+
+    for (WindowData& windowData : m_windowPool)
+    {
+        ShutdownWindowData(windowData);
+    }
+
+    for (auto& [entityId, entity] : m_boundEntities)
+    {
+        entity->UnbindChildWindow();
     }
 
     m_windowList.clear();
+    m_windowPool.clear();
+    m_windowAnimations.clear();
     m_actorToWindow.clear();
+    m_boundEntities.clear();
 
     DebuggerPrintf("DestroyAllWindows: All windows destroyed.\n");
 }
 
+void WindowSubsystem::WarmWindowPool(int const width, int const height)
+{
+    // Only called while no wave is spawning, so the creation cost lands in frames nobody plays in
+    int createdCount = 0;
+
+    while (static_cast<int>(m_windowPool.size()) < m_config.m_windowPoolCapacity &&
+        createdCount < m_config.m_windowPoolWarmPerFrame)
+    {
+        WindowData windowData = CreateWindowData("Pooled Window", 0, 0, width, height);
+        if (!windowData.m_window) return;
+
+        m_windowPool.push_back(std::move(windowData));
+        ++createdCount;
+    }
+}
+
 void WindowSubsystem::ShowWindowByWindowID(WindowID const windowID)
 {
-    Window* window = GetValidatedWindow(windowID, "ShowWindowByWindowID");
-    if (window)
+    WindowData* windowData = GetWindowData(windowID);
+    if (windowData == nullptr || !windowData->m_window)
     {
-        ShowWindow(static_cast<HWND>(window->GetWindowHandle()), SW_SHOW);
+        DebuggerPrintf("ShowWindowByWindowID: Window %d not found.\n", windowID);
+        return;
     }
+
+    CommitWindowVisibility(*windowData, true);
 }
 
 void WindowSubsystem::HideWindowByWindowID(WindowID const windowID)
 {
-    Window* window = GetValidatedWindow(windowID, "HideWindowByWindowID");
-    if (window)
+    WindowData* windowData = GetWindowData(windowID);
+    if (windowData == nullptr || !windowData->m_window)
     {
-        ShowWindow(static_cast<HWND>(window->GetWindowHandle()), SW_HIDE);
+        DebuggerPrintf("HideWindowByWindowID: Window %d not found.\n", windowID);
+        return;
     }
+
+    CommitWindowVisibility(*windowData, false);
+}
+
+void WindowSubsystem::ShowWindow(WindowData* const windowData)
+{
+    if (windowData == nullptr || !windowData->m_window) return;
+
+    CommitWindowVisibility(*windowData, true);
+}
+
+void WindowSubsystem::HideWindow(WindowData* const windowData)
+{
+    if (windowData == nullptr || !windowData->m_window) return;
+
+    CommitWindowVisibility(*windowData, false);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -281,18 +354,21 @@ void WindowSubsystem::HideWindowByWindowID(WindowID const windowID)
 
 Window* WindowSubsystem::GetWindow(WindowID windowID)
 {
+    ++m_lookupCount;
     auto it = m_windowList.find(windowID);
     return (it != m_windowList.end() && it->second.m_window) ? it->second.m_window.get() : nullptr;
 }
 
 WindowData* WindowSubsystem::GetWindowData(WindowID const windowID)
 {
+    ++m_lookupCount;
     auto it = m_windowList.find(windowID);
     return (it != m_windowList.end()) ? &it->second : nullptr;
 }
 
 WindowID WindowSubsystem::FindWindowIDByEntityID(EntityID const entityID)
 {
+    ++m_lookupCount;
     auto it = m_actorToWindow.find(entityID);
     return (it != m_actorToWindow.end()) ? it->second : INVALID_WINDOW_ID;
 }
@@ -330,6 +406,32 @@ std::vector<WindowID> WindowSubsystem::GetAllWindowIDs()
     return result;
 }
 
+void WindowSubsystem::GetVisibleClientRects(std::vector<AABB2>& outClientRects) const
+{
+    outClientRects.clear();
+
+    for (auto const& [windowId, windowData] : m_windowList)
+    {
+        if (!windowData.m_isActive || !windowData.m_isCommittedVisible || !windowData.m_window) continue;
+
+        Vec2 const clientPosition = windowData.m_window->GetClientPosition();
+        outClientRects.emplace_back(clientPosition, clientPosition + windowData.m_window->GetClientDimensions());
+    }
+}
+
+void WindowSubsystem::GetWindowGeometry(std::vector<sWindowGeometry>& outGeometry) const
+{
+    outGeometry.clear();
+
+    for (auto const& [windowId, windowData] : m_windowList)
+    {
+        if (!windowData.m_isActive || !windowData.m_window) continue;
+
+        Window const* window = windowData.m_window.get();
+        outGeometry.push_back({window->GetWindowHandle(), window->GetClientPosition(), window->GetClientDimensions()});
+    }
+}
+
 bool WindowSubsystem::IsActorInWindow(WindowID const windowID, EntityID const entityID)
 {
     auto it = m_windowList.find(windowID);
@@ -374,6 +476,7 @@ void WindowSubsystem::MoveWindowByOffset(WindowID const windowID, Vec2 const& of
         Vec2 const oldPosition = window->GetWindowPosition();
         Vec2 const newPosition = oldPosition + offset;
         window->SetWindowPosition(newPosition);
+        window->SetClientPosition(window->GetClientPosition() + offset);
         DebuggerPrintf("MoveWindowByOffset: Moved Window %d by (%f, %f), from (%f, %f) to (%f, %f)\n",
                        windowID, offset.x, offset.y,
                        oldPosition.x, oldPosition.y, newPosition.x, newPosition.y);
@@ -410,6 +513,7 @@ void WindowSubsystem::SetWindowName(WindowID windowId, String const& name)
     if (it != m_windowList.end())
     {
         it->second.m_name = name;
+        CommitWindowTitle(it->second, name);
         DebuggerPrintf("SetWindowName: Window %d renamed to '%s'.\n", windowId, name.c_str());
     }
     else
@@ -453,90 +557,150 @@ void WindowSubsystem::RemoveEntityFromMappings(EntityID entityID)
     }
 }
 
-HWND WindowSubsystem::CreateOSWindow(String const& title,
-                                     int const     x,
-                                     int const     y,
-                                     int const     width,
-                                     int const     height)
+WindowData WindowSubsystem::CreateWindowData(String const& title,
+                                             int const     x,
+                                             int const     y,
+                                             int const     width,
+                                             int const     height)
 {
-    // Convert title to wide string
-    std::wstring wTitle;
-    wTitle.resize(title.size());
-    MultiByteToWideChar(CP_UTF8, 0, title.c_str(), static_cast<int>(title.size()), wTitle.data(), static_cast<int>(wTitle.size()));
+    WindowData windowData;
+
+    void* const windowHandle = m_backend->CreateNativeWindow(title, x, y, width, height);
+    if (!windowHandle) return windowData;
+
+    ++m_nativeWindowCreationCount;
+
+    sWindowConfig config;
+    config.m_windowType  = eWindowType::WINDOWED;
+    config.m_aspectRatio = static_cast<float>(width) / static_cast<float>(height);
+    config.m_windowTitle = title;
+
+    std::unique_ptr<Window> newWindow = std::make_unique<Window>(config);
+
+    newWindow->SetWindowHandle(windowHandle);
+    newWindow->SetDisplayContext(m_backend->GetNativeDisplayContext(windowHandle));
+
+    newWindow->SetWindowDimensions(Vec2(static_cast<float>(width), static_cast<float>(height)));
+    newWindow->SetWindowPosition(Vec2(static_cast<float>(x), static_cast<float>(y)));
+    newWindow->m_shouldUpdatePosition = true;
 
-    // Register window class (only once)
-    static bool classRegistered = false;
-    if (!classRegistered)
+    // Initialize client position to prevent crash when GetClientPosition() is called
+    InitializeWindowClientPosition(newWindow.get());
+
+    if (g_renderer)
     {
-        WNDCLASS wc      = {};
-        wc.lpfnWndProc   = reinterpret_cast<WNDPROC>(GetWindowLongPtr(static_cast<HWND>(Window::s_mainWindow->GetWindowHandle()), GWLP_WNDPROC));
-        wc.hInstance     = GetModuleHandle(nullptr);
-        wc.lpszClassName = L"ChildWindow";
-        wc.hbrBackground = reinterpret_cast<HBRUSH>(COLOR_WINDOW + 1);
-        wc.hCursor       = LoadCursor(nullptr, IDC_ARROW);
-        wc.hIcon         = static_cast<HICON>(LoadImage(
-            nullptr,
-            m_config.m_iconFilePath,
-            IMAGE_ICON,
-            32, 32,
-            LR_LOADFROMFILE
-        ));
-        RegisterClass(&wc);
-        classRegistered = true;
+        g_renderer->CreateWindowSwapChain(*newWindow);
+
+        // Two BGRA8 back buffers at the creation size; swap chains are never resized (see Update)
+        windowData.m_swapChainBytes = static_cast<size_t>(width) * static_cast<size_t>(height) * 4 * 2;
+        MemoryTracker::RecordAllocation(eMemoryTag::SWAP_CHAIN, windowData.m_swapChainBytes);
     }
 
-    // Adjust window size so the client area matches the specified width and height
-    RECT rect = {0, 0, width, height};
-    AdjustWindowRectEx(&rect, WS_OVERLAPPEDWINDOW, FALSE, 0);
+    // Window comes from make_unique, outside GAME_MEMORY_TAG, so it is charged by hand
+    MemoryTracker::RecordAllocation(eMemoryTag::WINDOW, sizeof(Window));
 
-    int adjustedWidth  = rect.right - rect.left;
-    int adjustedHeight = rect.bottom - rect.top;
+    windowData.m_swapChainWidth  = width;
+    windowData.m_swapChainHeight = height;
 
-    HWND hwnd = CreateWindowEx(
-        0,
-        L"ChildWindow",
-        wTitle.c_str(),
-        WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU,
-        x, y, adjustedWidth, adjustedHeight,
-        nullptr,
-        nullptr,
-        GetModuleHandle(nullptr),
-        nullptr
-    );
+    // The OS already placed the window where it was asked to, so the first geometry pass has nothing to send
+    windowData.m_hasCommittedGeometry      = true;
+    windowData.m_committedClientPosition   = newWindow->GetClientPosition();
+    windowData.m_committedClientDimensions = newWindow->GetClientDimensions();
+    windowData.m_committedTitle            = title;
+    windowData.m_window                    = std::move(newWindow);
 
-    return hwnd;
+    return windowData;
 }
 
-void WindowSubsystem::InitializeWindowClientPosition(Window* window, HWND hwnd)
+WindowData WindowSubsystem::AcquireWindowData(String const& title,
+                                              int const     x,
+                                              int const     y,
+                                              int const     width,
+                                              int const     height)
 {
-    if (!window || !hwnd) return;
+    // Newest first, so the most recently used swap chain is handed out again
+    auto pooledIt = std::find_if(m_windowPool.rbegin(), m_windowPool.rend(), [width, height](WindowData const& pooled)
+    {
+        return pooled.m_swapChainWidth == width && pooled.m_swapChainHeight == height;
+    });
+
+    if (pooledIt == m_windowPool.rend())
+    {
+        return CreateWindowData(title, x, y, width, height);
+    }
 
-    // Get client rectangle in client coordinates
-    RECT clientRect;
-    GetClientRect(hwnd, &clientRect);
+    WindowData windowData = std::move(*pooledIt);
+    m_windowPool.erase(std::next(pooledIt).base());
 
-    // Convert client area top-left corner to screen coordinates
-    POINT clientTopLeft = {0, 0};
-    ClientToScreen(hwnd, &clientTopLeft);
+    CommitWindowTitle(windowData, title);
 
-    // Calculate client dimensions
-    int const clientWidth  = clientRect.right - clientRect.left;
-    int const clientHeight = clientRect.bottom - clientRect.top;
+    // Place the recycled window exactly like CreateNativeWindow places a new one, then read the client
+    // rect back through the same conversion, so pooled and fresh windows end up in the same spot
+    Window* window = windowData.m_window.get();
 
-    // Get screen dimensions for Y-axis flip
-    Vec2 const screenDimensions = Vec2(static_cast<float>(GetSystemMetrics(SM_CXSCREEN)),
-                                       static_cast<float>(GetSystemMetrics(SM_CYSCREEN)));
+    m_backend->PlaceNativeWindow(window->GetWindowHandle(), x, y, width, height);
+    ++m_osCallCount;
 
-    // Set client position (with Y-axis flip for engine coordinate system)
-    Vec2 const clientPosition = Vec2(static_cast<float>(clientTopLeft.x),
-                                     screenDimensions.y - static_cast<float>(clientTopLeft.y + clientHeight));
+    window->SetWindowDimensions(Vec2(static_cast<float>(width), static_cast<float>(height)));
+    window->SetWindowPosition(Vec2(static_cast<float>(x), static_cast<float>(y)));
+    window->m_shouldUpdatePosition = true;
+
+    InitializeWindowClientPosition(window);
+
+    windowData.m_isActive                  = true;
+    windowData.m_hasCommittedGeometry      = true;
+    windowData.m_committedClientPosition   = window->GetClientPosition();
+    windowData.m_committedClientDimensions = window->GetClientDimensions();
+
+    return windowData;
+}
+
+void WindowSubsystem::ReleaseWindowData(WindowData&& windowData)
+{
+    if (!windowData.m_window) return;
+
+    if (static_cast<int>(m_windowPool.size()) >= m_config.m_windowPoolCapacity)
+    {
+        ShutdownWindowData(windowData);
+        return;
+    }
+
+    CommitWindowVisibility(windowData, false);
+    windowData.m_owners.clear();
+    windowData.m_name.clear();
+    m_windowPool.push_back(std::move(windowData));
+}
+
+void WindowSubsystem::ShutdownWindowData(WindowData& windowData)
+{
+    if (!windowData.m_window) return;
+
+    windowData.m_window->Shutdown();
+
+    MemoryTracker::RecordFree(eMemoryTag::WINDOW, sizeof(Window));
+    if (windowData.m_swapChainBytes > 0)
+    {
+        MemoryTracker::RecordFree(eMemoryTag::SWAP_CHAIN, windowData.m_swapChainBytes);
+        windowData.m_swapChainBytes = 0;
+    }
+}
+
+void WindowSubsystem::InitializeWindowClientPosition(Window* window)
+{
+    if (!window || !window->GetWindowHandle()) return;
+
+    // Ask the OS where the client area actually landed, in engine screen space
+    Vec2 clientPosition;
+    Vec2 clientDimensions;
+    m_backend->GetNativeClientRect(window->GetWindowHandle(), clientPosition, clientDimensions);
 
     window->SetClientPosition(clientPosition);
-    window->SetClientDimensions(Vec2(static_cast<float>(clientWidth), static_cast<float>(clientHeight)));
+    window->SetClientDimensions(clientDimensions);
 }
 
 Window* WindowSubsystem::GetValidatedWindow(WindowID const windowID, char const* callerName)
 {
+    ++m_lookupCount;
     auto it = m_windowList.find(windowID);
     if (it == m_windowList.end() || !it->second.m_window)
     {
@@ -549,25 +713,208 @@ Window* WindowSubsystem::GetValidatedWindow(WindowID const windowID, char const*
     return it->second.m_window.get();
 }
 
-void WindowSubsystem::SetupTransparentMainWindow()
+void WindowSubsystem::CommitWindowVisibility(WindowData& windowData, bool const isVisible)
 {
-    if (!Window::s_mainWindow) return;
+    if (windowData.m_isCommittedVisible == isVisible) return;
+
+    m_backend->ShowNativeWindow(windowData.m_window->GetWindowHandle(), isVisible);
+    windowData.m_isCommittedVisible = isVisible;
+    ++m_osCallCount;
+}
+
+void WindowSubsystem::CommitWindowTitle(WindowData& windowData, String const& title)
+{
+    if (windowData.m_committedTitle == title) return;
+
+    m_backend->SetNativeWindowTitle(windowData.m_window->GetWindowHandle(), title);
+    windowData.m_committedTitle = title;
+    ++m_osCallCount;
+}
+
+void WindowSubsystem::CommitWindowGeometry(std::vector<sWindowGeometry> const& drawnGeometry)
+{
+    // Every window presents at its live rect unless the drawn batch carries one for it
+    for (auto& [windowId, windowData] : m_windowList)
+    {
+        if (!windowData.m_window) continue;
+
+        windowData.m_presentClientPosition   = windowData.m_window->GetClientPosition();
+        windowData.m_presentClientDimensions = windowData.m_window->GetClientDimensions();
+    }
+
+    m_pendingGeometry.clear();
+    m_geometryCommitCountLastFrame = 0;
+
+    if (!m_isGameplayRunning) return;
+
+    // Keep only the rects that drifted past the threshold from what the OS already shows
+    for (sWindowGeometry const& geometry : drawnGeometry)
+    {
+        // Windows destroyed since the batch's frame are no longer indexed
+        WindowData* windowData = FindWindowDataByHandle(geometry.m_windowHandle);
+        if (windowData == nullptr || !windowData->m_isActive) continue;
 
-    HWND mainHwnd = static_cast<HWND>(Window::s_mainWindow->GetWindowHandle());
+        windowData->m_presentClientPosition   = geometry.m_clientPosition;
+        windowData->m_presentClientDimensions = geometry.m_clientDimensions;
 
-    // Set up fullscreen transparent main window
-    SetWindowLong(mainHwnd, GWL_EXSTYLE,
-                  GetWindowLong(mainHwnd, GWL_EXSTYLE) | WS_EX_LAYERED | WS_EX_TRANSPARENT);
+        if (!HasGeometryDrifted(*windowData, geometry.m_clientPosition, geometry.m_clientDimensions)) continue;
 
-    // Fully transparent, mouse click-through
-    SetLayeredWindowAttributes(mainHwnd, 0, 0, LWA_ALPHA);
+        m_pendingGeometry.push_back(geometry);
 
-    // Set to fullscreen overlay
-    int screenWidth  = GetSystemMetrics(SM_CXSCREEN);
-    int screenHeight = GetSystemMetrics(SM_CYSCREEN);
+        // A forced commit (first placement, settled animation) stays forced until the drawn batch has
+        // caught up with the live rect, or a batch from before the final step would use it up
+        Window const* window   = windowData->m_window.get();
+        bool const    isForced = !windowData->m_hasCommittedGeometry;
+        bool const    isLive   = geometry.m_clientPosition == window->GetClientPosition() && geometry.m_clientDimensions == window->GetClientDimensions();
 
-    SetWindowPos(mainHwnd, HWND_TOPMOST, 0, 0, screenWidth, screenHeight,
-                 SWP_SHOWWINDOW);
+        windowData->m_hasCommittedGeometry      = !isForced || isLive;
+        windowData->m_committedClientPosition   = geometry.m_clientPosition;
+        windowData->m_committedClientDimensions = geometry.m_clientDimensions;
+    }
+
+    m_geometryCommitCountLastFrame = m_pendingGeometry.size();
+    if (m_pendingGeometry.empty()) return;
+
+    m_backend->CommitWindowGeometry(m_pendingGeometry);
+    m_osCallCount += m_pendingGeometry.size();
+}
+
+void WindowSubsystem::PlanStagingReadback()
+{
+    Vec2 const screenDimensions = Window::s_mainWindow->GetScreenDimensions();
+    int const  backbufferWidth  = static_cast<int>(screenDimensions.x);
+    int const  backbufferHeight = static_cast<int>(screenDimensions.y);
+
+    m_readbackRects.clear();
+
+    for (auto const& [windowId, windowData] : m_windowList)
+    {
+        if (!windowData.m_isActive || !windowData.m_isCommittedVisible || !windowData.m_window) continue;
+
+        m_readbackRects.push_back(GetPresentPixelRect(windowData));
+    }
+
+    constexpr int BYTES_PER_PIXEL = 4;
+    ReadbackPlanner::BuildReadbackPlan(m_readbackRects, backbufferWidth, backbufferHeight, BYTES_PER_PIXEL, m_readbackPlan);
+}
+
+void WindowSubsystem::ClassifyPresentVisibility()
+{
+    m_presentHandles.clear();
+
+    for (auto& [windowId, windowData] : m_windowList)
+    {
+        if (!windowData.m_isActive || !windowData.m_window) continue;
+        if (!windowData.m_window->m_shouldUpdatePosition) continue;
+
+        m_presentHandles.push_back(windowData.m_window->GetWindowHandle());
+    }
+
+    // Occlusion depends on the real z-order, which the user can change by clicking a window
+    m_backend->SortTopmostFirst(m_presentHandles);
+
+    m_presentCandidates.clear();
+    m_visibilityInputs.clear();
+
+    for (void* windowHandle : m_presentHandles)
+    {
+        WindowData* windowData = FindWindowDataByHandle(windowHandle);
+        m_presentCandidates.push_back(windowData);
+        m_visibilityInputs.push_back({GetPresentPixelRect(*windowData), !windowData->m_isCommittedVisible});
+    }
+
+    Vec2 const screenDimensions = Window::s_mainWindow->GetScreenDimensions();
+    sPixelRect screenRect;
+    screenRect.m_right  = static_cast<int>(screenDimensions.x);
+    screenRect.m_bottom = static_cast<int>(screenDimensions.y);
+
+    WindowVisibility::Classify(m_visibilityInputs, screenRect, m_presentVisibility);
+}
+
+void WindowSubsystem::PresentWindow(WindowData const& windowData)
+{
+    // RenderViewportToWindow copies the viewport under the Window's client rect; for the call that is
+    // the rect the drawn batch was built with, then the live rect goes back for the simulation
+    Window*    window               = windowData.m_window.get();
+    Vec2 const liveClientPosition   = window->GetClientPosition();
+    Vec2 const liveClientDimensions = window->GetClientDimensions();
+
+    window->SetClientPosition(windowData.m_presentClientPosition);
+    window->SetClientDimensions(windowData.m_presentClientDimensions);
+    g_renderer->RenderViewportToWindow(*window);
+    window->SetClientPosition(liveClientPosition);
+    window->SetClientDimensions(liveClientDimensions);
+}
+
+void WindowSubsystem::IndexWindowsByHandle()
+{
+    m_windowByHandle.clear();
+
+    for (auto& [windowId, windowData] : m_windowList)
+    {
+        if (windowData.m_window) m_windowByHandle.emplace_back(windowData.m_window->GetWindowHandle(), &windowData);
+    }
+
+    std::sort(m_windowByHandle.begin(), m_windowByHandle.end(), [](std::pair<void*, WindowData*> const& a, std::pair<void*, WindowData*> const& b)
+    {
+        return a.first < b.first;
+    });
+}
+
+WindowData* WindowSubsystem::FindWindowDataByHandle(void* windowHandle)
+{
+    auto const isHandleLess = [](std::pair<void*, WindowData*> const& entry, void* handle) { return entry.first < handle; };
+    auto const handleIt     = std::lower_bound(m_windowByHandle.begin(), m_windowByHandle.end(), windowHandle, isHandleLess);
+
+    if (handleIt == m_windowByHandle.end() || handleIt->first != windowHandle) return nullptr;
+    return handleIt->second;
+}
+
+sPixelRect WindowSubsystem::GetPresentPixelRect(WindowData const& windowData) const
+{
+    // Child window client rects are in engine screen space (bottom-left origin); pixel rects are top-left
+    int const  screenHeight     = static_cast<int>(Window::s_mainWindow->GetScreenDimensions().y);
+    Vec2 const clientPosition   = windowData.m_presentClientPosition;
+    Vec2 const clientDimensions = windowData.m_presentClientDimensions;
+
+    sPixelRect rect;
+    rect.m_left   = static_cast<int>(floorf(clientPosition.x));
+    rect.m_right  = static_cast<int>(ceilf(clientPosition.x + clientDimensions.x));
+    rect.m_top    = screenHeight - static_cast<int>(ceilf(clientPosition.y + clientDimensions.y));
+    rect.m_bottom = screenHeight - static_cast<int>(floorf(clientPosition.y));
+    return rect;
+}
+
+bool WindowSubsystem::HasGeometryDrifted(WindowData const& windowData, Vec2 const& clientPosition, Vec2 const& clientDimensions) const
+{
+    if (!windowData.m_hasCommittedGeometry) return true;
+
+    float const threshold       = m_config.m_geometryCommitThreshold;
+    Vec2 const  positionDelta   = clientPosition - windowData.m_committedClientPosition;
+    Vec2 const  dimensionsDelta = clientDimensions - windowData.m_committedClientDimensions;
+
+    return fabsf(positionDelta.x) >= threshold || fabsf(positionDelta.y) >= threshold ||
+        fabsf(dimensionsDelta.x) >= threshold || fabsf(dimensionsDelta.y) >= threshold;
+}
+
+void WindowSubsystem::NotifyEntityWindowBound(EntityID const entityID, WindowID const windowID)
+{
+    auto entityIt = m_boundEntities.find(entityID);
+    if (entityIt == m_boundEntities.end()) return;
+
+    auto windowIt = m_windowList.find(windowID);
+    if (windowIt == m_windowList.end() || !windowIt->second.m_window) return;
+
+    entityIt->second->BindChildWindow(windowID, &windowIt->second);
+}
+
+void WindowSubsystem::NotifyEntityWindowUnbound(EntityID const entityID)
+{
+    auto entityIt = m_boundEntities.find(entityID);
+    if (entityIt == m_boundEntities.end()) return;
+
+    entityIt->second->UnbindChildWindow();
+    m_boundEntities.erase(entityIt);
 }
 
 String WindowSubsystem::GenerateDefaultWindowName(std::vector<EntityID> const& owners) const
@@ -624,8 +971,8 @@ void WindowSubsystem::AnimateWindowPosition(WindowID id, Vec2 const& targetPosit
 
 void WindowSubsystem::UpdateWindowAnimations(float deltaSeconds)
 {
-    // Collect completed animations for removal
-    std::vector<WindowID> completedAnimations;
+    // Collect completed animations for removal; the list only lives for this call, so it comes from the frame arena
+    FrameVector<WindowID> completedAnimations = g_frameArena->MakeVector<WindowID>(m_windowAnimations.size());
 
     for (auto& [windowId, animData] : m_windowAnimations)
     {
@@ -656,30 +1003,36 @@ void WindowSubsystem::UpdateSingleWindowAnimation(WindowID id, WindowAnimationDa
     Window* window = windowIt->second.m_window.get();
 
     animData.m_animationTimer += deltaSeconds;
-    float t = animData.m_animationTimer / animData.m_animationDuration;
-
-    if (t >= 1.0f)
-    {
-        // Animation complete
-        t                              = 1.0f;
-        animData.m_isAnimatingSize     = false;
-        animData.m_isAnimatingPosition = false;
-    }
+    float const t          = (std::min)(animData.m_animationTimer / animData.m_animationDuration, 1.f);
+    bool const  isComplete = t >= 1.f;
 
     // Use SmoothStep5 for smooth animation easing
     float easedT = SmoothStep5(t);
 
+    // The frame is a constant border around the client area, so the client rect follows the window rect
+    // by the same delta; GetWindowGeometry only reads the client rect
     if (animData.m_isAnimatingSize)
     {
         Vec2 currentDimensions = Interpolate(animData.m_startWindowDimensions, animData.m_targetWindowDimensions, easedT);
+        window->SetClientDimensions(window->GetClientDimensions() + currentDimensions - window->GetWindowDimensions());
         window->SetWindowDimensions(currentDimensions);
     }
 
     if (animData.m_isAnimatingPosition)
     {
         Vec2 currentPosition = Interpolate(animData.m_startWindowPosition, animData.m_targetWindowPosition, easedT);
+        window->SetClientPosition(window->GetClientPosition() + currentPosition - window->GetWindowPosition());
         window->SetWindowPosition(currentPosition);
     }
+
+    if (isComplete)
+    {
+        // The target is applied above before the flags drop; the last step may be under the commit
+        // threshold, so the final rect is forced out
+        animData.m_isAnimatingSize              = false;
+        animData.m_isAnimatingPosition          = false;
+        windowIt->second.m_hasCommittedGeometry = false;
+    }
 }
 
 void WindowSubsystem::AnimateWindowPositionAndDimensions(WindowID id, Vec2 const& targetPosition, Vec2 const& targetDimensions, float duration)
@@ -705,3 +1058,51 @@ bool WindowSubsystem::IsWindowAnimating(WindowID id) const
     auto it = m_windowAnimations.find(id);
     return (it != m_windowAnimations.end()) && it->second.IsAnimating();
 }
+
+void WindowSubsystem::RequestWindowGrowth(WindowID const id,
+                                          Vec2 const&    positionDelta,
+                                          Vec2 const&    dimensionDelta,
+                                          float const    duration)
+{
+    // Few windows grow in any frame, so a linear scan beats hashing every request
+    for (WindowGrowthData& growth : m_pendingGrowth)
+    {
+        if (growth.m_windowID != id) continue;
+
+        growth.m_positionDelta += positionDelta;
+        growth.m_dimensionDelta += dimensionDelta;
+        growth.m_duration = (std::max)(growth.m_duration, duration);
+        return;
+    }
+
+    m_pendingGrowth.push_back(WindowGrowthData{id, positionDelta, dimensionDelta, duration});
+}
+
+//----------------------------------------------------------------------------------------------------
+// ResolveWindowGrowthRequests - Sums are order independent, so the result does not depend on which
+// request arrived first. Growth stacks on top of a running animation's target instead of restarting
+// from the current geometry, so nothing requested in earlier frames is lost.
+//----------------------------------------------------------------------------------------------------
+void WindowSubsystem::ResolveWindowGrowthRequests()
+{
+    for (WindowGrowthData const& growth : m_pendingGrowth)
+    {
+        auto windowIt = m_windowList.find(growth.m_windowID);
+        if (windowIt == m_windowList.end()) continue;
+
+        Window const* window         = windowIt->second.m_window.get();
+        Vec2          basePosition   = window->GetWindowPosition();
+        Vec2          baseDimensions = window->GetWindowDimensions();
+
+        auto animIt = m_windowAnimations.find(growth.m_windowID);
+        if (animIt != m_windowAnimations.end() && animIt->second.IsAnimating())
+        {
+            if (animIt->second.m_isAnimatingPosition) basePosition = animIt->second.m_targetWindowPosition;
+            if (animIt->second.m_isAnimatingSize) baseDimensions = animIt->second.m_targetWindowDimensions;
+        }
+
+        AnimateWindowPositionAndDimensions(growth.m_windowID, basePosition + growth.m_positionDelta, baseDimensions + growth.m_dimensionDelta, growth.m_duration);
+    }
+
+    m_pendingGrowth.clear();
+}
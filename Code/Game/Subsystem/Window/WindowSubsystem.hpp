@@ -10,7 +10,14 @@
 #include <vector>
 
 #include "Engine/Platform/Window.hpp"
+#include "Game/Framework/MemoryTracker.hpp"
 #include "Game/Gameplay/Entity.hpp"
+#include "Game/Subsystem/Window/ReadbackPlanner.hpp"
+#include "Game/Subsystem/Window/WindowBackend.hpp"
+#include "Game/Subsystem/Window/WindowVisibility.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Entity;
 
 //----------------------------------------------------------------------------------------------------
 // Constants
@@ -35,6 +42,17 @@ struct WindowAnimationData
     bool IsAnimating() const { return m_isAnimatingSize || m_isAnimatingPosition; }
 };
 
+//----------------------------------------------------------------------------------------------------
+// Growth requested for one window this frame; every request is summed and resolved once in Update()
+//----------------------------------------------------------------------------------------------------
+struct WindowGrowthData
+{
+    WindowID m_windowID       = 0;
+    Vec2     m_positionDelta  = Vec2::ZERO;
+    Vec2     m_dimensionDelta = Vec2::ZERO;
+    float    m_duration       = 0.f;
+};
+
 //----------------------------------------------------------------------------------------------------
 struct WindowData
 {
@@ -42,36 +60,64 @@ struct WindowData
     std::unordered_set<EntityID> m_owners;
     String                       m_name;
     bool                         m_isActive = true;
+    size_t                       m_swapChainBytes  = 0;     // Estimate charged to eMemoryTag::SWAP_CHAIN while the window is alive
+    int                          m_swapChainWidth  = 0;     // Client size the window and swap chain were created at; swap chains
+    int                          m_swapChainHeight = 0;     // are never resized, so a pooled window is only reused at this size
+
+    // Last state committed to the OS; only transitions are sent through the backend
+    bool   m_isCommittedVisible        = false;
+    bool   m_hasCommittedGeometry      = false;
+    String m_committedTitle;
+    Vec2   m_committedClientPosition   = Vec2::ZERO;
+    Vec2   m_committedClientDimensions = Vec2::ZERO;
+
+    // Client rect presented this frame: the drawn batch's, or the live one when the batch has none
+    Vec2 m_presentClientPosition   = Vec2::ZERO;
+    Vec2 m_presentClientDimensions = Vec2::ZERO;
 };
 
 struct sWindowSubsystemConfig
 {
-    wchar_t const* m_iconFilePath = nullptr;
+    wchar_t const*  m_iconFilePath            = nullptr;
+    IWindowBackend* m_backend                 = nullptr;     // Optional; WindowSubsystem owns CreatePlatformWindowBackend() when nullptr
+    float           m_geometryCommitThreshold = 1.f;         // Pixels a client rect must drift before it is re-committed
+    int             m_windowPoolCapacity      = 16;          // Hidden windows kept alive for reuse by later CreateChildWindow calls
+    int             m_windowPoolWarmPerFrame  = 2;           // Windows created per WarmWindowPool call, spreads creation over frames
 };
 
 //----------------------------------------------------------------------------------------------------
 class WindowSubsystem
 {
 public:
+    GAME_MEMORY_TAG(eMemoryTag::WINDOW)
+
     explicit WindowSubsystem(sWindowSubsystemConfig const& config);
     void     StartUp();
     void     BeginFrame();
-    void     Update();
-    void     Render();
+    void     Update(float deltaSeconds, bool isGameplayRunning);                // Animations and geometry commits only run during gameplay
+    void     Render(std::vector<sWindowGeometry> const& drawnGeometry);     // Commits and presents the rects the drawn batch was built with
     void     EndFrame();
     void     ShutDown();
 
     // Core window management
     WindowID CreateChildWindow(EntityID owner, String const& windowTitle, int x, int y, int width, int height);
+    WindowID CreateChildWindow(Entity* owner, String const& windowTitle, int x, int y, int width, int height);
     bool     AddEntityToWindow(WindowID windowID, EntityID entityID);
     bool     RemoveEntityFromWindow(WindowID windowID, EntityID entityID);
     void     RemoveEntityFromMappings(EntityID entityID);
     void     DestroyWindow(WindowID windowID);
     void     DestroyAllWindows();
 
-    // Show and Hide window
+    // Window pool
+    void   WarmWindowPool(int width, int height);     // Pre-creates hidden windows at the client size later requests will ask for
+    size_t GetPooledWindowCount() const { return m_windowPool.size(); }
+    size_t GetNativeWindowCreationCount() const { return m_nativeWindowCreationCount; }
+
+    // Show and Hide window; the WindowData overloads take the pointer bound entities cache and skip the lookup
     void ShowWindowByWindowID(WindowID windowID);
     void HideWindowByWindowID(WindowID windowID);
+    void ShowWindow(WindowData* windowData);
+    void HideWindow(WindowData* windowData);
 
     // Query functions
     Window*               GetWindow(WindowID windowID);
@@ -80,6 +126,8 @@ public:
     std::vector<EntityID> GetWindowOwners(WindowID windowID);
     std::vector<WindowID> GetActorWindows(EntityID entityID);
     std::vector<WindowID> GetAllWindowIDs();
+    void                  GetVisibleClientRects(std::vector<AABB2>& outClientRects) const;
+    void                  GetWindowGeometry(std::vector<sWindowGeometry>& outGeometry) const;     // Live client rect of every active window
     bool                  IsActorInWindow(WindowID windowID, EntityID entityID);
     bool                  WindowExists(WindowID windowID);
 
@@ -101,19 +149,75 @@ public:
     void AnimateWindowPositionAndDimensions(WindowID id, Vec2 const& targetPosition, Vec2 const& targetDimensions, float duration = DEFAULT_ANIMATION_DURATION);
     bool IsWindowAnimating(WindowID id) const;
 
+    // Accumulated growth; all requests for a window in a frame become a single animation
+    void RequestWindowGrowth(WindowID id, Vec2 const& positionDelta, Vec2 const& dimensionDelta, float duration = DEFAULT_ANIMATION_DURATION);
+
+    // Instrumentation: entity/window hash lookups performed through the query functions
+    size_t GetLookupCountLastFrame() const { return m_lookupCountLastFrame; }
+    size_t GetOSCallCountLastFrame() const { return m_osCallCountLastFrame; }
+    size_t GetGeometryCommitCountLastFrame() const { return m_geometryCommitCountLastFrame; }
+    size_t GetReadbackBytesLastFrame() const { return m_readbackBytesLastFrame; }
+    size_t GetSkippedPresentCountLastFrame() const { return m_skippedPresentCountLastFrame; }
+
 private:
     sWindowSubsystemConfig                            m_config;
+    std::unique_ptr<IWindowBackend>                   m_ownedBackend;
+    IWindowBackend*                                   m_backend = nullptr;
     std::unordered_map<WindowID, WindowData>          m_windowList;
     std::unordered_map<EntityID, WindowID>            m_actorToWindow;
     std::unordered_map<WindowID, WindowAnimationData> m_windowAnimations;
+    std::unordered_map<EntityID, Entity*>             m_boundEntities;     // Entities caching their WindowID / Window* on themselves
+    std::vector<WindowData>                           m_windowPool;        // Hidden windows with live swap chains, owned by nobody
+    std::vector<WindowGrowthData>                     m_pendingGrowth;     // One entry per window with growth requested this frame
     WindowID                                          m_nextWindowID = 1;
-
-    HWND   CreateOSWindow(String const& title, int x, int y, int width, int height);
-    void   InitializeWindowClientPosition(Window* window, HWND hwnd);
-    Window* GetValidatedWindow(WindowID windowID, char const* callerName = nullptr);
-    void   SetupTransparentMainWindow();
-    String GenerateDefaultWindowName(std::vector<EntityID> const& owners) const;
-
+    bool                                              m_isGameplayRunning = false;
+
+    size_t m_lookupCount                  = 0;
+    size_t m_lookupCountLastFrame         = 0;
+    size_t m_osCallCount                  = 0;
+    size_t m_osCallCountLastFrame         = 0;
+    size_t m_geometryCommitCountLastFrame = 0;
+    size_t m_nativeWindowCreationCount    = 0;
+
+    size_t m_readbackBytesLastFrame       = 0;
+    size_t m_skippedPresentCountLastFrame = 0;
+
+    std::vector<sWindowGeometry> m_pendingGeometry;     // Reused every frame by CommitWindowGeometry
+    std::vector<sPixelRect>      m_readbackRects;       // Reused every frame by PlanStagingReadback
+    sReadbackPlan                m_readbackPlan;
+
+    // Reused every frame by ClassifyPresentVisibility; m_presentCandidates is topmost first
+    std::vector<void*>                         m_presentHandles;
+    std::vector<WindowData*>                   m_presentCandidates;
+    std::vector<sWindowVisibilityInput>        m_visibilityInputs;
+    std::vector<eWindowVisibility>             m_presentVisibility;
+    std::vector<std::pair<void*, WindowData*>> m_windowByHandle;     // Sorted by handle by IndexWindowsByHandle; a map here allocated a node per window per frame
+
+    WindowData CreateWindowData(String const& title, int x, int y, int width, int height);
+    WindowData AcquireWindowData(String const& title, int x, int y, int width, int height);
+    void       ReleaseWindowData(WindowData&& windowData);
+    void       ShutdownWindowData(WindowData& windowData);
+    void       InitializeWindowClientPosition(Window* window);
+    Window*    GetValidatedWindow(WindowID windowID, char const* callerName = nullptr);
+    String     GenerateDefaultWindowName(std::vector<EntityID> const& owners) const;
+
+    // Change-detected commits of per-window OS state
+    void CommitWindowVisibility(WindowData& windowData, bool isVisible);
+    void CommitWindowTitle(WindowData& windowData, String const& title);
+    void CommitWindowGeometry(std::vector<sWindowGeometry> const& drawnGeometry);
+    void PlanStagingReadback();
+    void ClassifyPresentVisibility();
+    void PresentWindow(WindowData const& windowData);
+    void IndexWindowsByHandle();
+    WindowData* FindWindowDataByHandle(void* windowHandle);
+    sPixelRect GetPresentPixelRect(WindowData const& windowData) const;
+    bool HasGeometryDrifted(WindowData const& windowData, Vec2 const& clientPosition, Vec2 const& clientDimensions) const;
+
+    // Keep the cached window handle on bound entities in sync with window create / destroy
+    void NotifyEntityWindowBound(EntityID entityID, WindowID windowID);
+    void NotifyEntityWindowUnbound(EntityID entityID);
+
+    void ResolveWindowGrowthRequests();
     void UpdateWindowAnimations(float deltaSeconds);
     void UpdateSingleWindowAnimation(WindowID id, WindowAnimationData& animData, float deltaSeconds);
 };
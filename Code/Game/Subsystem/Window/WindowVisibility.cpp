@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------------------------------
+// WindowVisibility.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Window/WindowVisibility.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool WindowVisibility::IsRectInside(sPixelRect const& inner, sPixelRect const& outer)
+{
+    return inner.m_left >= outer.m_left && inner.m_right <= outer.m_right &&
+        inner.m_top >= outer.m_top && inner.m_bottom <= outer.m_bottom;
+}
+
+bool WindowVisibility::DoRectsOverlap(sPixelRect const& a, sPixelRect const& b)
+{
+    // Right / bottom are exclusive, so rects that only share an edge do not overlap
+    return a.m_left < b.m_right && b.m_left < a.m_right &&
+        a.m_top < b.m_bottom && b.m_top < a.m_bottom;
+}
+
+void WindowVisibility::Classify(std::vector<sWindowVisibilityInput> const& windowsTopmostFirst,
+                                sPixelRect const&                          screenRect,
+                                std::vector<eWindowVisibility>&            outVisibility)
+{
+    outVisibility.clear();
+    outVisibility.reserve(windowsTopmostFirst.size());
+
+    for (size_t i = 0; i < windowsTopmostFirst.size(); ++i)
+    {
+        sWindowVisibilityInput const& window = windowsTopmostFirst[i];
+
+        if (window.m_isHidden)
+        {
+            outVisibility.push_back(eWindowVisibility::HIDDEN);
+            continue;
+        }
+
+        if (window.m_clientRect.IsEmpty())
+        {
+            outVisibility.push_back(eWindowVisibility::ZERO_AREA);
+            continue;
+        }
+
+        if (!DoRectsOverlap(window.m_clientRect, screenRect))
+        {
+            outVisibility.push_back(eWindowVisibility::OFF_SCREEN);
+            continue;
+        }
+
+        // Any window above that is itself drawn on screen can cover this one; containment is
+        // transitive, so occluded windows above never need to be checked separately
+        eWindowVisibility visibility = eWindowVisibility::VISIBLE;
+
+        for (size_t above = 0; above < i; ++above)
+        {
+            if (outVisibility[above] != eWindowVisibility::VISIBLE) continue;
+
+            if (IsRectInside(window.m_clientRect, windowsTopmostFirst[above].m_clientRect))
+            {
+                visibility = eWindowVisibility::OCCLUDED;
+                break;
+            }
+        }
+
+        outVisibility.push_back(visibility);
+    }
+}
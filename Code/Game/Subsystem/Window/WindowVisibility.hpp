@@ -0,0 +1,42 @@
+//----------------------------------------------------------------------------------------------------
+// WindowVisibility.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Game/Subsystem/Window/ReadbackPlanner.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eWindowVisibility : uint8_t
+{
+    VISIBLE,
+    HIDDEN,        // Hidden through HideWindowByWindowID
+    ZERO_AREA,     // Client rect has no pixels
+    OFF_SCREEN,    // Client rect does not intersect the screen
+    OCCLUDED,      // Client rect is fully inside the client rect of a visible window above it
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sWindowVisibilityInput
+{
+    sPixelRect m_clientRect;
+    bool       m_isHidden = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+// WindowVisibility
+// Pure classification of child windows for presentation. Inputs are ordered topmost first, in the
+// same pixel space as screenRect; outVisibility receives one entry per input, in the same order.
+//----------------------------------------------------------------------------------------------------
+namespace WindowVisibility
+{
+    bool IsRectInside(sPixelRect const& inner, sPixelRect const& outer);
+    bool DoRectsOverlap(sPixelRect const& a, sPixelRect const& b);
+
+    void Classify(std::vector<sWindowVisibilityInput> const& windowsTopmostFirst,
+                  sPixelRect const&                          screenRect,
+                  std::vector<eWindowVisibility>&            outVisibility);
+}
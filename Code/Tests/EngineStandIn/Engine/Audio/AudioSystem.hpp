@@ -0,0 +1,33 @@
+//----------------------------------------------------------------------------------------------------
+// AudioSystem.hpp (test stand-in)
+// No device: sounds are never created or played. Tests reach audio through NullAudioBackend instead.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+typedef size_t SoundID;
+typedef size_t SoundPlaybackID;
+
+//----------------------------------------------------------------------------------------------------
+enum class eAudioSystemSoundDimension : int8_t
+{
+    Sound2D,
+    Sound3D,
+};
+
+//----------------------------------------------------------------------------------------------------
+class AudioSystem
+{
+public:
+    SoundID         CreateOrGetSound(char const*, eAudioSystemSoundDimension) { return 0; }
+    SoundPlaybackID StartSound(SoundID, bool, float, float, float) { return 0; }
+    void            StopSound(SoundPlaybackID) {}
+    bool            IsPlaying(SoundPlaybackID) const { return false; }
+};
+
+//----------------------------------------------------------------------------------------------------
+extern AudioSystem* g_audio;
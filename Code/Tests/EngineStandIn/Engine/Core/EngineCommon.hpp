@@ -0,0 +1,13 @@
+//----------------------------------------------------------------------------------------------------
+// EngineCommon.hpp (test stand-in)
+// Declares only the engine surface the game modules under test use; see EngineStandIn.cpp.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+
+//----------------------------------------------------------------------------------------------------
+#define UNUSED(x) (void)(x);
+#define STATIC
@@ -0,0 +1,9 @@
+//----------------------------------------------------------------------------------------------------
+// ErrorWarningAssert.hpp (test stand-in)
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void DebuggerPrintf(char const* format, ...);     // Silent unless GAME_TEST_VERBOSE is set in the environment
@@ -0,0 +1,29 @@
+//----------------------------------------------------------------------------------------------------
+// Rgba8.hpp (test stand-in)
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+struct Rgba8
+{
+    uint8_t r = 255;
+    uint8_t g = 255;
+    uint8_t b = 255;
+    uint8_t a = 255;
+
+    Rgba8() = default;
+    Rgba8(uint8_t const red, uint8_t const green, uint8_t const blue, uint8_t const alpha = 255) : r(red), g(green), b(blue), a(alpha) {}
+
+    bool operator==(Rgba8 const& other) const { return r == other.r && g == other.g && b == other.b && a == other.a; }
+
+    static Rgba8 const WHITE;
+    static Rgba8 const RED;
+    static Rgba8 const YELLOW;
+};
+
+inline Rgba8 const Rgba8::WHITE  = Rgba8(255, 255, 255);
+inline Rgba8 const Rgba8::RED    = Rgba8(255, 0, 0);
+inline Rgba8 const Rgba8::YELLOW = Rgba8(255, 255, 0);
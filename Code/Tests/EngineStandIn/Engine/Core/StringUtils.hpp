@@ -0,0 +1,12 @@
+//----------------------------------------------------------------------------------------------------
+// StringUtils.hpp (test stand-in)
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <string>
+
+//----------------------------------------------------------------------------------------------------
+typedef std::string String;
+
+String Stringf(char const* format, ...);
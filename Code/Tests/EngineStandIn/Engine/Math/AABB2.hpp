@@ -0,0 +1,26 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2.hpp (test stand-in)
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct AABB2
+{
+    Vec2 m_mins;
+    Vec2 m_maxs;
+
+    AABB2() = default;
+    AABB2(Vec2 const& mins, Vec2 const& maxs) : m_mins(mins), m_maxs(maxs) {}
+    AABB2(float const minX, float const minY, float const maxX, float const maxY) : m_mins(minX, minY), m_maxs(maxX, maxY) {}
+
+    Vec2 GetDimensions() const { return m_maxs - m_mins; }
+    Vec2 GetCenter() const { return (m_mins + m_maxs) * 0.5f; }
+    bool IsPointInside(Vec2 const& point) const { return point.x > m_mins.x && point.x < m_maxs.x && point.y > m_mins.y && point.y < m_maxs.y; }
+
+    static AABB2 const ZERO_TO_ONE;
+};
+
+inline AABB2 const AABB2::ZERO_TO_ONE = AABB2(0.f, 0.f, 1.f, 1.f);
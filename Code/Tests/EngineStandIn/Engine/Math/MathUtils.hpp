@@ -0,0 +1,44 @@
+//----------------------------------------------------------------------------------------------------
+// MathUtils.hpp (test stand-in)
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cmath>
+
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+inline float ConvertDegreesToRadians(float const degrees) { return degrees * 0.01745329252f; }
+inline float ConvertRadiansToDegrees(float const radians) { return radians * 57.29577951f; }
+inline float SinDegrees(float const degrees) { return std::sin(ConvertDegreesToRadians(degrees)); }
+inline float CosDegrees(float const degrees) { return std::cos(ConvertDegreesToRadians(degrees)); }
+inline float Atan2Degrees(float const y, float const x) { return ConvertRadiansToDegrees(std::atan2(y, x)); }
+
+inline float GetClamped(float const value, float const minValue, float const maxValue) { return value < minValue ? minValue : (value > maxValue ? maxValue : value); }
+inline float Interpolate(float const start, float const end, float const fraction) { return start + (end - start) * fraction; }
+inline Vec2  Interpolate(Vec2 const& start, Vec2 const& end, float const fraction) { return start + (end - start) * fraction; }
+
+inline float GetDistanceSquared2D(Vec2 const& a, Vec2 const& b) { return (b - a).GetLengthSquared(); }
+inline float GetDistance2D(Vec2 const& a, Vec2 const& b) { return (b - a).GetLength(); }
+inline float DotProduct2D(Vec2 const& a, Vec2 const& b) { return a.x * b.x + a.y * b.y; }
+
+inline float SmoothStep5(float const t)
+{
+    return t * t * t * (t * (t * 6.f - 15.f) + 10.f);
+}
+
+inline float GetShortestAngularDispDegrees(float const startDegrees, float const endDegrees)
+{
+    float displacement = std::fmod(endDegrees - startDegrees, 360.f);
+    if (displacement > 180.f) displacement -= 360.f;
+    if (displacement < -180.f) displacement += 360.f;
+    return displacement;
+}
+
+inline float GetTurnedTowardDegrees(float const currentDegrees, float const goalDegrees, float const maxDeltaDegrees)
+{
+    float const displacement = GetShortestAngularDispDegrees(currentDegrees, goalDegrees);
+    if (std::fabs(displacement) <= maxDeltaDegrees) return goalDegrees;
+    return displacement > 0.f ? currentDegrees + maxDeltaDegrees : currentDegrees - maxDeltaDegrees;
+}
@@ -0,0 +1,39 @@
+//----------------------------------------------------------------------------------------------------
+// RandomNumberGenerator.hpp (test stand-in)
+// A seeded LCG, so every run of a benchmark sees the same rolls.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+class RandomNumberGenerator
+{
+public:
+    explicit RandomNumberGenerator(uint32_t const seed = 12345u) : m_state(seed) {}
+
+    int RollRandomIntInRange(int const minInclusive, int const maxInclusive)
+    {
+        return minInclusive + static_cast<int>(Next() % static_cast<uint32_t>(maxInclusive - minInclusive + 1));
+    }
+
+    float RollRandomFloatInRange(float const minInclusive, float const maxInclusive)
+    {
+        return minInclusive + (maxInclusive - minInclusive) * RollRandomFloatZeroToOne();
+    }
+
+    float RollRandomFloatZeroToOne() { return static_cast<float>(Next()) / static_cast<float>((1u << 24) - 1u); }
+
+private:
+    uint32_t Next()
+    {
+        m_state = m_state * 1664525u + 1013904223u;
+        return m_state >> 8;
+    }
+
+    uint32_t m_state = 12345u;
+};
+
+//----------------------------------------------------------------------------------------------------
+extern RandomNumberGenerator* g_rng;
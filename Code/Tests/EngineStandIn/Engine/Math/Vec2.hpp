@@ -0,0 +1,66 @@
+//----------------------------------------------------------------------------------------------------
+// Vec2.hpp (test stand-in)
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------
+struct Vec2
+{
+    float x = 0.f;
+    float y = 0.f;
+
+    Vec2() = default;
+    Vec2(float const initialX, float const initialY) : x(initialX), y(initialY) {}
+
+    static Vec2 MakeFromPolarDegrees(float const orientationDegrees, float const length = 1.f)
+    {
+        float const radians = orientationDegrees * 0.01745329252f;
+        return Vec2(std::cos(radians) * length, std::sin(radians) * length);
+    }
+
+    float GetLength() const { return std::sqrt(x * x + y * y); }
+    float GetLengthSquared() const { return x * x + y * y; }
+    float GetOrientationDegrees() const { return std::atan2(y, x) * 57.29577951f; }
+    Vec2  GetNormalized() const
+    {
+        float const length = GetLength();
+        return length > 0.f ? Vec2(x / length, y / length) : Vec2();
+    }
+
+    bool  operator==(Vec2 const& other) const { return x == other.x && y == other.y; }
+    bool  operator!=(Vec2 const& other) const { return !(*this == other); }
+    Vec2  operator+(Vec2 const& other) const { return Vec2(x + other.x, y + other.y); }
+    Vec2  operator-(Vec2 const& other) const { return Vec2(x - other.x, y - other.y); }
+    Vec2  operator-() const { return Vec2(-x, -y); }
+    Vec2  operator*(float const scale) const { return Vec2(x * scale, y * scale); }
+    Vec2  operator/(float const divisor) const { return Vec2(x / divisor, y / divisor); }
+    Vec2& operator+=(Vec2 const& other)
+    {
+        x += other.x;
+        y += other.y;
+        return *this;
+    }
+    Vec2& operator-=(Vec2 const& other)
+    {
+        x -= other.x;
+        y -= other.y;
+        return *this;
+    }
+    Vec2& operator*=(float const scale)
+    {
+        x *= scale;
+        y *= scale;
+        return *this;
+    }
+
+    static Vec2 const ZERO;
+    static Vec2 const ONE;
+};
+
+inline Vec2 const Vec2::ZERO = Vec2(0.f, 0.f);
+inline Vec2 const Vec2::ONE  = Vec2(1.f, 1.f);
+
+inline Vec2 operator*(float const scale, Vec2 const& vector) { return vector * scale; }
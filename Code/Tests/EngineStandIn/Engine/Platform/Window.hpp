@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------------------------------
+// Window.hpp (test stand-in)
+// Plain state holder; nothing here reaches an OS. Geometry setters record the value, and
+// UpdatePosition / UpdateDimension only count calls so tests can assert they are not made per frame.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eWindowType : int8_t
+{
+    WINDOWED,
+    FULLSCREEN_LETTERBOX,
+    FULLSCREEN_STRETCH,
+    FULLSCREEN_CROP
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sWindowConfig
+{
+    eWindowType m_windowType  = eWindowType::WINDOWED;
+    float       m_aspectRatio = 16.f / 9.f;
+    String      m_windowTitle = "Untitled App";
+};
+
+//----------------------------------------------------------------------------------------------------
+class Window
+{
+public:
+    explicit Window(sWindowConfig const& config) : m_config(config) {}
+
+    void Shutdown() { ++m_shutdownCount; }
+    void UpdatePosition() { ++m_updatePositionCount; }
+    void UpdateDimension() { ++m_updateDimensionCount; }
+
+    void* GetWindowHandle() const { return m_windowHandle; }
+    void* GetDisplayContext() const { return m_displayContext; }
+    Vec2  GetWindowPosition() const { return m_windowPosition; }
+    Vec2  GetWindowDimensions() const { return m_windowDimensions; }
+    Vec2  GetClientPosition() const { return m_clientPosition; }
+    Vec2  GetClientDimensions() const { return m_clientDimensions; }
+    Vec2  GetScreenDimensions() const { return m_screenDimensions; }
+
+    void SetWindowHandle(void* windowHandle) { m_windowHandle = windowHandle; }
+    void SetDisplayContext(void* displayContext) { m_displayContext = displayContext; }
+    void SetWindowPosition(Vec2 const& newPosition) { m_windowPosition = newPosition; }
+    void SetWindowDimensions(Vec2 const& newDimensions) { m_windowDimensions = newDimensions; }
+    void SetClientPosition(Vec2 const& newPosition) { m_clientPosition = newPosition; }
+    void SetClientDimensions(Vec2 const& newDimensions) { m_clientDimensions = newDimensions; }
+    void SetScreenDimensions(Vec2 const& newDimensions) { m_screenDimensions = newDimensions; }
+
+    bool m_shouldUpdatePosition  = false;
+    bool m_shouldUpdateDimension = false;
+
+    int m_shutdownCount        = 0;
+    int m_updatePositionCount  = 0;
+    int m_updateDimensionCount = 0;
+
+    static Window* s_mainWindow;
+
+private:
+    sWindowConfig m_config;
+    void*         m_windowHandle     = nullptr;
+    void*         m_displayContext   = nullptr;
+    Vec2          m_windowPosition   = Vec2::ZERO;
+    Vec2          m_windowDimensions = Vec2::ZERO;
+    Vec2          m_clientPosition   = Vec2::ZERO;
+    Vec2          m_clientDimensions = Vec2::ZERO;
+    Vec2          m_screenDimensions = Vec2(1920.f, 1080.f);
+};
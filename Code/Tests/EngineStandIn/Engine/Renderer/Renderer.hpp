@@ -0,0 +1,52 @@
+//----------------------------------------------------------------------------------------------------
+// Renderer.hpp (test stand-in)
+// Counts the calls WindowSubsystem and RenderPipeline make so tests can assert how much per-frame GPU
+// work they ask for. Draw state calls are accepted and ignored.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "Engine/Renderer/VertexUtils.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Shader;
+class Texture;
+class Window;
+
+//----------------------------------------------------------------------------------------------------
+enum class eBlendMode : int8_t { OPAQUE, ALPHA, ADDITIVE };
+enum class eRasterizerMode : int8_t { SOLID_CULL_NONE, SOLID_CULL_BACK, WIREFRAME_CULL_NONE, WIREFRAME_CULL_BACK };
+enum class eSamplerMode : int8_t { POINT_CLAMP, BILINEAR_CLAMP };
+enum class eDepthMode : int8_t { DISABLED, READ_ONLY_ALWAYS, READ_ONLY_LESS_EQUAL, READ_WRITE_LESS_EQUAL };
+
+//----------------------------------------------------------------------------------------------------
+class Renderer
+{
+public:
+    void CreateWindowSwapChain(Window const& window);
+    void ReadStagingTextureToPixelData();
+    void RenderViewportToWindow(Window const& window);
+
+    void    SetModelConstants() {}
+    void    SetBlendMode(eBlendMode) {}
+    void    SetRasterizerMode(eRasterizerMode) {}
+    void    SetSamplerMode(eSamplerMode) {}
+    void    SetDepthMode(eDepthMode) {}
+    void    BindTexture(Texture const*) {}
+    void    BindShader(Shader*) {}
+    Shader* CreateOrGetShaderFromFile(char const*) { return nullptr; }
+    void    DrawVertexArray(VertexList_PCU const& verts);
+
+    int    m_swapChainCreationCount = 0;
+    int    m_stagingReadbackCount   = 0;
+    int    m_viewportPresentCount   = 0;
+    int    m_drawCallCount          = 0;
+    size_t m_drawnVertexCount       = 0;
+    Vec2   m_lastPresentClientPosition;
+};
+
+//----------------------------------------------------------------------------------------------------
+extern Renderer* g_renderer;
@@ -0,0 +1,28 @@
+//----------------------------------------------------------------------------------------------------
+// VertexUtils.hpp (test stand-in)
+// Emits the same vertex counts as the engine: discs and rings are 32-sided, boxes are two triangles.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct Vertex_PCU
+{
+    Vec2  m_position;
+    float m_z = 0.f;
+    Rgba8 m_color;
+    Vec2  m_uvTexCoords;
+};
+
+typedef std::vector<Vertex_PCU> VertexList_PCU;
+
+//----------------------------------------------------------------------------------------------------
+void AddVertsForDisc2D(VertexList_PCU& verts, Vec2 const& discCenter, float discRadius, Rgba8 const& color);
+void AddVertsForDisc2D(VertexList_PCU& verts, Vec2 const& discCenter, float discRadius, float thickness, Rgba8 const& color);
+void AddVertsForAABB2D(VertexList_PCU& verts, AABB2 const& bounds, Rgba8 const& color = Rgba8::WHITE);
+void AddVertsForTriangle2D(VertexList_PCU& verts, Vec2 const& ccw0, Vec2 const& ccw1, Vec2 const& ccw2, Rgba8 const& color);
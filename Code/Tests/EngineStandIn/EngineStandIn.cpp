@@ -0,0 +1,134 @@
+//----------------------------------------------------------------------------------------------------
+// EngineStandIn.cpp
+// Definitions behind the stand-in engine headers, so engine-free game modules link on any platform.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+#include "Engine/Audio/AudioSystem.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Platform/Window.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+
+//----------------------------------------------------------------------------------------------------
+Window*                Window::s_mainWindow = nullptr;
+AudioSystem*           g_audio              = nullptr;
+Renderer*              g_renderer           = nullptr;
+RandomNumberGenerator* g_rng                = nullptr;
+
+//----------------------------------------------------------------------------------------------------
+String Stringf(char const* format, ...)
+{
+    char    text[2048];
+    va_list arguments;
+    va_start(arguments, format);
+    vsnprintf(text, sizeof(text), format, arguments);
+    va_end(arguments);
+    return String(text);
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebuggerPrintf(char const* format, ...)
+{
+    static bool const s_isVerbose = std::getenv("GAME_TEST_VERBOSE") != nullptr;
+    if (!s_isVerbose) return;
+
+    va_list arguments;
+    va_start(arguments, format);
+    vprintf(format, arguments);
+    va_end(arguments);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Renderer::CreateWindowSwapChain(Window const& window)
+{
+    UNUSED(window)
+    ++m_swapChainCreationCount;
+}
+
+void Renderer::ReadStagingTextureToPixelData()
+{
+    ++m_stagingReadbackCount;
+}
+
+void Renderer::RenderViewportToWindow(Window const& window)
+{
+    ++m_viewportPresentCount;
+    m_lastPresentClientPosition = window.GetClientPosition();
+}
+
+void Renderer::DrawVertexArray(VertexList_PCU const& verts)
+{
+    ++m_drawCallCount;
+    m_drawnVertexCount += verts.size();
+}
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int DISC_SIDE_COUNT = 32;
+
+    void AddVert(VertexList_PCU& verts, Vec2 const& position, Rgba8 const& color)
+    {
+        Vertex_PCU vert;
+        vert.m_position = position;
+        vert.m_color    = color;
+        verts.push_back(vert);
+    }
+}
+
+void AddVertsForDisc2D(VertexList_PCU& verts, Vec2 const& discCenter, float const discRadius, Rgba8 const& color)
+{
+    for (int side = 0; side < DISC_SIDE_COUNT; ++side)
+    {
+        float const startDegrees = 360.f * static_cast<float>(side) / static_cast<float>(DISC_SIDE_COUNT);
+        float const endDegrees   = 360.f * static_cast<float>(side + 1) / static_cast<float>(DISC_SIDE_COUNT);
+
+        AddVert(verts, discCenter, color);
+        AddVert(verts, discCenter + Vec2::MakeFromPolarDegrees(startDegrees, discRadius), color);
+        AddVert(verts, discCenter + Vec2::MakeFromPolarDegrees(endDegrees, discRadius), color);
+    }
+}
+
+void AddVertsForDisc2D(VertexList_PCU& verts, Vec2 const& discCenter, float const discRadius, float const thickness, Rgba8 const& color)
+{
+    float const innerRadius = discRadius - thickness * 0.5f;
+    float const outerRadius = discRadius + thickness * 0.5f;
+
+    for (int side = 0; side < DISC_SIDE_COUNT; ++side)
+    {
+        float const startDegrees = 360.f * static_cast<float>(side) / static_cast<float>(DISC_SIDE_COUNT);
+        float const endDegrees   = 360.f * static_cast<float>(side + 1) / static_cast<float>(DISC_SIDE_COUNT);
+        Vec2 const  innerStart   = discCenter + Vec2::MakeFromPolarDegrees(startDegrees, innerRadius);
+        Vec2 const  innerEnd     = discCenter + Vec2::MakeFromPolarDegrees(endDegrees, innerRadius);
+        Vec2 const  outerStart   = discCenter + Vec2::MakeFromPolarDegrees(startDegrees, outerRadius);
+        Vec2 const  outerEnd     = discCenter + Vec2::MakeFromPolarDegrees(endDegrees, outerRadius);
+
+        AddVert(verts, innerStart, color);
+        AddVert(verts, outerStart, color);
+        AddVert(verts, outerEnd, color);
+        AddVert(verts, innerStart, color);
+        AddVert(verts, outerEnd, color);
+        AddVert(verts, innerEnd, color);
+    }
+}
+
+void AddVertsForAABB2D(VertexList_PCU& verts, AABB2 const& bounds, Rgba8 const& color)
+{
+    Vec2 const bottomRight = Vec2(bounds.m_maxs.x, bounds.m_mins.y);
+    Vec2 const topLeft     = Vec2(bounds.m_mins.x, bounds.m_maxs.y);
+
+    AddVertsForTriangle2D(verts, bounds.m_mins, bottomRight, bounds.m_maxs, color);
+    AddVertsForTriangle2D(verts, bounds.m_mins, bounds.m_maxs, topLeft, color);
+}
+
+void AddVertsForTriangle2D(VertexList_PCU& verts, Vec2 const& ccw0, Vec2 const& ccw1, Vec2 const& ccw2, Rgba8 const& color)
+{
+    AddVert(verts, ccw0, color);
+    AddVert(verts, ccw1, color);
+    AddVert(verts, ccw2, color);
+}
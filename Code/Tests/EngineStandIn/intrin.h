@@ -0,0 +1,8 @@
+//----------------------------------------------------------------------------------------------------
+// intrin.h (test stand-in)
+// MSVC's intrinsics header; GCC and Clang declare __rdtsc and friends in x86intrin.h.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <x86intrin.h>
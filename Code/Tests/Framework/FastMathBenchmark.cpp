@@ -0,0 +1,160 @@
+//----------------------------------------------------------------------------------------------------
+// FastMathBenchmark.cpp
+// Nanoseconds per call of FastMath against the CRT-backed MathUtils it replaces in EnemyUtils: sincos,
+// atan2, and one chase turn step (angle arithmetic vs the vector-space TurnTowardDirection). 64k
+// inputs, 200 passes, results summed so nothing is optimised away.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <chrono>
+#include <vector>
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/Framework/FastMath.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int INPUT_COUNT = 1 << 16;
+    constexpr int PASS_COUNT  = 200;
+
+    struct sInputs
+    {
+        std::vector<float> m_degrees;
+        std::vector<float> m_x;
+        std::vector<float> m_y;
+    };
+
+    volatile float s_sink = 0.f;
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    sInputs MakeInputs()
+    {
+        RandomNumberGenerator rng;
+        sInputs               inputs;
+        for (int i = 0; i < INPUT_COUNT; ++i)
+        {
+            inputs.m_degrees.push_back(rng.RollRandomFloatInRange(-1e4f, 1e4f));
+            inputs.m_x.push_back(rng.RollRandomFloatInRange(-1000.f, 1000.f));
+            inputs.m_y.push_back(rng.RollRandomFloatInRange(-1000.f, 1000.f));
+        }
+        return inputs;
+    }
+
+    // Runs pass() PASS_COUNT times; returns nanoseconds per input
+    template <typename PassFunction>
+    double MeasureNanosecondsPerCall(PassFunction const& pass)
+    {
+        double const startSeconds = GetNowSeconds();
+        for (int passIndex = 0; passIndex < PASS_COUNT; ++passIndex) s_sink = pass(passIndex);
+        return (GetNowSeconds() - startSeconds) * 1e9 / (static_cast<double>(PASS_COUNT) * INPUT_COUNT);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SinCosCost)
+{
+    sInputs const      inputs = MakeInputs();
+    std::vector<float> outSin(INPUT_COUNT);
+    std::vector<float> outCos(INPUT_COUNT);
+
+    double const crtNanoseconds = MeasureNanosecondsPerCall([&](int)
+    {
+        float sum = 0.f;
+        for (float const degrees : inputs.m_degrees) sum += SinDegrees(degrees) + CosDegrees(degrees);
+        return sum;
+    });
+
+    double const scalarNanoseconds = MeasureNanosecondsPerCall([&](int)
+    {
+        float sum = 0.f;
+        for (float const degrees : inputs.m_degrees)
+        {
+            float sinValue;
+            float cosValue;
+            FastMath::SinCosDegrees(degrees, sinValue, cosValue);
+            sum += sinValue + cosValue;
+        }
+        return sum;
+    });
+
+    double const batchNanoseconds = MeasureNanosecondsPerCall([&](int passIndex)
+    {
+        FastMath::SinCosDegrees(inputs.m_degrees.data(), outSin.data(), outCos.data(), INPUT_COUNT);
+        return outSin[passIndex];
+    });
+
+    std::printf("    sincos: CRT %.1f ns, scalar %.1f ns, batch %.1f ns\n", crtNanoseconds, scalarNanoseconds, batchNanoseconds);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(Atan2Cost)
+{
+    sInputs const      inputs = MakeInputs();
+    std::vector<float> outDegrees(INPUT_COUNT);
+
+    double const crtNanoseconds = MeasureNanosecondsPerCall([&](int)
+    {
+        float sum = 0.f;
+        for (int i = 0; i < INPUT_COUNT; ++i) sum += Atan2Degrees(inputs.m_y[i], inputs.m_x[i]);
+        return sum;
+    });
+
+    double const scalarNanoseconds = MeasureNanosecondsPerCall([&](int)
+    {
+        float sum = 0.f;
+        for (int i = 0; i < INPUT_COUNT; ++i) sum += FastMath::Atan2Degrees(inputs.m_y[i], inputs.m_x[i]);
+        return sum;
+    });
+
+    double const batchNanoseconds = MeasureNanosecondsPerCall([&](int passIndex)
+    {
+        FastMath::Atan2Degrees(inputs.m_y.data(), inputs.m_x.data(), outDegrees.data(), INPUT_COUNT);
+        return outDegrees[passIndex];
+    });
+
+    std::printf("    atan2:  CRT %.1f ns, scalar %.1f ns, batch %.1f ns\n", crtNanoseconds, scalarNanoseconds, batchNanoseconds);
+}
+
+//----------------------------------------------------------------------------------------------------
+// One SteerToward heading update at 6 degrees per step, as the chasers did it before and after
+TEST(ChaseTurnStepCost)
+{
+    sInputs const inputs = MakeInputs();
+
+    double const angleNanoseconds = MeasureNanosecondsPerCall([&](int)
+    {
+        float sum = 0.f;
+        for (int i = 0; i < INPUT_COUNT; ++i)
+        {
+            float const goalDegrees        = Atan2Degrees(inputs.m_y[i], inputs.m_x[i]);
+            float const orientationDegrees = GetTurnedTowardDegrees(inputs.m_degrees[i], goalDegrees, 6.f);
+            sum += CosDegrees(orientationDegrees) + SinDegrees(orientationDegrees);
+        }
+        return sum;
+    });
+
+    float sinMaxTurn;
+    float cosMaxTurn;
+    FastMath::SinCosDegrees(6.f, sinMaxTurn, cosMaxTurn);
+
+    double const vectorNanoseconds = MeasureNanosecondsPerCall([&](int)
+    {
+        float sum = 0.f;
+        for (int i = 0; i < INPUT_COUNT; ++i)
+        {
+            Vec2 const goalDirection = Vec2(inputs.m_x[i], inputs.m_y[i]).GetNormalized();
+            Vec2 const heading       = FastMath::TurnTowardDirection(FastMath::MakeFromPolarDegrees(inputs.m_degrees[i]), goalDirection, cosMaxTurn, sinMaxTurn);
+            sum += FastMath::GetOrientationDegrees(heading) + heading.x;
+        }
+        return sum;
+    });
+
+    std::printf("    chase turn step: angles %.1f ns, vectors %.1f ns\n", angleNanoseconds, vectorNanoseconds);
+}
@@ -0,0 +1,151 @@
+//----------------------------------------------------------------------------------------------------
+// FastMathTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/Framework/FastMath.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int    SAMPLE_COUNT       = 10000000;
+    constexpr double DEGREES_TO_RADIANS = 3.14159265358979323846 / 180.0;
+
+    // Alternates small angles with the [-1e6, 1e6] range the header documents
+    float GetSampleDegrees(RandomNumberGenerator& rng, int const sample)
+    {
+        return (sample & 1) ? rng.RollRandomFloatInRange(-1e6f, 1e6f) : rng.RollRandomFloatInRange(-1e4f, 1e4f);
+    }
+
+    double GetAngularError(double const degrees, double const referenceDegrees)
+    {
+        double const error = std::fabs(degrees - referenceDegrees);
+        return error > 180.0 ? 360.0 - error : error;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SinCosMatchTheCrt)
+{
+    RandomNumberGenerator rng;
+    double                maxSinError = 0.0;
+    double                maxCosError = 0.0;
+
+    for (int sample = 0; sample < SAMPLE_COUNT; ++sample)
+    {
+        float const degrees = GetSampleDegrees(rng, sample);
+        float       sinValue;
+        float       cosValue;
+        FastMath::SinCosDegrees(degrees, sinValue, cosValue);
+
+        double const radians = static_cast<double>(degrees) * DEGREES_TO_RADIANS;
+        maxSinError          = (std::max)(maxSinError, std::fabs(sinValue - std::sin(radians)));
+        maxCosError          = (std::max)(maxCosError, std::fabs(cosValue - std::cos(radians)));
+    }
+
+    std::printf("    max error: sin %.2g, cos %.2g\n", maxSinError, maxCosError);
+
+    CHECK(maxSinError < 4e-7);
+    CHECK(maxCosError < 4e-7);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(Atan2MatchesTheCrt)
+{
+    RandomNumberGenerator rng;
+    double                maxError = 0.0;
+
+    for (int sample = 0; sample < SAMPLE_COUNT; ++sample)
+    {
+        float const y = (sample % 7 == 0) ? 0.f : rng.RollRandomFloatInRange(-1000.f, 1000.f);
+        float const x = (sample % 11 == 0) ? 0.f : rng.RollRandomFloatInRange(-1000.f, 1000.f);
+
+        double const referenceDegrees = std::atan2(static_cast<double>(y), static_cast<double>(x)) / DEGREES_TO_RADIANS;
+        maxError                      = (std::max)(maxError, GetAngularError(FastMath::Atan2Degrees(y, x), referenceDegrees));
+    }
+
+    std::printf("    max error: atan2 %.2g degrees\n", maxError);
+
+    CHECK(maxError < 1.5e-4);
+    CHECK_EQUAL(FastMath::Atan2Degrees(0.f, 0.f), 0.f);
+    CHECK_NEAR(FastMath::Atan2Degrees(0.f, -1.f), 180.f, 1e-4f);
+    CHECK_NEAR(FastMath::Atan2Degrees(1.f, 0.f), 90.f, 1e-4f);
+    CHECK_NEAR(FastMath::Atan2Degrees(-1.f, 0.f), -90.f, 1e-4f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ScalarAndSseAgreeBitForBit)
+{
+    constexpr int COUNT = 4099;     // Not a multiple of four, so the batch scalar tail runs too
+
+    RandomNumberGenerator rng;
+    std::vector<float>    degrees(COUNT);
+    std::vector<float>    y(COUNT);
+    std::vector<float>    x(COUNT);
+    for (int i = 0; i < COUNT; ++i)
+    {
+        degrees[i] = GetSampleDegrees(rng, i);
+        y[i]       = rng.RollRandomFloatInRange(-1000.f, 1000.f);
+        x[i]       = rng.RollRandomFloatInRange(-1000.f, 1000.f);
+    }
+
+    std::vector<float> batchSin(COUNT);
+    std::vector<float> batchCos(COUNT);
+    std::vector<float> batchAtan2(COUNT);
+    FastMath::SinCosDegrees(degrees.data(), batchSin.data(), batchCos.data(), COUNT);
+    FastMath::Atan2Degrees(y.data(), x.data(), batchAtan2.data(), COUNT);
+
+    int mismatchCount = 0;
+    for (int i = 0; i < COUNT; ++i)
+    {
+        float sinValue;
+        float cosValue;
+        FastMath::SinCosDegrees(degrees[i], sinValue, cosValue);
+
+        __m128 laneSin;
+        __m128 laneCos;
+        FastMath::SinCosDegrees4(_mm_set1_ps(degrees[i]), laneSin, laneCos);
+
+        if (sinValue != _mm_cvtss_f32(laneSin) || cosValue != _mm_cvtss_f32(laneCos)) ++mismatchCount;
+        if (sinValue != batchSin[i] || cosValue != batchCos[i]) ++mismatchCount;
+        if (FastMath::Atan2Degrees(y[i], x[i]) != batchAtan2[i]) ++mismatchCount;
+    }
+
+    CHECK_EQUAL(mismatchCount, 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(TurnTowardDirectionMatchesTurnedTowardDegrees)
+{
+    RandomNumberGenerator rng;
+    double                maxError = 0.0;
+
+    for (int sample = 0; sample < 1000000; ++sample)
+    {
+        float const currentDegrees = rng.RollRandomFloatInRange(-1e4f, 1e4f);
+        float const goalDegrees    = rng.RollRandomFloatInRange(-1e4f, 1e4f);
+        float const maxTurnDegrees = rng.RollRandomFloatInRange(0.f, 180.f);
+
+        // Within a hair of 180 either way round is right
+        if (std::fabs(GetShortestAngularDispDegrees(currentDegrees, goalDegrees)) > 179.9f) continue;
+
+        float sinMaxTurn;
+        float cosMaxTurn;
+        FastMath::SinCosDegrees(maxTurnDegrees, sinMaxTurn, cosMaxTurn);
+
+        Vec2 const  turned           = FastMath::TurnTowardDirection(FastMath::MakeFromPolarDegrees(currentDegrees), FastMath::MakeFromPolarDegrees(goalDegrees), cosMaxTurn, sinMaxTurn);
+        float const referenceDegrees = GetTurnedTowardDegrees(currentDegrees, goalDegrees, maxTurnDegrees);
+        maxError                     = (std::max)(maxError, static_cast<double>(std::fabs(GetShortestAngularDispDegrees(FastMath::GetOrientationDegrees(turned), referenceDegrees))));
+    }
+
+    std::printf("    max error: turn toward %.2g degrees\n", maxError);
+
+    CHECK(maxError < 1e-3);
+}
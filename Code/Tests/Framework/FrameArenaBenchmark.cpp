@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------------------------------
+// FrameArenaBenchmark.cpp
+// Heap allocations per frame, counted by the GAME_TRACK_HEAP_ALLOCATIONS operator new the test tree
+// builds FrameArena.cpp with. First the per-entity scratch the arena replaced (vertex list, health
+// label, completed-animation list), the old way and through the arena; then a window-heavy frame
+// through WindowSubsystem, CoinField, ProjectileSystem and RenderPipeline as they are now.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+#include "Game/Framework/RenderPipeline.hpp"
+#include "Game/Gameplay/CoinField.hpp"
+#include "Game/Gameplay/ProjectileSystem.hpp"
+#include "Harness/TestHarness.hpp"
+#include "Subsystem/Window/WindowSubsystemFixture.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int ENEMY_COUNT        = 60;
+    constexpr int WARMUP_FRAME_COUNT = 10;
+    constexpr int FRAME_COUNT        = 600;
+
+    struct sHeapAllocationStats
+    {
+        double m_averagePerFrame = 0.0;
+        size_t m_worstFrame      = 0;
+        double m_millisecondsPerFrame = 0.0;
+    };
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // One frame of what every enemy did in Render and Update before the arena: its own vertex list,
+    // a Stringf health label and, once per frame, a list of the window animations that finished
+    void RunEntityScratchFrame(FrameArena& arena, Renderer& renderer, int const frame, bool const isUsingArena)
+    {
+        for (int enemy = 0; enemy < ENEMY_COUNT; ++enemy)
+        {
+            Vec2 const position = Vec2(static_cast<float>(enemy * 30), static_cast<float>(frame % 500));
+            int const  health   = 1000 - (frame + enemy) % 1000;
+
+            if (isUsingArena)
+            {
+                VertexList_PCU& verts = arena.AcquireVertexList();
+                AddVertsForDisc2D(verts, position, 30.f, Rgba8::WHITE);
+                renderer.DrawVertexArray(verts);
+
+                std::string_view const label = arena.Format("Health=%d", health);
+                renderer.m_drawnVertexCount += label.size();
+            }
+            else
+            {
+                VertexList_PCU verts;
+                AddVertsForDisc2D(verts, position, 30.f, Rgba8::WHITE);
+                renderer.DrawVertexArray(verts);
+
+                String const label = Stringf("Health=%d", health);
+                renderer.m_drawnVertexCount += label.size();
+            }
+        }
+
+        if (isUsingArena)
+        {
+            FrameVector<int> completedAnimations = arena.MakeVector<int>(ENEMY_COUNT);
+            for (int enemy = 0; enemy < ENEMY_COUNT; enemy += 7) completedAnimations.push_back(enemy);
+            renderer.m_drawnVertexCount += completedAnimations.size();
+        }
+        else
+        {
+            std::vector<int> completedAnimations;
+            for (int enemy = 0; enemy < ENEMY_COUNT; enemy += 7) completedAnimations.push_back(enemy);
+            renderer.m_drawnVertexCount += completedAnimations.size();
+        }
+    }
+
+    sHeapAllocationStats MeasureEntityScratch(bool const isUsingArena)
+    {
+        FrameArena           arena(sFrameArenaConfig{});
+        Renderer             renderer;
+        sHeapAllocationStats stats;
+        size_t               totalAllocations = 0;
+        double               elapsedSeconds   = 0.0;
+
+        for (int frame = 0; frame < WARMUP_FRAME_COUNT + FRAME_COUNT; ++frame)
+        {
+            double const startSeconds = GetNowSeconds();
+            RunEntityScratchFrame(arena, renderer, frame, isUsingArena);
+            double const frameSeconds = GetNowSeconds() - startSeconds;
+            arena.EndFrame();
+
+            if (frame < WARMUP_FRAME_COUNT) continue;
+
+            totalAllocations += arena.GetHeapAllocationCountLastFrame();
+            stats.m_worstFrame = (std::max)(stats.m_worstFrame, arena.GetHeapAllocationCountLastFrame());
+            elapsedSeconds += frameSeconds;
+        }
+
+        stats.m_averagePerFrame      = static_cast<double>(totalAllocations) / FRAME_COUNT;
+        stats.m_millisecondsPerFrame = elapsedSeconds * 1000.0 / FRAME_COUNT;
+        return stats;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(EntityScratchHeapAllocationsPerFrame)
+{
+    sHeapAllocationStats const before = MeasureEntityScratch(false);
+    sHeapAllocationStats const after  = MeasureEntityScratch(true);
+
+    std::printf("    %d enemies, %d frames after %d warm-up frames\n", ENEMY_COUNT, FRAME_COUNT, WARMUP_FRAME_COUNT);
+    std::printf("    std::vector / Stringf: %.1f heap allocs/frame (worst %zu), %.4f ms/frame\n", before.m_averagePerFrame, before.m_worstFrame, before.m_millisecondsPerFrame);
+    std::printf("    frame arena:           %.1f heap allocs/frame (worst %zu), %.4f ms/frame\n", after.m_averagePerFrame, after.m_worstFrame, after.m_millisecondsPerFrame);
+
+    CHECK(before.m_averagePerFrame >= ENEMY_COUNT);     // At least the vertex lists; the counter is live
+    CHECK_EQUAL(after.m_worstFrame, 0u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(WindowHeavyFrameHeapAllocations)
+{
+    sWindowSubsystemFixture fixture;
+
+    std::vector<WindowID> windowIDs;
+    for (int enemy = 0; enemy < ENEMY_COUNT; ++enemy)
+    {
+        windowIDs.push_back(fixture.m_windowSubsystem.CreateChildWindow(static_cast<EntityID>(enemy + 1), "Enemy", 30 * enemy, 100, 200, 200));
+    }
+
+    sRenderPipelineConfig pipelineConfig;
+    pipelineConfig.m_isThreaded = false;
+    pipelineConfig.m_isHeadless = true;
+    RenderPipeline   pipeline(pipelineConfig);
+    CoinField        coinField(sCoinFieldConfig{});
+    ProjectileSystem projectiles(sProjectileSystemConfig{});
+
+    std::vector<sProjectileTarget> const playerTarget = {{Vec2(100.f, 100.f), 30.f, 0}};
+    std::vector<sProjectileHit>          hits;
+
+    size_t totalAllocations = 0;
+    size_t worstFrame       = 0;
+
+    for (int frame = 0; frame < WARMUP_FRAME_COUNT + FRAME_COUNT; ++frame)
+    {
+        fixture.m_windowSubsystem.BeginFrame();
+
+        // A few windows start a short animation every frame, so some finish every frame too
+        for (int i = 0; i < 5; ++i)
+        {
+            WindowID const windowID = windowIDs[(frame * 5 + i) % ENEMY_COUNT];
+            fixture.m_windowSubsystem.AnimateWindowPosition(windowID, Vec2(static_cast<float>(frame % 1000), 100.f), 0.1f);
+        }
+
+        for (int i = 0; i < 10; ++i)
+        {
+            projectiles.SpawnProjectile(Vec2(960.f, 540.f), Vec2::MakeFromPolarDegrees(static_cast<float>(frame * 10 + i * 36)), 2000.f, 4.f, eProjectileFaction::PLAYER, Rgba8::WHITE);
+        }
+        if (frame % 30 == 0) coinField.SpawnStack(Vec2(static_cast<float>(frame % 1920), 300.f), 5);
+
+        fixture.m_windowSubsystem.Update(FRAME_SECONDS, true);
+        projectiles.Update(FRAME_SECONDS);
+        projectiles.CollideWithTargets(eProjectileFaction::PLAYER, playerTarget, AABB2(0.f, 0.f, 1920.f, 1080.f), hits);
+        coinField.Update(FRAME_SECONDS, Vec2(960.f, 540.f), 30.f);
+
+        sRenderSnapshot& snapshot = pipeline.GetSnapshotToFill();
+        snapshot.m_screenBounds   = AABB2(0.f, 0.f, 1920.f, 1080.f);
+        fixture.m_windowSubsystem.GetVisibleClientRects(snapshot.m_visibleWindowRects);
+        fixture.m_windowSubsystem.GetWindowGeometry(snapshot.m_windowGeometry);
+        coinField.AppendRenderShapes(snapshot.m_shapes);
+        projectiles.AppendRenderShapes(snapshot.m_shapes);
+        pipeline.PublishSnapshot();
+        pipeline.Submit();
+
+        fixture.m_windowSubsystem.Render(pipeline.GetDrawnWindowGeometry());
+        fixture.m_windowSubsystem.EndFrame();
+        fixture.m_frameArena.EndFrame();
+
+        if (frame < WARMUP_FRAME_COUNT) continue;
+
+        totalAllocations += fixture.m_frameArena.GetHeapAllocationCountLastFrame();
+        worstFrame = (std::max)(worstFrame, fixture.m_frameArena.GetHeapAllocationCountLastFrame());
+    }
+
+    std::printf("    %d child windows, 5 animations and 10 projectiles started per frame\n", ENEMY_COUNT);
+    std::printf("    heap allocs/frame: %.2f average, %zu worst (%zu projectiles, %d coin stacks live at the end)\n",
+                static_cast<double>(totalAllocations) / FRAME_COUNT, worstFrame, static_cast<size_t>(projectiles.GetProjectileCount()), coinField.GetStackCount());
+}
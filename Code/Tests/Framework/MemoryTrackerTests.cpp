@@ -0,0 +1,140 @@
+//----------------------------------------------------------------------------------------------------
+// MemoryTrackerTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "Game/Framework/MemoryTracker.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    class TaggedBase
+    {
+    public:
+        GAME_MEMORY_TAG(eMemoryTag::WIDGET)
+
+        virtual ~TaggedBase() = default;
+
+        int m_value = 0;
+    };
+
+    // Larger than its base, so the sized delete must receive the dynamic size
+    class TaggedDerived : public TaggedBase
+    {
+    public:
+        double m_payload[16] = {};
+    };
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(HighWaterMarkKeepsThePeak)
+{
+    sMemoryTagStats const before = MemoryTracker::GetStats(eMemoryTag::COIN);
+    size_t const          peak   = before.m_liveBytes + before.m_highWaterBytes + 4096;
+
+    MemoryTracker::RecordAllocation(eMemoryTag::COIN, before.m_highWaterBytes + 4096);
+    CHECK_EQUAL(MemoryTracker::GetStats(eMemoryTag::COIN).m_highWaterBytes, peak);
+
+    MemoryTracker::RecordFree(eMemoryTag::COIN, before.m_highWaterBytes + 4096);
+    sMemoryTagStats const after = MemoryTracker::GetStats(eMemoryTag::COIN);
+    CHECK_EQUAL(after.m_liveBytes, before.m_liveBytes);
+    CHECK_EQUAL(after.m_highWaterBytes, peak);
+
+    // A resize only moves the mark when it grows past it
+    MemoryTracker::RecordResize(eMemoryTag::COIN, 0, 100);
+    MemoryTracker::RecordResize(eMemoryTag::COIN, 100, 0);
+    CHECK_EQUAL(MemoryTracker::GetStats(eMemoryTag::COIN).m_highWaterBytes, peak);
+    CHECK_EQUAL(MemoryTracker::GetStats(eMemoryTag::COIN).m_liveBytes, before.m_liveBytes);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ConcurrentUpdatesLoseNothing)
+{
+    constexpr int    THREAD_COUNT    = 8;
+    constexpr int    ITERATION_COUNT = 100000;
+    constexpr size_t BLOCK_BYTES     = 64;
+
+    sMemoryTagStats const before = MemoryTracker::GetStats(eMemoryTag::VERTEX_LIST);
+
+    std::vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < THREAD_COUNT; ++threadIndex)
+    {
+        threads.emplace_back([]
+        {
+            for (int i = 0; i < ITERATION_COUNT; ++i)
+            {
+                MemoryTracker::RecordAllocation(eMemoryTag::VERTEX_LIST, BLOCK_BYTES);
+                MemoryTracker::RecordFree(eMemoryTag::VERTEX_LIST, BLOCK_BYTES);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    sMemoryTagStats const after = MemoryTracker::GetStats(eMemoryTag::VERTEX_LIST);
+    CHECK_EQUAL(after.m_liveBytes, before.m_liveBytes);
+    CHECK_EQUAL(after.m_liveAllocationCount, before.m_liveAllocationCount);
+    CHECK_EQUAL(after.m_totalAllocationCount, before.m_totalAllocationCount + static_cast<size_t>(THREAD_COUNT) * ITERATION_COUNT);
+
+    // At most every thread held its block at once; the CAS loop must never record more than that
+    CHECK(after.m_highWaterBytes >= before.m_liveBytes + BLOCK_BYTES);
+    CHECK(after.m_highWaterBytes <= (std::max)(before.m_highWaterBytes, before.m_liveBytes + THREAD_COUNT * BLOCK_BYTES));
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(TrackedAllocatorChargesItsTag)
+{
+    sMemoryTagStats const before = MemoryTracker::GetStats(eMemoryTag::PROJECTILE);
+
+    {
+        TrackedVector<float, eMemoryTag::PROJECTILE> values;
+        values.reserve(1000);
+
+        sMemoryTagStats const reserved = MemoryTracker::GetStats(eMemoryTag::PROJECTILE);
+        CHECK_EQUAL(reserved.m_liveBytes, before.m_liveBytes + 1000 * sizeof(float));
+        CHECK_EQUAL(reserved.m_liveAllocationCount, before.m_liveAllocationCount + 1);
+        CHECK_EQUAL(reserved.m_totalAllocationCount, before.m_totalAllocationCount + 1);
+
+        // Growing past the capacity frees the old block and charges the new one
+        values.resize(1001);
+        sMemoryTagStats const grown = MemoryTracker::GetStats(eMemoryTag::PROJECTILE);
+        CHECK_EQUAL(grown.m_liveBytes, before.m_liveBytes + values.capacity() * sizeof(float));
+        CHECK_EQUAL(grown.m_liveAllocationCount, before.m_liveAllocationCount + 1);
+        CHECK_EQUAL(grown.m_totalAllocationCount, before.m_totalAllocationCount + 2);
+    }
+
+    sMemoryTagStats const after = MemoryTracker::GetStats(eMemoryTag::PROJECTILE);
+    CHECK_EQUAL(after.m_liveBytes, before.m_liveBytes);
+    CHECK_EQUAL(after.m_liveAllocationCount, before.m_liveAllocationCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(MemoryTagNewAndDeletePair)
+{
+    sMemoryTagStats const before = MemoryTracker::GetStats(eMemoryTag::WIDGET);
+
+    TaggedBase* base    = new TaggedBase();
+    TaggedBase* derived = new TaggedDerived();
+
+    sMemoryTagStats const live = MemoryTracker::GetStats(eMemoryTag::WIDGET);
+    CHECK_EQUAL(live.m_liveBytes, before.m_liveBytes + sizeof(TaggedBase) + sizeof(TaggedDerived));
+    CHECK_EQUAL(live.m_liveAllocationCount, before.m_liveAllocationCount + 2);
+
+    // Deleted through the base pointer: the virtual destructor hands the sized delete the derived size
+    delete derived;
+    CHECK_EQUAL(MemoryTracker::GetStats(eMemoryTag::WIDGET).m_liveBytes, before.m_liveBytes + sizeof(TaggedBase));
+
+    delete base;
+    sMemoryTagStats const after = MemoryTracker::GetStats(eMemoryTag::WIDGET);
+    CHECK_EQUAL(after.m_liveBytes, before.m_liveBytes);
+    CHECK_EQUAL(after.m_liveAllocationCount, before.m_liveAllocationCount);
+    CHECK_EQUAL(after.m_totalAllocationCount, before.m_totalAllocationCount + 2);
+}
@@ -0,0 +1,164 @@
+//----------------------------------------------------------------------------------------------------
+// RenderCullingBenchmark.cpp
+// Vertices RenderPipeline builds for a busy frame with and without culling against the visible child
+// windows, next to the vertices of the shapes that actually overlap a window.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/RenderPipeline.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr float SCREEN_WIDTH      = 1920.f;
+    constexpr float SCREEN_HEIGHT     = 1080.f;
+    constexpr int   ENEMY_COUNT       = 60;
+    constexpr int   COIN_COUNT        = 500;
+    constexpr int   PROJECTILE_COUNT  = 2000;
+    constexpr int   FRAME_COUNT       = 200;
+    constexpr float ENEMY_WINDOW_SIZE = 200.f;
+
+    struct sScene
+    {
+        std::vector<AABB2>        m_windowRects;
+        std::vector<sRenderShape> m_shapes;
+    };
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Deterministic LCG so every run draws the same frame
+    struct sSceneRandom
+    {
+        uint32_t m_state = 2024u;
+
+        float RollFloat(float const minValue, float const maxValue)
+        {
+            m_state = m_state * 1664525u + 1013904223u;
+            return minValue + (maxValue - minValue) * static_cast<float>(m_state >> 8) / static_cast<float>(1u << 24);
+        }
+    };
+
+    sRenderShape MakeShape(eRenderShape const shape, Vec2 const& position, float const radius)
+    {
+        sRenderShape renderShape;
+        renderShape.m_shape      = shape;
+        renderShape.m_position   = position;
+        renderShape.m_radius     = radius;
+        renderShape.m_cullRadius = radius;
+        return renderShape;
+    }
+
+    // Mid-wave layout: the player window in the middle, one window per enemy around it, and coins and
+    // projectiles spread over the whole screen whether or not a window shows them
+    sScene BuildScene()
+    {
+        sScene       scene;
+        sSceneRandom random;
+
+        Vec2 const playerPosition = Vec2(SCREEN_WIDTH * 0.5f, SCREEN_HEIGHT * 0.5f);
+        scene.m_windowRects.push_back(AABB2(playerPosition - Vec2(300.f, 300.f), playerPosition + Vec2(300.f, 300.f)));
+
+        sRenderShape player = MakeShape(eRenderShape::RING, playerPosition, 40.f);
+        player.m_thickness  = 6.f;
+        player.m_isEntity   = true;
+        scene.m_shapes.push_back(player);
+
+        for (int i = 0; i < ENEMY_COUNT; ++i)
+        {
+            Vec2 const position = Vec2(random.RollFloat(0.f, SCREEN_WIDTH), random.RollFloat(0.f, SCREEN_HEIGHT));
+            Vec2 const halfSize = Vec2(ENEMY_WINDOW_SIZE, ENEMY_WINDOW_SIZE) * 0.5f;
+            scene.m_windowRects.push_back(AABB2(position - halfSize, position + halfSize));
+
+            sRenderShape enemy = MakeShape(eRenderShape::POLYGON, position, 30.f);
+            enemy.m_sideCount  = static_cast<uint8_t>(5 + i % 4);
+            enemy.m_isEntity   = true;
+            scene.m_shapes.push_back(enemy);
+        }
+
+        for (int i = 0; i < COIN_COUNT; ++i)
+        {
+            scene.m_shapes.push_back(MakeShape(eRenderShape::DISC, Vec2(random.RollFloat(0.f, SCREEN_WIDTH), random.RollFloat(0.f, SCREEN_HEIGHT)), 6.f));
+        }
+
+        for (int i = 0; i < PROJECTILE_COUNT; ++i)
+        {
+            scene.m_shapes.push_back(MakeShape(eRenderShape::DISC, Vec2(random.RollFloat(0.f, SCREEN_WIDTH), random.RollFloat(0.f, SCREEN_HEIGHT)), 4.f));
+        }
+
+        return scene;
+    }
+
+    // Publishes the scene FRAME_COUNT times through an inline headless pipeline; returns ms per frame
+    double RunFrames(std::vector<AABB2> const& windowRects, std::vector<sRenderShape> const& shapes, size_t& outVertexCount)
+    {
+        sRenderPipelineConfig config;
+        config.m_isThreaded = false;
+        config.m_isHeadless = true;
+        RenderPipeline pipeline(config);
+
+        double const startSeconds = GetNowSeconds();
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            sRenderSnapshot& snapshot     = pipeline.GetSnapshotToFill();
+            snapshot.m_screenBounds       = AABB2(0.f, 0.f, SCREEN_WIDTH, SCREEN_HEIGHT);
+            snapshot.m_visibleWindowRects = windowRects;
+            snapshot.m_shapes             = shapes;
+            pipeline.PublishSnapshot();
+            pipeline.Submit();
+        }
+
+        outVertexCount = pipeline.GetVertexCount();
+        return (GetNowSeconds() - startSeconds) * 1000.0 / FRAME_COUNT;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(CulledVerticesMatchVisibleVertices)
+{
+    sScene const scene = BuildScene();
+
+    // Without culling: one window over the whole screen keeps every shape
+    std::vector<AABB2> const fullScreen = {AABB2(0.f, 0.f, SCREEN_WIDTH, SCREEN_HEIGHT)};
+    size_t                   generatedWithoutCulling = 0;
+    double const             unculledMilliseconds    = RunFrames(fullScreen, scene.m_shapes, generatedWithoutCulling);
+
+    size_t       generatedWithCulling = 0;
+    double const culledMilliseconds   = RunFrames(scene.m_windowRects, scene.m_shapes, generatedWithCulling);
+
+    // Brute force: the shapes whose bounds overlap at least one window, built without culling
+    std::vector<sRenderShape> visibleShapes;
+    for (sRenderShape const& shape : scene.m_shapes)
+    {
+        Vec2 const  extent = Vec2(shape.m_cullRadius, shape.m_cullRadius);
+        AABB2 const bounds = AABB2(shape.m_position - extent, shape.m_position + extent);
+
+        for (AABB2 const& windowRect : scene.m_windowRects)
+        {
+            if (!RectSpatialIndex::DoRectsOverlap(bounds, windowRect)) continue;
+
+            visibleShapes.push_back(shape);
+            break;
+        }
+    }
+
+    size_t visibleVertexCount = 0;
+    RunFrames(fullScreen, visibleShapes, visibleVertexCount);
+
+    std::printf("    shapes %zu, windows %zu, visible shapes %zu\n", scene.m_shapes.size(), scene.m_windowRects.size(), visibleShapes.size());
+    std::printf("    vertices generated without culling: %zu (%.3f ms/frame)\n", generatedWithoutCulling, unculledMilliseconds);
+    std::printf("    vertices generated with culling:    %zu (%.3f ms/frame)\n", generatedWithCulling, culledMilliseconds);
+    std::printf("    vertices actually visible:          %zu\n", visibleVertexCount);
+
+    CHECK_EQUAL(generatedWithCulling, visibleVertexCount);
+    CHECK(generatedWithCulling < generatedWithoutCulling);
+}
@@ -0,0 +1,114 @@
+//----------------------------------------------------------------------------------------------------
+// RenderPipelineTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RenderPipeline.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int FRAME_COUNT = 2000;
+
+    // Publishes FRAME_COUNT frames whose only window sits at x = frame index; returns the frames whose
+    // drawn window geometry was not the drawn batch's own
+    int CountMismatchedWindowGeometry(sRenderPipelineConfig const& config, int& outLaggingFrameCount)
+    {
+        RenderPipeline pipeline(config);
+        int            mismatchedFrameCount = 0;
+        outLaggingFrameCount                = 0;
+
+        for (int frame = 1; frame <= FRAME_COUNT; ++frame)
+        {
+            pipeline.MarkSimulationBegin();
+            sRenderSnapshot& snapshot = pipeline.GetSnapshotToFill();
+            snapshot.m_screenBounds   = AABB2(0.f, 0.f, 1920.f, 1080.f);
+            snapshot.m_windowGeometry.push_back({nullptr, Vec2(static_cast<float>(frame), 0.f), Vec2(200.f, 200.f)});
+
+            sRenderShape shape;
+            shape.m_position   = Vec2(static_cast<float>(frame), 0.f);
+            shape.m_radius     = 10.f;
+            shape.m_cullRadius = 10.f;
+            snapshot.m_shapes.push_back(shape);
+
+            pipeline.MarkSimulationEnd();
+            pipeline.PublishSnapshot();
+
+            pipeline.Submit();
+
+            std::vector<sWindowGeometry> const& drawnGeometry = pipeline.GetDrawnWindowGeometry();
+            if (drawnGeometry.empty()) continue;     // Nothing built yet
+
+            uint64_t const drawnFrameIndex = static_cast<uint64_t>(frame) - pipeline.GetLatencyFrames();
+            mismatchedFrameCount += drawnGeometry.size() == 1 && drawnGeometry[0].m_clientPosition.x == static_cast<float>(drawnFrameIndex) ? 0 : 1;
+            outLaggingFrameCount += pipeline.GetLatencyFrames() > 0 ? 1 : 0;
+        }
+
+        return mismatchedFrameCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(InlineBatchCarriesTheCurrentWindowGeometry)
+{
+    sRenderPipelineConfig config;
+    config.m_isThreaded = false;
+    config.m_isHeadless = true;
+
+    int laggingFrameCount = 0;
+    CHECK_EQUAL(CountMismatchedWindowGeometry(config, laggingFrameCount), 0);
+    CHECK_EQUAL(laggingFrameCount, 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ThreadedBatchCarriesItsOwnFramesWindowGeometry)
+{
+    // However far behind the drawn batch is, its window rects are from the same frame
+    sRenderPipelineConfig config;
+    config.m_isHeadless        = true;
+    config.m_maxFramesInFlight = 2;
+
+    int laggingFrameCount = 0;
+    CHECK_EQUAL(CountMismatchedWindowGeometry(config, laggingFrameCount), 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(PrepCostsAreChargedOncePerBatch)
+{
+    sRenderPipelineConfig config;
+    config.m_isThreaded = false;
+    config.m_isHeadless = true;
+    RenderPipeline pipeline(config);
+
+    // Row 2 twice (one of them culled), row 0 once, and a shape no row is charged for
+    sRenderShape shape;
+    shape.m_radius     = 10.f;
+    shape.m_cullRadius = 10.f;
+
+    sRenderSnapshot& snapshot = pipeline.GetSnapshotToFill();
+    snapshot.m_screenBounds   = AABB2(0.f, 0.f, 1920.f, 1080.f);
+    snapshot.m_visibleWindowRects.push_back(AABB2(0.f, 0.f, 200.f, 200.f));
+    for (int16_t const costRowIndex : {2, 0, -1})
+    {
+        shape.m_position     = Vec2(100.f, 100.f);
+        shape.m_costRowIndex = costRowIndex;
+        snapshot.m_shapes.push_back(shape);
+    }
+    shape.m_position     = Vec2(1000.f, 1000.f);
+    shape.m_costRowIndex = 2;
+    snapshot.m_shapes.push_back(shape);
+    pipeline.PublishSnapshot();
+
+    pipeline.Submit();
+    std::vector<sRenderPrepCost> const& prepCosts = pipeline.GetSubmittedPrepCosts();
+    CHECK_EQUAL(prepCosts.size(), 3u);
+    CHECK_EQUAL(prepCosts[0].m_shapeCount, 1);
+    CHECK_EQUAL(prepCosts[1].m_shapeCount, 0);
+    CHECK_EQUAL(prepCosts[2].m_shapeCount, 2);
+    CHECK(prepCosts[2].m_ticks > 0);
+
+    // Nothing new was published, so the redrawn batch charges nothing
+    pipeline.Submit();
+    CHECK(pipeline.GetSubmittedPrepCosts().empty());
+}
@@ -0,0 +1,344 @@
+//----------------------------------------------------------------------------------------------------
+// SnapshotBenchmark.cpp
+// Capture and restore of a 5000-entity world through SnapshotWriter/SnapshotReader and RewindBuffer,
+// in the layout Game::CaptureSnapshot writes: game scalars, one section per subsystem, then per entity
+// a field-by-field header and a section. CoinField and ProjectileSystem are the real ones; the
+// entities are plain records with the fields Entity::WriteSnapshot and Octagon::WriteSnapshot write,
+// since Entity needs the engine. Restore validates the whole layout first, as RestoreSnapshot does.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Game/Framework/RewindBuffer.hpp"
+#include "Game/Framework/SnapshotStream.hpp"
+#include "Game/Gameplay/CoinField.hpp"
+#include "Game/Gameplay/ProjectileSystem.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int      ENTITY_COUNT     = 5000;
+    constexpr int      PROJECTILE_COUNT = 2000;
+    constexpr int      COIN_STACK_COUNT = 500;
+    constexpr uint32_t SNAPSHOT_MAGIC   = 0x50414E53;
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Entity::WriteSnapshot's fields followed by Octagon's
+    struct sBenchEntity
+    {
+        uint64_t m_entityID             = 0;
+        Vec2     m_position;
+        Vec2     m_velocity;
+        Rgba8    m_color;
+        int      m_health               = 10;
+        int      m_coinToDrop           = 3;
+        float    m_orientationDegrees   = 0.f;
+        float    m_physicRadius         = 30.f;
+        float    m_cosmeticRadius       = 30.f;
+        float    m_thickness            = 6.f;
+        float    m_speed                = 100.f;
+        bool     m_isDead               = false;
+        bool     m_isGarbage            = false;
+        bool     m_isChildWindowVisible = true;
+        bool     m_isEntityVisible      = true;
+        float    m_shootRange           = 400.f;
+        float    m_shootCooldown        = 2.f;
+        float    m_shootTimer           = 0.f;
+        float    m_preferredDist        = 250.f;
+
+        void WriteSnapshot(SnapshotWriter& writer) const
+        {
+            writer.Write(m_position);
+            writer.Write(m_velocity);
+            writer.Write(m_color);
+            writer.Write(m_health);
+            writer.Write(m_coinToDrop);
+            writer.Write(m_orientationDegrees);
+            writer.Write(m_physicRadius);
+            writer.Write(m_cosmeticRadius);
+            writer.Write(m_thickness);
+            writer.Write(m_speed);
+            writer.Write(m_isDead);
+            writer.Write(m_isGarbage);
+            writer.Write(m_isChildWindowVisible);
+            writer.Write(m_isEntityVisible);
+            writer.Write(m_shootRange);
+            writer.Write(m_shootCooldown);
+            writer.Write(m_shootTimer);
+            writer.Write(m_preferredDist);
+        }
+
+        void ReadSnapshot(SnapshotReader& reader)
+        {
+            reader.Read(m_position);
+            reader.Read(m_velocity);
+            reader.Read(m_color);
+            reader.Read(m_health);
+            reader.Read(m_coinToDrop);
+            reader.Read(m_orientationDegrees);
+            reader.Read(m_physicRadius);
+            reader.Read(m_cosmeticRadius);
+            reader.Read(m_thickness);
+            reader.Read(m_speed);
+            reader.Read(m_isDead);
+            reader.Read(m_isGarbage);
+            reader.Read(m_isChildWindowVisible);
+            reader.Read(m_isEntityVisible);
+            reader.Read(m_shootRange);
+            reader.Read(m_shootCooldown);
+            reader.Read(m_shootTimer);
+            reader.Read(m_preferredDist);
+        }
+    };
+
+    struct sBenchWorld
+    {
+        float    m_spawnTimer           = 0.f;
+        CoinField                                  m_coinField  = CoinField(sCoinFieldConfig{});
+        ProjectileSystem                           m_projectiles = ProjectileSystem(sProjectileSystemConfig{});
+        std::vector<std::unique_ptr<sBenchEntity>> m_entities;
+        std::vector<std::unique_ptr<sBenchEntity>> m_previousEntities;     // Reused by Restore
+        std::unordered_map<uint64_t, size_t>       m_restoreLookup;        // ID to index in m_previousEntities
+    };
+
+    template <typename T>
+    void WriteSection(SnapshotWriter& writer, T const& owner)
+    {
+        size_t const section = writer.BeginSection();
+        owner.WriteSnapshot(writer);
+        writer.EndSection(section);
+    }
+
+    void Capture(sBenchWorld const& world, std::vector<uint8_t>& outBuffer)
+    {
+        SnapshotWriter writer(outBuffer);
+        writer.Write(SNAPSHOT_MAGIC);
+        writer.Write(world.m_spawnTimer);
+        WriteSection(writer, world.m_coinField);
+        WriteSection(writer, world.m_projectiles);
+
+        writer.Write(static_cast<uint32_t>(world.m_entities.size()));
+        for (std::unique_ptr<sBenchEntity> const& entity : world.m_entities)
+        {
+            writer.Write(entity->m_entityID);
+            writer.Write(static_cast<uint8_t>(2));     // Kind
+            writer.Write(static_cast<uint8_t>(2));     // Enemy type
+            writer.Write(static_cast<uint8_t>(1));     // Has child window
+            WriteSection(writer, *entity);
+        }
+    }
+
+    bool IsLayoutValid(std::vector<uint8_t> const& buffer)
+    {
+        SnapshotReader reader(buffer.data(), buffer.size());
+
+        uint32_t magic      = 0;
+        float    spawnTimer = 0.f;
+        reader.Read(magic);
+        reader.Read(spawnTimer);
+        if (!reader.IsValid() || magic != SNAPSHOT_MAGIC) return false;
+
+        reader.ReadSection();
+        reader.ReadSection();
+
+        uint32_t entityCount = 0;
+        reader.Read(entityCount);
+
+        for (uint32_t i = 0; i < entityCount && reader.IsValid(); ++i)
+        {
+            uint64_t entityID  = 0;
+            uint8_t  kind      = 0;
+            uint8_t  enemyType = 0;
+            uint8_t  hasWindow = 0;
+            reader.Read(entityID);
+            reader.Read(kind);
+            reader.Read(enemyType);
+            reader.Read(hasWindow);
+            if (kind > 2 || hasWindow > 1) return false;
+            reader.ReadSection();
+        }
+
+        return reader.IsValid() && reader.IsAtEnd();
+    }
+
+    // Same shape as Game::RestoreSnapshot: overwrite in place by ID, respawn what is missing
+    bool Restore(sBenchWorld& world, std::vector<uint8_t> const& buffer)
+    {
+        if (!IsLayoutValid(buffer)) return false;
+
+        SnapshotReader reader(buffer.data(), buffer.size());
+
+        uint32_t magic = 0;
+        reader.Read(magic);
+        reader.Read(world.m_spawnTimer);
+
+        SnapshotReader coinSection = reader.ReadSection();
+        world.m_coinField.ReadSnapshot(coinSection);
+        SnapshotReader projectileSection = reader.ReadSection();
+        world.m_projectiles.ReadSnapshot(projectileSection);
+
+        world.m_restoreLookup.clear();
+        world.m_previousEntities.swap(world.m_entities);
+        world.m_entities.clear();
+        for (size_t i = 0; i < world.m_previousEntities.size(); ++i)
+        {
+            world.m_restoreLookup[world.m_previousEntities[i]->m_entityID] = i;
+        }
+
+        uint32_t entityCount = 0;
+        reader.Read(entityCount);
+
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            uint64_t entityID = 0;
+            uint8_t  header[3] = {};
+            reader.Read(entityID);
+            reader.Read(header[0]);
+            reader.Read(header[1]);
+            reader.Read(header[2]);
+
+            std::unique_ptr<sBenchEntity> entity;
+            auto const                    found = world.m_restoreLookup.find(entityID);
+            if (found != world.m_restoreLookup.end())
+            {
+                entity = std::move(world.m_previousEntities[found->second]);
+            }
+            else
+            {
+                entity             = std::make_unique<sBenchEntity>();
+                entity->m_entityID = entityID;
+            }
+
+            SnapshotReader section = reader.ReadSection();
+            entity->ReadSnapshot(section);
+            world.m_entities.push_back(std::move(entity));
+        }
+
+        world.m_previousEntities.clear();     // Entities born after the capture
+        return true;
+    }
+
+    void BuildWorld(sBenchWorld& world)
+    {
+        for (int i = 0; i < ENTITY_COUNT; ++i)
+        {
+            std::unique_ptr<sBenchEntity> entity = std::make_unique<sBenchEntity>();
+            entity->m_entityID                   = static_cast<uint64_t>(i + 1);
+            entity->m_position                   = Vec2(static_cast<float>(i % 1920), static_cast<float>(i % 1080));
+            entity->m_velocity                   = Vec2(1.f, 0.5f) * static_cast<float>(i % 7);
+            world.m_entities.push_back(std::move(entity));
+        }
+
+        for (int i = 0; i < PROJECTILE_COUNT; ++i)
+        {
+            world.m_projectiles.SpawnProjectile(Vec2(960.f, 540.f), Vec2::MakeFromPolarDegrees(static_cast<float>(i)), 1000.f, 4.f, eProjectileFaction::PLAYER, Rgba8::WHITE);
+        }
+
+        for (int i = 0; i < COIN_STACK_COUNT; ++i)
+        {
+            world.m_coinField.SpawnStack(Vec2(static_cast<float>(i * 37 % 1920), static_cast<float>(i * 53 % 1080)), 1 + i % 9);
+        }
+    }
+
+    // Moves every entity a little, as a frame of gameplay would between captures
+    void StepWorld(sBenchWorld& world, float const deltaSeconds)
+    {
+        world.m_spawnTimer += deltaSeconds;
+        world.m_projectiles.Update(deltaSeconds);
+
+        for (std::unique_ptr<sBenchEntity> const& entity : world.m_entities)
+        {
+            entity->m_position += entity->m_velocity * deltaSeconds;
+            entity->m_shootTimer += deltaSeconds;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(FiveThousandEntityCaptureAndRestore)
+{
+    sBenchWorld world;
+    BuildWorld(world);
+
+    RewindBuffer rewindBuffer(sRewindBufferConfig{});
+    size_t const slotCount = rewindBuffer.GetCapacity();
+
+    // Two laps: the first pays for every slot's allocation and page faults, the second only copies
+    double firstLapSeconds  = 0.0;
+    double secondLapSeconds = 0.0;
+    double worstWarmSeconds = 0.0;
+
+    for (size_t capture = 0; capture < slotCount * 2; ++capture)
+    {
+        StepWorld(world, 1.f / 30.f);
+
+        double const startSeconds = GetNowSeconds();
+        Capture(world, rewindBuffer.BeginCapture());
+        double const elapsed = GetNowSeconds() - startSeconds;
+
+        if (capture < slotCount)
+        {
+            firstLapSeconds += elapsed;
+        }
+        else
+        {
+            secondLapSeconds += elapsed;
+            worstWarmSeconds = (std::max)(worstWarmSeconds, elapsed);
+        }
+    }
+
+    std::vector<uint8_t> newest;
+    Capture(world, newest);
+    float const newestX = world.m_entities.back()->m_position.x;
+
+    // Rewind one capture per frame, as holding R does, through the last second of the ring
+    double validateSeconds = 0.0;
+    double restoreSeconds  = 0.0;
+    int    restoreCount    = 0;
+    bool   didAllRestore   = true;
+
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        std::vector<uint8_t> const* snapshot = rewindBuffer.PopNewest();
+
+        double const validateStart = GetNowSeconds();
+        didAllRestore &= IsLayoutValid(*snapshot);
+        validateSeconds += GetNowSeconds() - validateStart;
+
+        double const restoreStart = GetNowSeconds();
+        didAllRestore &= Restore(world, *snapshot);
+        restoreSeconds += GetNowSeconds() - restoreStart;
+        ++restoreCount;
+    }
+
+    // Back to the newest state: every byte must round-trip
+    CHECK(Restore(world, newest));
+    std::vector<uint8_t> roundTrip;
+    Capture(world, roundTrip);
+
+    // A truncated buffer is rejected before anything changes
+    std::vector<uint8_t> truncated(newest.begin(), newest.end() - 3);
+    float const          timerBefore = world.m_spawnTimer;
+    CHECK(!Restore(world, truncated));
+
+    std::printf("    %d entities, %d projectiles, %d coin stacks, %zu ring slots\n", ENTITY_COUNT, PROJECTILE_COUNT, COIN_STACK_COUNT, slotCount);
+    std::printf("    snapshot: %.1f KB, ring: %.1f MB\n", static_cast<double>(newest.size()) / 1024.0, static_cast<double>(rewindBuffer.GetStoredByteCount()) / (1024.0 * 1024.0));
+    std::printf("    capture: first lap %.3f ms avg, warm %.3f ms avg (worst %.3f ms)\n", firstLapSeconds * 1000.0 / static_cast<double>(slotCount), secondLapSeconds * 1000.0 / static_cast<double>(slotCount), worstWarmSeconds * 1000.0);
+    std::printf("    restore: %.3f ms avg, of which layout validation %.3f ms\n", restoreSeconds * 1000.0 / restoreCount, validateSeconds * 1000.0 / restoreCount);
+
+    CHECK(didAllRestore);
+    CHECK(roundTrip == newest);
+    CHECK_EQUAL(world.m_entities.back()->m_position.x, newestX);
+    CHECK_EQUAL(world.m_spawnTimer, timerBefore);
+}
@@ -0,0 +1,115 @@
+//----------------------------------------------------------------------------------------------------
+// SnapshotStreamTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+
+#include "Game/Framework/RewindBuffer.hpp"
+#include "Game/Framework/SnapshotStream.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // magic, a section holding a float vector, then a trailing value
+    std::vector<uint8_t> WriteSampleSnapshot()
+    {
+        std::vector<uint8_t> buffer;
+        {
+            SnapshotWriter writer(buffer);
+            writer.Write(static_cast<uint32_t>(0x50414E53));
+
+            size_t const section = writer.BeginSection();
+            writer.WriteVector(std::vector<float>{1.5f, -2.25f, 3.f});
+            writer.EndSection(section);
+
+            writer.Write(static_cast<int>(42));
+        }
+        return buffer;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SectionsRoundTripAndStepPastTheirBytes)
+{
+    std::vector<uint8_t> const buffer = WriteSampleSnapshot();
+    SnapshotReader             reader(buffer.data(), buffer.size());
+
+    uint32_t magic = 0;
+    reader.Read(magic);
+
+    SnapshotReader     section = reader.ReadSection();
+    std::vector<float> values;
+    section.ReadVector(values);
+
+    int trailing = 0;
+    reader.Read(trailing);
+
+    CHECK_EQUAL(magic, 0x50414E53u);
+    CHECK_EQUAL(values.size(), 3u);
+    CHECK_EQUAL(values[1], -2.25f);
+    CHECK(section.IsValid() && section.IsAtEnd());
+    CHECK_EQUAL(trailing, 42);
+    CHECK(reader.IsValid() && reader.IsAtEnd());
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(TruncatedSectionInvalidatesBothReaders)
+{
+    std::vector<uint8_t> buffer = WriteSampleSnapshot();
+    buffer.resize(buffer.size() - sizeof(int) - 2);     // Cuts into the section
+    SnapshotReader reader(buffer.data(), buffer.size());
+
+    uint32_t magic = 0;
+    reader.Read(magic);
+    SnapshotReader section = reader.ReadSection();
+
+    CHECK(!section.IsValid());
+    CHECK(!reader.IsValid());
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(VectorCountPastTheSectionEndIsRejected)
+{
+    // The buffer has bytes to spare after the section, but the section itself is too short for the count
+    std::vector<uint8_t> buffer;
+    {
+        SnapshotWriter writer(buffer);
+        size_t const   section = writer.BeginSection();
+        writer.Write(static_cast<uint32_t>(4));
+        writer.Write(1.f);
+        writer.EndSection(section);
+        writer.WriteVector(std::vector<float>(16, 0.f));
+    }
+
+    SnapshotReader     reader(buffer.data(), buffer.size());
+    SnapshotReader     section = reader.ReadSection();
+    std::vector<float> values;
+    section.ReadVector(values);
+
+    CHECK(!section.IsValid());
+    CHECK(values.empty());
+    CHECK(reader.IsValid());
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(RewindBufferPopsNewestFirstAfterWrapping)
+{
+    sRewindBufferConfig config;
+    config.m_secondsToKeep   = 3.f;
+    config.m_captureInterval = 1.f;
+    RewindBuffer rewindBuffer(config);
+
+    for (uint8_t capture = 0; capture < 5; ++capture)
+    {
+        rewindBuffer.BeginCapture().assign(1, capture);
+    }
+
+    CHECK_EQUAL(rewindBuffer.GetSnapshotCount(), 3u);
+    CHECK_EQUAL((*rewindBuffer.PopNewest())[0], 4);
+    CHECK_EQUAL((*rewindBuffer.PopNewest())[0], 3);
+    CHECK_EQUAL((*rewindBuffer.PopNewest())[0], 2);
+    CHECK(rewindBuffer.PopNewest() == nullptr);
+}
@@ -0,0 +1,280 @@
+//----------------------------------------------------------------------------------------------------
+// AISchedulerBenchmark.cpp
+// 10k enemies run by the real EnemyUtils behaviours under AIScheduler for ten seconds at 60 Hz, each
+// LOD setting against the same world thinking at full rate. Chasers, orbiters, zigzaggers and ranged
+// enemies are evenly mixed; the player orbits the screen centre and seven child windows are visible,
+// one of them around the player.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/Gameplay/AIScheduler.hpp"
+#include "Game/Gameplay/EnemyUtils.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int   ENEMY_COUNT        = 10000;
+    constexpr int   FRAME_COUNT        = 600;
+    constexpr int   WARMUP_FRAME_COUNT = 60;
+    constexpr float FRAME_SECONDS      = 1.f / 60.f;
+    constexpr float ENEMY_RADIUS       = 30.f;
+
+    AABB2 const SCREEN_BOUNDS = AABB2(0.f, 0.f, 1920.f, 1080.f);
+
+    enum class eBehavior : uint8_t
+    {
+        CHASE,      // Triangle / Square / Hexagon
+        ORBIT,      // Circle
+        ZIGZAG,     // Pentagon
+        RANGED,     // Octagon
+    };
+
+    struct sEnemy
+    {
+        eBehavior        m_behavior           = eBehavior::CHASE;
+        uint32_t         m_entityID           = 0;
+        Vec2             m_position;
+        float            m_orientationDegrees = 0.f;
+        float            m_speed              = 0.f;
+        float            m_orbitAngle         = 0.f;
+        float            m_orbitRadius        = 0.f;
+        float            m_orbitSpeed         = 0.f;
+        float            m_zigzagPhase        = 0.f;
+        float            m_zigzagAmplitude    = 0.f;
+        float            m_shootCooldown      = 0.f;
+        float            m_shootTimer         = 0.f;
+        int              m_shotCount          = 0;
+        sAIScheduleState m_aiSchedule;
+    };
+
+    struct sLodRun
+    {
+        double m_millisecondsPerFrame  = 0.0;
+        double m_thinksPerFrame        = 0.0;
+        double m_deferralsPerFrame     = 0.0;
+        double m_meanDivergence        = 0.0;     // Pixels from the full-rate twin, averaged over every frame
+        float  m_finalP50Divergence    = 0.f;
+        float  m_finalP99Divergence    = 0.f;
+        float  m_worstDivergence       = 0.f;
+        int    m_shotCount             = 0;
+    };
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    Vec2 GetPlayerPosition(int const frame)
+    {
+        return Vec2(960.f, 540.f) + Vec2::MakeFromPolarDegrees(static_cast<float>(frame) * FRAME_SECONDS * 30.f, 300.f);
+    }
+
+    // The UpdateAI bodies of the enemy classes, without the entity around them
+    void Think(sEnemy& enemy, Vec2 const& playerPosition, float const deltaSeconds)
+    {
+        switch (enemy.m_behavior)
+        {
+        case eBehavior::CHASE:
+            EnemyUtils::ChasePlayer(enemy.m_position, enemy.m_orientationDegrees, playerPosition, enemy.m_speed, deltaSeconds);
+            break;
+
+        case eBehavior::ORBIT:
+            EnemyUtils::OrbitPlayer(enemy.m_position, enemy.m_orientationDegrees, playerPosition, enemy.m_orbitRadius, enemy.m_orbitSpeed, enemy.m_orbitAngle, deltaSeconds);
+            break;
+
+        case eBehavior::ZIGZAG:
+            EnemyUtils::ZigZagToward(enemy.m_position, enemy.m_orientationDegrees, playerPosition, enemy.m_speed, enemy.m_zigzagAmplitude, enemy.m_zigzagPhase, deltaSeconds);
+            break;
+
+        case eBehavior::RANGED:
+        {
+            float const distanceToPlayer  = GetDistance2D(enemy.m_position, playerPosition);
+            Vec2 const  directionToPlayer = EnemyUtils::GetDirectionToPlayer(enemy.m_position, playerPosition);
+
+            if (distanceToPlayer < 200.f * 0.8f) enemy.m_position -= directionToPlayer * enemy.m_speed * deltaSeconds;
+            else if (distanceToPlayer > 300.f) enemy.m_position += directionToPlayer * enemy.m_speed * deltaSeconds;
+
+            if (directionToPlayer != Vec2::ZERO)
+            {
+                enemy.m_orientationDegrees = GetTurnedTowardDegrees(enemy.m_orientationDegrees, directionToPlayer.GetOrientationDegrees(), 180.f * deltaSeconds);
+            }
+
+            if (EnemyUtils::ShouldShootAtPlayer(enemy.m_position, playerPosition, 300.f, enemy.m_shootCooldown, enemy.m_shootTimer, deltaSeconds)) ++enemy.m_shotCount;
+            break;
+        }
+        }
+    }
+
+    std::vector<sEnemy> SpawnEnemies()
+    {
+        RandomNumberGenerator rng;
+        std::vector<sEnemy>   enemies(ENEMY_COUNT);
+
+        for (int i = 0; i < ENEMY_COUNT; ++i)
+        {
+            sEnemy& enemy           = enemies[i];
+            enemy.m_behavior        = static_cast<eBehavior>(i % 4);
+            enemy.m_entityID        = static_cast<uint32_t>(i + 1);
+            enemy.m_position        = Vec2(rng.RollRandomFloatInRange(0.f, 1920.f), rng.RollRandomFloatInRange(0.f, 1080.f));
+            enemy.m_speed           = enemy.m_behavior == eBehavior::ZIGZAG ? 200.f : (enemy.m_behavior == eBehavior::CHASE ? 100.f : 80.f);
+            enemy.m_orbitAngle      = rng.RollRandomFloatInRange(0.f, 360.f);
+            enemy.m_orbitRadius     = rng.RollRandomFloatInRange(150.f, 250.f);
+            enemy.m_orbitSpeed      = rng.RollRandomFloatInRange(70.f, 110.f);
+            enemy.m_zigzagPhase     = rng.RollRandomFloatInRange(0.f, 360.f);
+            enemy.m_zigzagAmplitude = rng.RollRandomFloatInRange(40.f, 60.f);
+            enemy.m_shootCooldown   = rng.RollRandomFloatInRange(1.2f, 1.8f);
+        }
+
+        return enemies;
+    }
+
+    // One frame of Entity::UpdateScheduledAI over every enemy; returns the milliseconds it took
+    double UpdateEnemies(AIScheduler& scheduler, std::vector<sEnemy>& enemies, Vec2 const& playerPosition, std::vector<AABB2> const& visibleWindowRects)
+    {
+        double const startSeconds = GetNowSeconds();
+        scheduler.BeginFrame(playerPosition, SCREEN_BOUNDS, visibleWindowRects);
+
+        for (sEnemy& enemy : enemies)
+        {
+            float thinkSeconds = 0.f;
+            if (!scheduler.BeginUpdate(enemy.m_aiSchedule, enemy.m_position, ENEMY_RADIUS, enemy.m_entityID, FRAME_SECONDS, thinkSeconds)) continue;
+
+            Vec2 const positionBefore = enemy.m_position;
+            Think(enemy, playerPosition, thinkSeconds);
+            scheduler.EndThink(enemy.m_aiSchedule, positionBefore, enemy.m_position, thinkSeconds);
+        }
+
+        return (GetNowSeconds() - startSeconds) * 1000.0;
+    }
+
+    // Runs the LOD world and its full-rate twin side by side; outFullRateMilliseconds is the twin's cost
+    sLodRun RunAgainstFullRate(sAISchedulerConfig const& lodConfig, double& outFullRateMilliseconds, int& outFullRateShotCount)
+    {
+        sAISchedulerConfig fullRateConfig;
+        fullRateConfig.m_isEnabled = false;
+
+        AIScheduler         fullRateScheduler(fullRateConfig);
+        AIScheduler         lodScheduler(lodConfig);
+        std::vector<sEnemy> fullRateEnemies = SpawnEnemies();
+        std::vector<sEnemy> lodEnemies      = SpawnEnemies();
+
+        RandomNumberGenerator windowRng(777u);
+        std::vector<AABB2>    fixedWindowRects;
+        for (int i = 0; i < 6; ++i)
+        {
+            Vec2 const center = Vec2(windowRng.RollRandomFloatInRange(200.f, 1720.f), windowRng.RollRandomFloatInRange(200.f, 880.f));
+            fixedWindowRects.emplace_back(center - Vec2(150.f, 150.f), center + Vec2(150.f, 150.f));
+        }
+
+        sLodRun            run;
+        std::vector<AABB2> visibleWindowRects;
+        std::vector<float> divergences(ENEMY_COUNT);
+        double             fullRateMilliseconds = 0.0;
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            Vec2 const playerPosition = GetPlayerPosition(frame);
+            visibleWindowRects        = fixedWindowRects;
+            visibleWindowRects.emplace_back(playerPosition - Vec2(100.f, 100.f), playerPosition + Vec2(100.f, 100.f));
+
+            double const fullRateFrameMilliseconds = UpdateEnemies(fullRateScheduler, fullRateEnemies, playerPosition, visibleWindowRects);
+            double const lodFrameMilliseconds      = UpdateEnemies(lodScheduler, lodEnemies, playerPosition, visibleWindowRects);
+
+            if (frame >= WARMUP_FRAME_COUNT)
+            {
+                fullRateMilliseconds += fullRateFrameMilliseconds;
+                run.m_millisecondsPerFrame += lodFrameMilliseconds;
+            }
+
+            run.m_thinksPerFrame += lodScheduler.GetThinkCount();
+            run.m_deferralsPerFrame += lodScheduler.GetDeferredCount();
+
+            double divergenceSum = 0.0;
+            for (int i = 0; i < ENEMY_COUNT; ++i)
+            {
+                divergences[i] = GetDistance2D(fullRateEnemies[i].m_position, lodEnemies[i].m_position);
+                divergenceSum += divergences[i];
+                run.m_worstDivergence = (std::max)(run.m_worstDivergence, divergences[i]);
+            }
+            run.m_meanDivergence += divergenceSum / ENEMY_COUNT;
+        }
+
+        std::sort(divergences.begin(), divergences.end());
+
+        outFullRateShotCount = 0;
+        for (int i = 0; i < ENEMY_COUNT; ++i)
+        {
+            outFullRateShotCount += fullRateEnemies[i].m_shotCount;
+            run.m_shotCount += lodEnemies[i].m_shotCount;
+        }
+
+        constexpr int TIMED_FRAME_COUNT = FRAME_COUNT - WARMUP_FRAME_COUNT;
+        outFullRateMilliseconds  = fullRateMilliseconds / TIMED_FRAME_COUNT;
+        run.m_millisecondsPerFrame /= TIMED_FRAME_COUNT;
+        run.m_thinksPerFrame /= FRAME_COUNT;
+        run.m_deferralsPerFrame /= FRAME_COUNT;
+        run.m_meanDivergence /= FRAME_COUNT;
+        run.m_finalP50Divergence = divergences[ENEMY_COUNT / 2];
+        run.m_finalP99Divergence = divergences[ENEMY_COUNT * 99 / 100];
+        return run;
+    }
+
+    sLodRun RunAndPrint(char const* label, sAISchedulerConfig const& lodConfig, int& outFullRateShotCount)
+    {
+        double        fullRateMilliseconds = 0.0;
+        sLodRun const run                  = RunAgainstFullRate(lodConfig, fullRateMilliseconds, outFullRateShotCount);
+
+        std::printf("    %s\n", label);
+        std::printf("      full rate %.3f ms/frame, LOD %.3f ms/frame, %.0f thinks/frame, %.1f deferrals/frame\n",
+                    fullRateMilliseconds, run.m_millisecondsPerFrame, run.m_thinksPerFrame, run.m_deferralsPerFrame);
+        std::printf("      divergence: mean %.2f px, final p50 %.2f / p99 %.2f px, worst %.1f px\n",
+                    run.m_meanDivergence, run.m_finalP50Divergence, run.m_finalP99Divergence, run.m_worstDivergence);
+        std::printf("      ranged shots: %d full rate, %d LOD\n", outFullRateShotCount, run.m_shotCount);
+        return run;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(DefaultLodAgainstFullRate)
+{
+    int           fullRateShotCount = 0;
+    sLodRun const run               = RunAndPrint("LOD 350 / 800 px, 2 ms budget", sAISchedulerConfig{}, fullRateShotCount);
+
+    CHECK(run.m_thinksPerFrame < ENEMY_COUNT);
+    CHECK(run.m_finalP99Divergence < 20.f);
+    CHECK(std::abs(run.m_shotCount - fullRateShotCount) * 50 < fullRateShotCount);     // Within 2%
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(TighterLodRadiiAgainstFullRate)
+{
+    sAISchedulerConfig config;
+    config.m_fullRateRadius = 250.f;
+    config.m_halfRateRadius = 600.f;
+
+    int           fullRateShotCount = 0;
+    sLodRun const run               = RunAndPrint("LOD 250 / 600 px, 2 ms budget", config, fullRateShotCount);
+
+    CHECK(run.m_finalP99Divergence < 50.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(TightBudgetDefersWithoutAddingDivergence)
+{
+    sAISchedulerConfig config;
+    config.m_budgetMilliseconds = 0.5f;
+
+    int           fullRateShotCount = 0;
+    sLodRun const run               = RunAndPrint("LOD 350 / 800 px, 0.5 ms budget", config, fullRateShotCount);
+
+    CHECK(run.m_finalP99Divergence < 20.f);
+}
@@ -0,0 +1,208 @@
+//----------------------------------------------------------------------------------------------------
+// CoinFieldBenchmark.cpp
+// Wave 15 coin drops, handled the old way (one Coin entity per coin in the O(n^2) collision loop) and
+// by CoinField. The old path is modelled as the pair loop alone over plain discs, without the
+// dynamic_casts and virtual calls it also paid, so its timings are a lower bound.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Game/Gameplay/CoinField.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int   WAVE_NUMBER          = 15;
+    constexpr float FRAME_SECONDS        = 1.f / 60.f;
+    constexpr int   WAVE_FRAME_COUNT     = 60 * 60;     // Every enemy of the wave dies within a minute
+    constexpr int   LIVE_ENEMY_COUNT     = 100;         // Enemies on screen while the wave runs
+    constexpr int   PAIR_LOOP_SAMPLE     = 60;          // The old pair loop is timed once per second
+    constexpr float SCREEN_WIDTH         = 1920.f;
+    constexpr float SCREEN_HEIGHT        = 1080.f;
+    constexpr float PLAYER_RADIUS        = 30.f;        // Player::m_physicRadius
+    constexpr float PLAYER_ORBIT_RADIUS  = 300.f;
+    constexpr float PLAYER_ORBIT_SPEED   = 300.f;
+
+    struct sDisc
+    {
+        float m_x      = 0.f;
+        float m_y      = 0.f;
+        float m_radius = 0.f;
+    };
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Deterministic LCG so both paths see the same kills
+    struct sWaveRandom
+    {
+        uint32_t m_state = 15u;
+
+        int RollInt(int const minValue, int const maxValue)
+        {
+            m_state = m_state * 1664525u + 1013904223u;
+            return minValue + static_cast<int>((m_state >> 8) % static_cast<uint32_t>(maxValue - minValue + 1));
+        }
+
+        float RollFloat(float const minValue, float const maxValue)
+        {
+            m_state = m_state * 1664525u + 1013904223u;
+            return minValue + (maxValue - minValue) * static_cast<float>(m_state >> 8) / static_cast<float>(1u << 24);
+        }
+    };
+
+    // WaveManager::CalculateEnemiesForWave with its default configuration
+    int GetEnemyCountForWave(int const waveNumber)
+    {
+        return static_cast<int>(5.f * powf(1.5f, static_cast<float>(waveNumber - 1)));
+    }
+
+    // Coins one enemy drops at this wave: the enemy constructors' health rolls and m_coinToDrop rules,
+    // picked with the wave 4+ spawn table weights
+    int RollCoinDrop(sWaveRandom& random, int const waveNumber)
+    {
+        int const roll = random.RollInt(0, 109);
+
+        if (roll < 30) return random.RollInt(3, 5) + waveNumber / 3;                   // Triangle
+        if (roll < 55) return random.RollInt(2, 4) + waveNumber / 4;                   // Circle
+        if (roll < 75) return random.RollInt(3, 5) + waveNumber / 3;                   // Octagon
+        if (roll < 85) return (random.RollInt(10, 15) + (waveNumber / 3) * 2) / 2;     // Square
+        if (roll < 100) return random.RollInt(2, 3) + waveNumber / 4;                  // Pentagon
+        return random.RollInt(4, 6) + waveNumber / 3;                                  // Hexagon
+    }
+
+    // The pair loop Game::HandleEntityCollision ran over every live entity, coins included
+    int CountOverlappingPairs(std::vector<sDisc> const& discs)
+    {
+        int overlapCount = 0;
+
+        for (size_t i = 0; i < discs.size(); ++i)
+        {
+            for (size_t j = i + 1; j < discs.size(); ++j)
+            {
+                float const dx          = discs[i].m_x - discs[j].m_x;
+                float const dy          = discs[i].m_y - discs[j].m_y;
+                float const touchRadius = discs[i].m_radius + discs[j].m_radius;
+                overlapCount += (dx * dx + dy * dy < touchRadius * touchRadius) ? 1 : 0;
+            }
+        }
+
+        return overlapCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(Wave15CoinsOldEntitiesVersusCoinField)
+{
+    int const   enemyCount     = GetEnemyCountForWave(WAVE_NUMBER);
+    float const killsPerFrame  = static_cast<float>(enemyCount) / static_cast<float>(WAVE_FRAME_COUNT);
+    sWaveRandom random;
+
+    std::vector<sDisc> liveEnemies;
+    for (int i = 0; i < LIVE_ENEMY_COUNT; ++i)
+    {
+        liveEnemies.push_back({random.RollFloat(0.f, SCREEN_WIDTH), random.RollFloat(0.f, SCREEN_HEIGHT), 30.f});
+    }
+
+    std::vector<sDisc> oldCoins;
+    CoinField          coinField(sCoinFieldConfig{});
+
+    int    droppedValue       = 0;
+    int    oldCollectedValue  = 0;
+    int    newCollectedValue  = 0;
+    size_t oldPeakEntityCount = 0;
+    int    newPeakStackCount  = 0;
+    double oldPairSeconds     = 0.0;
+    double oldWorstSeconds    = 0.0;
+    int    oldSampleCount     = 0;
+    long   oldOverlapCount    = 0;
+    double newSeconds         = 0.0;
+    double newWorstSeconds    = 0.0;
+    float  killCarry          = 0.f;
+
+    for (int frame = 0; frame < WAVE_FRAME_COUNT; ++frame)
+    {
+        float const orbitDegrees = PLAYER_ORBIT_SPEED / PLAYER_ORBIT_RADIUS * static_cast<float>(frame) * FRAME_SECONDS * 57.2957795f;
+        Vec2 const  player       = Vec2(SCREEN_WIDTH * 0.5f, SCREEN_HEIGHT * 0.5f) + Vec2::MakeFromPolarDegrees(orbitDegrees, PLAYER_ORBIT_RADIUS);
+
+        // Kills: the old path scattered coinCount Coin entities on a 10 px ring, CoinField takes one stack
+        for (killCarry += killsPerFrame; killCarry >= 1.f; killCarry -= 1.f)
+        {
+            Vec2 const deathPosition = Vec2(random.RollFloat(0.f, SCREEN_WIDTH), random.RollFloat(0.f, SCREEN_HEIGHT));
+            int const  coinCount     = RollCoinDrop(random, WAVE_NUMBER);
+
+            for (int i = 0; i < coinCount; ++i)
+            {
+                Vec2 const offset = Vec2::MakeFromPolarDegrees(360.f / static_cast<float>(coinCount) * static_cast<float>(i), 10.f * static_cast<float>(i > 0));
+                oldCoins.push_back({deathPosition.x + offset.x, deathPosition.y + offset.y, random.RollFloat(2.f, 10.f)});
+            }
+
+            coinField.SpawnStack(deathPosition, coinCount);
+            droppedValue += coinCount;
+        }
+
+        // Old path: the full pair loop is sampled; pickup itself is the player-vs-coin subset of it
+        if (frame % PAIR_LOOP_SAMPLE == 0)
+        {
+            std::vector<sDisc> entities = liveEnemies;
+            entities.push_back({player.x, player.y, PLAYER_RADIUS});
+            entities.insert(entities.end(), oldCoins.begin(), oldCoins.end());
+
+            double const startSeconds = GetNowSeconds();
+            int const    overlapCount = CountOverlappingPairs(entities);
+            double const elapsed      = GetNowSeconds() - startSeconds;
+
+            oldPairSeconds += elapsed;
+            oldWorstSeconds = (std::max)(oldWorstSeconds, elapsed);
+            ++oldSampleCount;
+            oldOverlapCount += overlapCount;
+        }
+
+        for (size_t i = 0; i < oldCoins.size();)
+        {
+            float const dx          = oldCoins[i].m_x - player.x;
+            float const dy          = oldCoins[i].m_y - player.y;
+            float const touchRadius = oldCoins[i].m_radius + PLAYER_RADIUS;
+
+            if (dx * dx + dy * dy < touchRadius * touchRadius)
+            {
+                ++oldCollectedValue;
+                oldCoins[i] = oldCoins.back();
+                oldCoins.pop_back();
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        oldPeakEntityCount = (std::max)(oldPeakEntityCount, oldCoins.size() + liveEnemies.size() + 1);
+
+        // New path: the whole CoinField update every frame
+        double const startSeconds = GetNowSeconds();
+        newCollectedValue += coinField.Update(FRAME_SECONDS, player, PLAYER_RADIUS);
+        double const elapsed = GetNowSeconds() - startSeconds;
+
+        newSeconds += elapsed;
+        newWorstSeconds   = (std::max)(newWorstSeconds, elapsed);
+        newPeakStackCount = (std::max)(newPeakStackCount, coinField.GetStackCount());
+    }
+
+    std::printf("    wave %d: %d enemies, %d coins dropped over %d frames\n", WAVE_NUMBER, enemyCount, droppedValue, WAVE_FRAME_COUNT);
+    std::printf("    old Coin entities: peak entity list %zu, %zu coins left, %d collected, pair loop avg %.3f ms worst %.3f ms (%ld overlaps)\n",
+                oldPeakEntityCount, oldCoins.size(), oldCollectedValue, oldPairSeconds * 1000.0 / oldSampleCount, oldWorstSeconds * 1000.0, oldOverlapCount);
+    std::printf("    CoinField:         peak %d stacks, %d stacks left, %d collected, update avg %.4f ms worst %.4f ms\n",
+                newPeakStackCount, coinField.GetStackCount(), newCollectedValue, newSeconds * 1000.0 / WAVE_FRAME_COUNT, newWorstSeconds * 1000.0);
+
+    // Merging and pickup never lose or invent coins
+    CHECK_EQUAL(newCollectedValue + coinField.GetTotalValue(), droppedValue);
+    CHECK(newPeakStackCount < static_cast<int>(oldPeakEntityCount));
+}
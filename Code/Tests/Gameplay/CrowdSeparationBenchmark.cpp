@@ -0,0 +1,193 @@
+//----------------------------------------------------------------------------------------------------
+// CrowdSeparationBenchmark.cpp
+// CrowdSeparation::Solve cost per agent from 1k to 20k agents of 25 px, spread over the screen and
+// clumped within 150 px of one point, 100 solves per size. Also the SSE2 reduction against a scalar
+// O(n^2) reference, and the overlap left by 2000 chasers converging on one point for 10 s.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/Gameplay/CrowdSeparation.hpp"
+#include "Game/Gameplay/EnemyUtils.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int   SOLVE_COUNT   = 100;
+    constexpr float FRAME_SECONDS = 1.f / 60.f;
+    constexpr float AGENT_RADIUS  = 25.f;
+
+    AABB2 const SCREEN_BOUNDS = AABB2(0.f, 0.f, 1920.f, 1080.f);
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Returns nanoseconds per agent
+    double MeasureSolve(int const agentCount, bool const isClumped)
+    {
+        RandomNumberGenerator rng;
+        std::vector<Vec2>     positions(agentCount);
+        for (Vec2& position : positions)
+        {
+            position = isClumped
+                ? Vec2(960.f, 540.f) + Vec2::MakeFromPolarDegrees(rng.RollRandomFloatInRange(0.f, 360.f), rng.RollRandomFloatInRange(0.f, 150.f))
+                : Vec2(rng.RollRandomFloatInRange(0.f, 1920.f), rng.RollRandomFloatInRange(0.f, 1080.f));
+        }
+
+        CrowdSeparation separation(sCrowdSeparationConfig{});
+        double          solveSeconds = 0.0;
+
+        for (int solve = 0; solve < SOLVE_COUNT; ++solve)
+        {
+            separation.Clear();
+            for (Vec2 const& position : positions) separation.AddAgent(position, AGENT_RADIUS);
+
+            double const startSeconds = GetNowSeconds();
+            separation.Solve(SCREEN_BOUNDS, FRAME_SECONDS);
+            solveSeconds += GetNowSeconds() - startSeconds;
+        }
+
+        double const millisecondsPerSolve = solveSeconds * 1000.0 / SOLVE_COUNT;
+        double const nanosecondsPerAgent  = millisecondsPerSolve * 1000000.0 / agentCount;
+        std::printf("    %6d agents: %.3f ms/solve, %.0f ns/agent, %d neighbours, %d capped\n",
+                    agentCount, millisecondsPerSolve, nanosecondsPerAgent, separation.GetNeighborCount(), separation.GetCappedAgentCount());
+        return nanosecondsPerAgent;
+    }
+
+    void RunLinearity(bool const isClumped)
+    {
+        double smallestNanoseconds = 0.0;
+        double largestNanoseconds  = 0.0;
+
+        for (int const agentCount : {1000, 2500, 5000, 10000, 20000})
+        {
+            double const nanosecondsPerAgent = MeasureSolve(agentCount, isClumped);
+            if (agentCount == 1000) smallestNanoseconds = nanosecondsPerAgent;
+            if (agentCount == 20000) largestNanoseconds = nanosecondsPerAgent;
+        }
+
+        // Linear: 20x the agents must not cost much more per agent than 1k. Loose, timings are noisy
+        CHECK(largestNanoseconds < smallestNanoseconds * 2.0);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SolveMatchesScalarReference)
+{
+    constexpr int AGENT_COUNT = 2000;
+
+    sCrowdSeparationConfig config;
+    config.m_maxNeighbors = 1024;     // Never reached, so every overlap is counted
+    CrowdSeparation separation(config);
+
+    RandomNumberGenerator rng;
+    std::vector<Vec2>     positions;
+    std::vector<float>    radii;
+    for (int i = 0; i < AGENT_COUNT; ++i)
+    {
+        positions.emplace_back(rng.RollRandomFloatInRange(0.f, 800.f), rng.RollRandomFloatInRange(0.f, 600.f));
+        radii.push_back(rng.RollRandomFloatInRange(15.f, 30.f));
+        separation.AddAgent(positions.back(), radii.back());
+    }
+    separation.Solve(SCREEN_BOUNDS, FRAME_SECONDS);
+
+    float const blend    = 0.5f * (std::min)(1.f, config.m_resolveRate * FRAME_SECONDS);
+    float       maxError = 0.f;
+
+    for (int i = 0; i < AGENT_COUNT; ++i)
+    {
+        Vec2 push;
+        for (int j = 0; j < AGENT_COUNT; ++j)
+        {
+            if (i == j) continue;
+
+            Vec2 const  offset          = positions[i] - positions[j];
+            float const reach           = radii[i] + radii[j] + config.m_padding;
+            float const distanceSquared = offset.GetLengthSquared();
+            if (distanceSquared >= reach * reach) continue;
+
+            float const distance = std::sqrt((std::max)(distanceSquared, 1e-6f));
+            push += offset * ((reach - distance) / distance);
+        }
+
+        maxError = (std::max)(maxError, GetDistance2D(push * blend, separation.GetDisplacement(i)));
+    }
+
+    std::printf("    %d agents: max displacement error against the scalar reference %.6f px\n", AGENT_COUNT, maxError);
+
+    CHECK_EQUAL(separation.GetCappedAgentCount(), 0);
+    CHECK(maxError < 1e-3f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SolveCostUniform)
+{
+    RunLinearity(false);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SolveCostClumped)
+{
+    RunLinearity(true);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ConvergingChasersOverlapLess)
+{
+    constexpr int CHASER_COUNT = 2000;
+    constexpr int FRAME_COUNT  = 600;
+
+    Vec2 const playerPosition = Vec2(960.f, 540.f);
+    long       overlappingPairCounts[2] = {};
+
+    for (int isSeparating = 0; isSeparating < 2; ++isSeparating)
+    {
+        RandomNumberGenerator rng;
+        std::vector<Vec2>     positions(CHASER_COUNT);
+        std::vector<float>    orientations(CHASER_COUNT, 0.f);
+        for (Vec2& position : positions) position = Vec2(rng.RollRandomFloatInRange(0.f, 1920.f), rng.RollRandomFloatInRange(0.f, 1080.f));
+
+        CrowdSeparation separation(sCrowdSeparationConfig{});
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            for (int i = 0; i < CHASER_COUNT; ++i) EnemyUtils::ChasePlayer(positions[i], orientations[i], playerPosition, 100.f, FRAME_SECONDS);
+
+            if (isSeparating == 0) continue;
+
+            separation.Clear();
+            for (Vec2 const& position : positions) separation.AddAgent(position, AGENT_RADIUS);
+            separation.Solve(SCREEN_BOUNDS, FRAME_SECONDS);
+            for (int i = 0; i < CHASER_COUNT; ++i) positions[i] += separation.GetDisplacement(i);
+        }
+
+        long   overlappingPairCount = 0;
+        double overlapDepth         = 0.0;
+        for (int i = 0; i < CHASER_COUNT; ++i)
+        {
+            for (int j = i + 1; j < CHASER_COUNT; ++j)
+            {
+                float const distance = GetDistance2D(positions[i], positions[j]);
+                if (distance >= AGENT_RADIUS * 2.f) continue;
+
+                ++overlappingPairCount;
+                overlapDepth += AGENT_RADIUS * 2.f - distance;
+            }
+        }
+
+        overlappingPairCounts[isSeparating] = overlappingPairCount;
+        std::printf("    %d chasers after 10 s %s separation: %ld overlapping pairs, mean depth %.1f px\n",
+                    CHASER_COUNT, isSeparating ? "with" : "without", overlappingPairCount, overlappingPairCount > 0 ? overlapDepth / overlappingPairCount : 0.0);
+    }
+
+    CHECK(overlappingPairCounts[1] * 10 < overlappingPairCounts[0]);
+}
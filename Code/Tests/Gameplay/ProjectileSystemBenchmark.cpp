@@ -0,0 +1,229 @@
+//----------------------------------------------------------------------------------------------------
+// ProjectileSystemBenchmark.cpp
+// 50k live projectiles (80% player, 20% enemy) against 200 enemy discs and the player, 120 frames:
+// SSE2 integration, the grid-backed CollideWithTargets, CollectEdgeHits against the screen and the
+// render shape batch, timed separately, with the dead refilled every frame. Against it, the old
+// Bullet entity modelled as a heap object per bullet with a virtual Update and the brute-force
+// bullet-vs-target loop, without its String name and window lookups, so a lower bound.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Game/Framework/RenderSnapshot.hpp"
+#include "Game/Gameplay/ProjectileSystem.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int   PROJECTILE_COUNT = 50000;
+    constexpr int   TARGET_COUNT     = 200;
+    constexpr int   FRAME_COUNT      = 120;
+    constexpr float FRAME_SECONDS    = 1.f / 60.f;
+
+    AABB2 const SCREEN_BOUNDS = AABB2(0.f, 0.f, 1920.f, 1080.f);
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Deterministic LCG so both paths see the same shots
+    struct sShotRandom
+    {
+        uint32_t m_state = 36u;
+
+        float RollFloat(float const minValue, float const maxValue)
+        {
+            m_state = m_state * 1664525u + 1013904223u;
+            return minValue + (maxValue - minValue) * static_cast<float>(m_state >> 8) / static_cast<float>(1u << 24);
+        }
+    };
+
+    struct sShot
+    {
+        Vec2               m_position;
+        Vec2               m_direction;
+        float              m_speed   = 0.f;
+        eProjectileFaction m_faction = eProjectileFaction::PLAYER;
+    };
+
+    sShot RollShot(sShotRandom& random, int const shotIndex)
+    {
+        sShot shot;
+        shot.m_position  = Vec2(random.RollFloat(100.f, 1820.f), random.RollFloat(100.f, 980.f));
+        shot.m_direction = Vec2::MakeFromPolarDegrees(random.RollFloat(0.f, 360.f));
+        shot.m_speed     = random.RollFloat(200.f, 800.f);
+        shot.m_faction   = shotIndex % 5 == 0 ? eProjectileFaction::ENEMY : eProjectileFaction::PLAYER;
+        return shot;
+    }
+
+    std::vector<sProjectileTarget> MakeTargets()
+    {
+        sShotRandom                    random;
+        std::vector<sProjectileTarget> targets;
+        for (int i = 0; i < TARGET_COUNT; ++i)
+        {
+            targets.push_back({Vec2(random.RollFloat(0.f, 1920.f), random.RollFloat(0.f, 1080.f)), 25.f, i});
+        }
+        return targets;
+    }
+
+    struct sPhaseMilliseconds
+    {
+        double m_integrate = 0.0;
+        double m_collide   = 0.0;
+        double m_edges     = 0.0;
+        double m_render    = 0.0;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // The old path: one heap object per bullet, updated through a virtual call
+    //------------------------------------------------------------------------------------------------
+    class ModelledBullet
+    {
+    public:
+        explicit ModelledBullet(sShot const& shot)
+            : m_position(shot.m_position), m_velocity(shot.m_direction * shot.m_speed), m_faction(shot.m_faction)
+        {
+        }
+
+        virtual ~ModelledBullet() = default;
+
+        virtual void Update(float const deltaSeconds)
+        {
+            m_position += m_velocity * deltaSeconds;
+            m_lifetime -= deltaSeconds;
+        }
+
+        Vec2               m_position;
+        Vec2               m_velocity;
+        float              m_radius   = 4.f;
+        float              m_lifetime = 10.f;
+        eProjectileFaction m_faction  = eProjectileFaction::PLAYER;
+        bool               m_isDead   = false;
+    };
+
+    double RunModelledBullets(std::vector<sProjectileTarget> const& targets)
+    {
+        sShotRandom                                  random;
+        std::vector<std::unique_ptr<ModelledBullet>> bullets;
+        int                                          shotIndex = 0;
+        double                                       seconds   = 0.0;
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            while (static_cast<int>(bullets.size()) < PROJECTILE_COUNT)
+            {
+                bullets.push_back(std::make_unique<ModelledBullet>(RollShot(random, shotIndex++)));
+            }
+
+            double const startSeconds = GetNowSeconds();
+
+            for (std::unique_ptr<ModelledBullet>& bullet : bullets) bullet->Update(FRAME_SECONDS);
+
+            for (std::unique_ptr<ModelledBullet>& bullet : bullets)
+            {
+                if (bullet->m_faction != eProjectileFaction::PLAYER) continue;
+
+                for (sProjectileTarget const& target : targets)
+                {
+                    float const reach = bullet->m_radius + target.m_radius;
+                    if (GetDistanceSquared2D(bullet->m_position, target.m_position) < reach * reach)
+                    {
+                        bullet->m_isDead = true;
+                        break;
+                    }
+                }
+
+                if (!SCREEN_BOUNDS.IsPointInside(bullet->m_position)) bullet->m_isDead = true;
+            }
+
+            std::erase_if(bullets, [](std::unique_ptr<ModelledBullet> const& bullet) { return bullet->m_isDead || bullet->m_lifetime <= 0.f; });
+            seconds += GetNowSeconds() - startSeconds;
+        }
+
+        return seconds * 1000.0 / FRAME_COUNT;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    sPhaseMilliseconds RunProjectileSystem(std::vector<sProjectileTarget> const& targets, int& outHitCount, int& outEdgeHitCount)
+    {
+        sProjectileSystemConfig config;
+        config.m_initialCapacity = PROJECTILE_COUNT;
+
+        ProjectileSystem                     projectiles(config);
+        std::vector<sProjectileTarget> const player = {{Vec2(960.f, 540.f), 30.f, 0}};
+        std::vector<sProjectileHit>          hits;
+        std::vector<eProjectileEdge>         edgeHits;
+        std::vector<sRenderShape>            shapes;
+        sShotRandom                          random;
+        sPhaseMilliseconds                   phases;
+        int                                  shotIndex = 0;
+
+        outHitCount     = 0;
+        outEdgeHitCount = 0;
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            // Dead projectiles are only removed by the next Update, so refill against the live count after it
+            double startSeconds = GetNowSeconds();
+            projectiles.Update(FRAME_SECONDS);
+            phases.m_integrate += GetNowSeconds() - startSeconds;
+
+            for (int i = projectiles.GetProjectileCount(); i < PROJECTILE_COUNT; ++i)
+            {
+                sShot const shot = RollShot(random, shotIndex++);
+                projectiles.SpawnProjectile(shot.m_position, shot.m_direction, shot.m_speed, 4.f, shot.m_faction, Rgba8::WHITE);
+            }
+
+            startSeconds = GetNowSeconds();
+            projectiles.CollideWithTargets(eProjectileFaction::PLAYER, targets, SCREEN_BOUNDS, hits);
+            outHitCount += static_cast<int>(hits.size());
+            projectiles.CollideWithTargets(eProjectileFaction::ENEMY, player, SCREEN_BOUNDS, hits);
+            outHitCount += static_cast<int>(hits.size());
+            phases.m_collide += GetNowSeconds() - startSeconds;
+
+            startSeconds = GetNowSeconds();
+            projectiles.CollectEdgeHits(SCREEN_BOUNDS, edgeHits);
+            outEdgeHitCount += static_cast<int>(edgeHits.size());
+            phases.m_edges += GetNowSeconds() - startSeconds;
+
+            startSeconds = GetNowSeconds();
+            shapes.clear();
+            projectiles.AppendRenderShapes(shapes);
+            phases.m_render += GetNowSeconds() - startSeconds;
+        }
+
+        phases.m_integrate *= 1000.0 / FRAME_COUNT;
+        phases.m_collide *= 1000.0 / FRAME_COUNT;
+        phases.m_edges *= 1000.0 / FRAME_COUNT;
+        phases.m_render *= 1000.0 / FRAME_COUNT;
+        return phases;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(FiftyThousandProjectilesPerFrame)
+{
+    std::vector<sProjectileTarget> const targets = MakeTargets();
+
+    int                      hitCount             = 0;
+    int                      edgeHitCount         = 0;
+    sPhaseMilliseconds const phases               = RunProjectileSystem(targets, hitCount, edgeHitCount);
+    double const             totalMilliseconds    = phases.m_integrate + phases.m_collide + phases.m_edges;
+    double const             modelledMilliseconds = RunModelledBullets(targets);
+
+    std::printf("    ProjectileSystem: integrate %.2f ms, collide %.2f ms, edges %.2f ms (%.2f ms/frame), render shapes %.2f ms\n",
+                phases.m_integrate, phases.m_collide, phases.m_edges, totalMilliseconds, phases.m_render);
+    std::printf("    %d hits, %d edge hits over %d frames\n", hitCount, edgeHitCount, FRAME_COUNT);
+    std::printf("    modelled Bullet entities: %.2f ms/frame\n", modelledMilliseconds);
+
+    CHECK(hitCount > 0);
+    CHECK(totalMilliseconds < modelledMilliseconds);
+}
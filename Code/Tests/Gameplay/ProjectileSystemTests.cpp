@@ -0,0 +1,203 @@
+//----------------------------------------------------------------------------------------------------
+// ProjectileSystemTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Game/Gameplay/ProjectileSystem.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    AABB2 const WORLD_BOUNDS = AABB2(0.f, 0.f, 1920.f, 1080.f);
+
+    // Deterministic LCG so a failing shot reproduces
+    struct sShotRandom
+    {
+        uint32_t m_state = 7u;
+
+        float RollZeroToOne()
+        {
+            m_state = m_state * 1664525u + 1013904223u;
+            return static_cast<float>(m_state >> 8) / static_cast<float>(1u << 24);
+        }
+    };
+
+    // Steps until the projectile hits the target or leaves the world; returns true on a hit
+    bool FireUntilHitOrGone(ProjectileSystem& projectiles, sProjectileTarget const& target, float const deltaSeconds)
+    {
+        std::vector<sProjectileTarget> const targets = {target};
+        std::vector<sProjectileHit>          hits;
+
+        for (int step = 0; step < 1000 && projectiles.GetProjectileCount() > 0; ++step)
+        {
+            projectiles.Update(deltaSeconds);
+            projectiles.CollideWithTargets(eProjectileFaction::PLAYER, targets, WORLD_BOUNDS, hits);
+            if (!hits.empty()) return true;
+        }
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SweepFindsTheFirstTouchingFraction)
+{
+    float timeOfImpact = -1.f;
+
+    // Radii sum to 2, so the discs touch when the center reaches x = 48 of a 100 px step
+    CHECK(ProjectileSystem::SweepDiscAgainstDisc(Vec2(0.f, 0.f), Vec2(100.f, 0.f), 1.f, Vec2(50.f, 0.f), 1.f, timeOfImpact));
+    CHECK_NEAR(timeOfImpact, 0.48f, 1e-5f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SweepStartingInsideHitsAtZero)
+{
+    float timeOfImpact = -1.f;
+
+    CHECK(ProjectileSystem::SweepDiscAgainstDisc(Vec2(49.f, 0.f), Vec2(100.f, 0.f), 1.f, Vec2(50.f, 0.f), 1.f, timeOfImpact));
+    CHECK_EQUAL(timeOfImpact, 0.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SweepMissesPastAndShortTargets)
+{
+    float timeOfImpact = -1.f;
+
+    CHECK(!ProjectileSystem::SweepDiscAgainstDisc(Vec2(0.f, 0.f), Vec2(100.f, 0.f), 1.f, Vec2(50.f, 2.5f), 1.f, timeOfImpact));     // Passes beside
+    CHECK(!ProjectileSystem::SweepDiscAgainstDisc(Vec2(0.f, 0.f), Vec2(40.f, 0.f), 1.f, Vec2(50.f, 0.f), 1.f, timeOfImpact));      // Stops short
+    CHECK(!ProjectileSystem::SweepDiscAgainstDisc(Vec2(60.f, 0.f), Vec2(100.f, 0.f), 1.f, Vec2(50.f, 0.f), 1.f, timeOfImpact));    // Already past
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SweepGrazeJustInsideHits)
+{
+    float timeOfImpact = -1.f;
+
+    CHECK(ProjectileSystem::SweepDiscAgainstDisc(Vec2(0.f, 0.f), Vec2(100.f, 0.f), 1.f, Vec2(50.f, 1.99f), 1.f, timeOfImpact));
+    CHECK(timeOfImpact > 0.4f && timeOfImpact < 0.6f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(StationaryProjectileOnlyHitsWhenTouching)
+{
+    float timeOfImpact = -1.f;
+
+    CHECK(!ProjectileSystem::SweepDiscAgainstDisc(Vec2(10.f, 0.f), Vec2(10.f, 0.f), 1.f, Vec2(50.f, 0.f), 1.f, timeOfImpact));
+    CHECK(ProjectileSystem::SweepDiscAgainstDisc(Vec2(49.f, 0.f), Vec2(49.f, 0.f), 1.f, Vec2(50.f, 0.f), 1.f, timeOfImpact));
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(NoShotMissesAtAnyFrameTime)
+{
+    // Head-on and grazing shots at a split Hexagon sized target, from a 240 Hz frame to a half-second hitch
+    float const deltaSecondsList[] = {1.f / 240.f, 1.f / 60.f, 1.f / 30.f, 1.f / 15.f, 1.f / 10.f, 1.f / 5.f, 0.5f};
+    constexpr int   SHOTS_PER_DELTA   = 2000;
+    constexpr float TARGET_RADIUS     = 18.f;
+    constexpr float PROJECTILE_RADIUS = 10.f;
+
+    sShotRandom random;
+
+    for (float const deltaSeconds : deltaSecondsList)
+    {
+        int missCount = 0;
+
+        for (int shot = 0; shot < SHOTS_PER_DELTA; ++shot)
+        {
+            ProjectileSystem projectiles(sProjectileSystemConfig{});
+
+            Vec2 const  targetPosition = Vec2(860.f + random.RollZeroToOne() * 200.f, 440.f + random.RollZeroToOne() * 200.f);
+            Vec2 const  direction      = Vec2::MakeFromPolarDegrees(random.RollZeroToOne() * 360.f);
+            Vec2 const  sideways       = Vec2(-direction.y, direction.x);
+            float const sideOffset     = (random.RollZeroToOne() * 2.f - 1.f) * (TARGET_RADIUS + PROJECTILE_RADIUS) * 0.99f;
+            Vec2 const  start          = targetPosition - direction * (300.f + random.RollZeroToOne() * 200.f) + sideways * sideOffset;
+            float const speed          = 500.f + random.RollZeroToOne() * 4000.f;
+
+            projectiles.SpawnProjectile(start, direction, speed, PROJECTILE_RADIUS, eProjectileFaction::PLAYER, Rgba8::WHITE);
+
+            if (!FireUntilHitOrGone(projectiles, sProjectileTarget{targetPosition, TARGET_RADIUS, 0}, deltaSeconds)) ++missCount;
+        }
+
+        if (missCount != 0) std::printf("    dt %.4f: %d of %d shots missed\n", deltaSeconds, missCount, SHOTS_PER_DELTA);
+        CHECK_EQUAL(missCount, 0);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(HitsComeInTimeOfImpactOrder)
+{
+    ProjectileSystem projectiles(sProjectileSystemConfig{});
+
+    // Same speed, different distances to their targets
+    projectiles.SpawnProjectile(Vec2(100.f, 100.f), Vec2(1.f, 0.f), 1000.f, 2.f, eProjectileFaction::PLAYER, Rgba8::WHITE);
+    projectiles.SpawnProjectile(Vec2(100.f, 300.f), Vec2(1.f, 0.f), 1000.f, 2.f, eProjectileFaction::PLAYER, Rgba8::WHITE);
+    projectiles.SpawnProjectile(Vec2(100.f, 500.f), Vec2(1.f, 0.f), 1000.f, 2.f, eProjectileFaction::PLAYER, Rgba8::WHITE);
+
+    std::vector<sProjectileTarget> const targets = {{Vec2(180.f, 100.f), 8.f, 0}, {Vec2(130.f, 300.f), 8.f, 1}, {Vec2(155.f, 500.f), 8.f, 2}};
+    std::vector<sProjectileHit>          hits;
+
+    projectiles.Update(0.1f);
+    projectiles.CollideWithTargets(eProjectileFaction::PLAYER, targets, WORLD_BOUNDS, hits);
+
+    CHECK_EQUAL(hits.size(), 3u);
+    CHECK_EQUAL(hits[0].m_targetIndex, 1);
+    CHECK_EQUAL(hits[1].m_targetIndex, 2);
+    CHECK_EQUAL(hits[2].m_targetIndex, 0);
+    CHECK(hits[0].m_timeOfImpact <= hits[1].m_timeOfImpact && hits[1].m_timeOfImpact <= hits[2].m_timeOfImpact);
+
+    // The impact position is on the segment, touching the target's surface
+    CHECK_NEAR(hits[0].m_position.x, 130.f - 10.f, 0.01f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(EarliestTargetAlongTheStepWins)
+{
+    ProjectileSystem projectiles(sProjectileSystemConfig{});
+    projectiles.SpawnProjectile(Vec2(100.f, 100.f), Vec2(1.f, 0.f), 2000.f, 2.f, eProjectileFaction::PLAYER, Rgba8::WHITE);
+
+    // The far target comes first in the list; the near one along the step must still win
+    std::vector<sProjectileTarget> const targets = {{Vec2(250.f, 100.f), 8.f, 0}, {Vec2(150.f, 100.f), 8.f, 1}};
+    std::vector<sProjectileHit>          hits;
+
+    projectiles.Update(0.1f);
+    projectiles.CollideWithTargets(eProjectileFaction::PLAYER, targets, WORLD_BOUNDS, hits);
+
+    CHECK_EQUAL(hits.size(), 1u);
+    CHECK_EQUAL(hits[0].m_targetIndex, 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(TiesGoToTheTargetListedFirst)
+{
+    ProjectileSystem projectiles(sProjectileSystemConfig{});
+    projectiles.SpawnProjectile(Vec2(100.f, 100.f), Vec2(1.f, 0.f), 2000.f, 2.f, eProjectileFaction::PLAYER, Rgba8::WHITE);
+
+    // Two targets stacked on the same spot; the grid may return them in any order
+    std::vector<sProjectileTarget> const targets = {{Vec2(200.f, 100.f), 8.f, 7}, {Vec2(200.f, 100.f), 8.f, 3}};
+    std::vector<sProjectileHit>          hits;
+
+    projectiles.Update(0.1f);
+    projectiles.CollideWithTargets(eProjectileFaction::PLAYER, targets, WORLD_BOUNDS, hits);
+
+    CHECK_EQUAL(hits.size(), 1u);
+    CHECK_EQUAL(hits[0].m_targetIndex, 7);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(OtherFactionIsNotCollided)
+{
+    ProjectileSystem projectiles(sProjectileSystemConfig{});
+    projectiles.SpawnProjectile(Vec2(100.f, 100.f), Vec2(1.f, 0.f), 2000.f, 2.f, eProjectileFaction::ENEMY, Rgba8::WHITE);
+
+    std::vector<sProjectileTarget> const targets = {{Vec2(150.f, 100.f), 8.f, 0}};
+    std::vector<sProjectileHit>          hits;
+
+    projectiles.Update(0.1f);
+    projectiles.CollideWithTargets(eProjectileFaction::PLAYER, targets, WORLD_BOUNDS, hits);
+
+    CHECK(hits.empty());
+    CHECK_EQUAL(projectiles.GetProjectileCount(), 1);
+}
@@ -0,0 +1,124 @@
+//----------------------------------------------------------------------------------------------------
+// SpawnQueueBenchmark.cpp
+// A hexagon death cascade through SpawnQueue, drained the way Game::FlushSpawnQueue drains it. Commands
+// busy-wait a modelled cost instead of creating entities: 40 us for a window-less spawn, 1800 us for
+// one that opens a child window and widget. Four large hexagons die on each of frames 10 to 12, on
+// top of a wave spawn every 30 frames; 240 frames with the queue off and with a 1000 / 2000 us budget.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+
+#include "Game/Gameplay/SpawnQueue.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int    FRAME_COUNT               = 240;
+    constexpr int    CASCADE_FIRST_FRAME       = 10;
+    constexpr int    CASCADE_LAST_FRAME        = 12;
+    constexpr double WINDOWLESS_MICROSECONDS   = 40.0;
+    constexpr double CHILD_WINDOW_MICROSECONDS = 1800.0;
+
+    struct sCascadeRun
+    {
+        double m_worstFrameMicroseconds = 0.0;
+        double m_totalMicroseconds      = 0.0;
+        int    m_drainFrameCount        = 0;     // Frames from the first split until the queue is empty
+        int    m_peakPendingCount       = 0;
+    };
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void BusyWait(double const microseconds)
+    {
+        double const endSeconds = GetNowSeconds() + microseconds * 1e-6;
+        while (GetNowSeconds() < endSeconds) {}
+    }
+
+    void EnqueueFrameSpawns(SpawnQueue& spawnQueue, int const frame)
+    {
+        // Each hexagon splits into 2 or 3 children, about half of them with a child window
+        if (frame >= CASCADE_FIRST_FRAME && frame <= CASCADE_LAST_FRAME)
+        {
+            for (int hexagon = 0; hexagon < 4; ++hexagon)
+            {
+                int const childCount = 2 + (hexagon + frame) % 2;
+                for (int child = 0; child < childCount; ++child)
+                {
+                    sSpawnCommand command;
+                    command.m_type           = eSpawnCommandType::SPLIT_HEXAGON;
+                    command.m_hasChildWindow = ((hexagon + child) & 1) != 0;
+                    command.m_priority       = command.m_hasChildWindow ? eSpawnPriority::GAMEPLAY : eSpawnPriority::IMMEDIATE;
+                    spawnQueue.Enqueue(command);
+                }
+            }
+        }
+
+        if (frame % 30 == 0)
+        {
+            sSpawnCommand command;
+            command.m_hasChildWindow = ((frame / 30) & 1) != 0;
+            command.m_priority       = command.m_hasChildWindow ? eSpawnPriority::COSMETIC : eSpawnPriority::GAMEPLAY;
+            spawnQueue.Enqueue(command);
+        }
+    }
+
+    sCascadeRun RunCascade(bool const isEnabled, float const budgetMicroseconds)
+    {
+        sSpawnQueueConfig config;
+        config.m_isEnabled          = isEnabled;
+        config.m_budgetMicroseconds = budgetMicroseconds;
+        SpawnQueue spawnQueue(config);
+
+        sCascadeRun run;
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            EnqueueFrameSpawns(spawnQueue, frame);
+
+            double const startSeconds = GetNowSeconds();
+            spawnQueue.BeginFlush();
+
+            sSpawnCommand command;
+            while (spawnQueue.BeginCommand(command))
+            {
+                BusyWait(command.m_hasChildWindow ? CHILD_WINDOW_MICROSECONDS : WINDOWLESS_MICROSECONDS);
+                spawnQueue.EndCommand();
+            }
+
+            double const frameMicroseconds = (GetNowSeconds() - startSeconds) * 1e6;
+            run.m_worstFrameMicroseconds   = (std::max)(run.m_worstFrameMicroseconds, frameMicroseconds);
+            run.m_totalMicroseconds += frameMicroseconds;
+
+            if (frame >= CASCADE_FIRST_FRAME && frame < 60 && spawnQueue.GetPendingCount() > 0) run.m_drainFrameCount = frame - CASCADE_FIRST_FRAME + 1;
+        }
+
+        run.m_peakPendingCount = spawnQueue.GetPeakPendingCount();
+        return run;
+    }
+
+    sCascadeRun RunAndPrint(char const* label, bool const isEnabled, float const budgetMicroseconds)
+    {
+        sCascadeRun const run = RunCascade(isEnabled, budgetMicroseconds);
+        std::printf("    %-16s worst frame %5.0f us, total %6.0f us, drained in %2d frames, peak %d pending\n",
+                    label, run.m_worstFrameMicroseconds, run.m_totalMicroseconds, run.m_drainFrameCount, run.m_peakPendingCount);
+        return run;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(HexagonCascadeWorstFrame)
+{
+    sCascadeRun const unbudgeted = RunAndPrint("queue off:", false, 1000.f);
+    sCascadeRun const budgeted   = RunAndPrint("1000 us budget:", true, 1000.f);
+    RunAndPrint("2000 us budget:", true, 2000.f);
+
+    // One child-window spawn may overrun the budget on its own; a whole cascade frame must not
+    CHECK(budgeted.m_worstFrameMicroseconds < unbudgeted.m_worstFrameMicroseconds * 0.5);
+    CHECK(budgeted.m_drainFrameCount <= 30);
+}
@@ -0,0 +1,16 @@
+//----------------------------------------------------------------------------------------------------
+// GameGlobals.cpp
+// The globals App.cpp owns in the game; tests point the ones they need at local instances.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+App*               g_app               = nullptr;
+AudioRequestQueue* g_audioRequestQueue = nullptr;
+FrameArena*        g_frameArena        = nullptr;
+Game*              g_game              = nullptr;
+RenderPipeline*    g_renderPipeline    = nullptr;
+WidgetSubsystem*   g_widgetSubsystem   = nullptr;
+WindowSubsystem*   g_windowSubsystem   = nullptr;
@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------------------------------
+// TestHarness.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Harness/TestHarness.hpp"
+
+#include <cstring>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    struct sRegisteredTest
+    {
+        char const*               m_name     = nullptr;
+        TestHarness::TestFunction m_function = nullptr;
+    };
+
+    // Function-local so registration from static initializers in other translation units is safe
+    std::vector<sRegisteredTest>& GetRegisteredTests()
+    {
+        static std::vector<sRegisteredTest> s_tests;
+        return s_tests;
+    }
+
+    int s_failureCount = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool TestHarness::RegisterTest(char const* testName, TestFunction const function)
+{
+    GetRegisteredTests().push_back({testName, function});
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void TestHarness::ReportFailure(char const* fileName, int const lineNumber, char const* expression)
+{
+    std::printf("    %s(%d): CHECK failed: %s\n", fileName, lineNumber, expression);
+    ++s_failureCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// main - Runs every registered test, or only those whose name contains argv[1]
+//----------------------------------------------------------------------------------------------------
+int main(int const argc, char** argv)
+{
+    char const* filter          = argc > 1 ? argv[1] : nullptr;
+    int         failedTestCount = 0;
+    int         runTestCount    = 0;
+
+    for (sRegisteredTest const& test : GetRegisteredTests())
+    {
+        if (filter != nullptr && std::strstr(test.m_name, filter) == nullptr) continue;
+
+        int const failuresBefore = s_failureCount;
+        test.m_function();
+        ++runTestCount;
+
+        bool const hasPassed = s_failureCount == failuresBefore;
+        std::printf("[%s] %s\n", hasPassed ? "PASS" : "FAIL", test.m_name);
+        if (!hasPassed) ++failedTestCount;
+    }
+
+    std::printf("%d of %d tests passed\n", runTestCount - failedTestCount, runTestCount);
+    return failedTestCount;
+}
@@ -0,0 +1,36 @@
+//----------------------------------------------------------------------------------------------------
+// TestHarness.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdio>
+
+//----------------------------------------------------------------------------------------------------
+// TestHarness
+// Minimal self-registering test runner for the engine-free game modules. Each test executable links
+// TestHarness.cpp, which provides main(); a test fails when any CHECK in it fails, and the process
+// exit code is the number of failed tests so ctest picks it up.
+//----------------------------------------------------------------------------------------------------
+namespace TestHarness
+{
+    typedef void (*TestFunction)();
+
+    bool RegisterTest(char const* testName, TestFunction function);
+    void ReportFailure(char const* fileName, int lineNumber, char const* expression);
+}
+
+//----------------------------------------------------------------------------------------------------
+#define TEST(testName)                                                                          \
+    static void testName();                                                                     \
+    static bool const s_isRegistered_##testName = TestHarness::RegisterTest(#testName, testName); \
+    static void testName()
+
+#define CHECK(expression)                                                         \
+    do                                                                            \
+    {                                                                             \
+        if (!(expression)) TestHarness::ReportFailure(__FILE__, __LINE__, #expression); \
+    } while (false)
+
+#define CHECK_EQUAL(actual, expected) CHECK((actual) == (expected))
+#define CHECK_NEAR(actual, expected, tolerance) CHECK(((actual) - (expected)) <= (tolerance) && ((expected) - (actual)) <= (tolerance))
@@ -0,0 +1,156 @@
+//----------------------------------------------------------------------------------------------------
+// AudioRequestQueueTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Audio/AudioRequestQueue.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr SoundID HIT_SOUND  = 1;
+    constexpr SoundID COIN_SOUND = 2;
+
+    sAudioRequestQueueConfig WithBackend(IAudioBackend* backend, eVoiceStealPolicy const stealPolicy = eVoiceStealPolicy::STEAL_OLDEST)
+    {
+        sAudioRequestQueueConfig config;
+        config.m_backend            = backend;
+        config.m_defaultStealPolicy = stealPolicy;
+        return config;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(IdenticalRequestsInAFrameStartOneVoice)
+{
+    NullAudioBackend  backend;
+    AudioRequestQueue queue(WithBackend(&backend));
+
+    for (int i = 0; i < 300; ++i)
+    {
+        queue.RequestSound(HIT_SOUND);
+    }
+    for (int i = 0; i < 5; ++i)
+    {
+        queue.RequestSound(COIN_SOUND);
+    }
+    queue.Flush();
+
+    CHECK_EQUAL(backend.GetStartSoundCount(), 2u);
+    CHECK_EQUAL(queue.GetRequestCountLastFrame(), 305u);
+    CHECK_EQUAL(queue.GetStartedVoiceCountLastFrame(), 2u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(CoalescedVolumeGrowsAndIsCapped)
+{
+    NullAudioBackend  backend;
+    AudioRequestQueue queue(WithBackend(&backend));
+
+    // Three requests: 1 + 0.1 * 2
+    for (int i = 0; i < 3; ++i)
+    {
+        queue.RequestSound(HIT_SOUND, 0.5f);
+    }
+    queue.Flush();
+    CHECK_NEAR(backend.GetLastStartVolume(), 0.5f * 1.2f, 1e-5f);
+
+    // Hundreds of requests stop at the 2x cap
+    backend.FinishAllVoices();
+    for (int i = 0; i < 500; ++i)
+    {
+        queue.RequestSound(HIT_SOUND, 0.5f);
+    }
+    queue.Flush();
+    CHECK_NEAR(backend.GetLastStartVolume(), 1.f, 1e-5f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(LoudestDuplicateSetsTheVolume)
+{
+    NullAudioBackend  backend;
+    AudioRequestQueue queue(WithBackend(&backend));
+
+    queue.RequestSound(HIT_SOUND, 0.2f);
+    queue.RequestSound(HIT_SOUND, 0.6f);
+    queue.Flush();
+
+    CHECK_NEAR(backend.GetLastStartVolume(), 0.6f * 1.1f, 1e-5f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(StealOldestKeepsTheVoiceLimit)
+{
+    NullAudioBackend  backend;
+    AudioRequestQueue queue(WithBackend(&backend));
+    queue.SetSoundLimit(HIT_SOUND, 2, eVoiceStealPolicy::STEAL_OLDEST);
+
+    // One voice per frame; nothing finishes, so the third and fourth frames steal
+    for (int frame = 0; frame < 4; ++frame)
+    {
+        queue.RequestSound(HIT_SOUND);
+        queue.Flush();
+    }
+
+    CHECK_EQUAL(backend.GetStartSoundCount(), 4u);
+    CHECK_EQUAL(backend.GetStopSoundCount(), 2u);
+    CHECK_EQUAL(queue.GetStolenVoiceCountLastFrame(), 1u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(RejectNewDropsRequestsWhileVoicesAreBusy)
+{
+    NullAudioBackend  backend;
+    AudioRequestQueue queue(WithBackend(&backend));
+    queue.SetSoundLimit(HIT_SOUND, 2, eVoiceStealPolicy::REJECT_NEW);
+
+    for (int frame = 0; frame < 4; ++frame)
+    {
+        queue.RequestSound(HIT_SOUND);
+        queue.Flush();
+    }
+
+    CHECK_EQUAL(backend.GetStartSoundCount(), 2u);
+    CHECK_EQUAL(backend.GetStopSoundCount(), 0u);
+    CHECK_EQUAL(queue.GetRejectedVoiceCountLastFrame(), 1u);
+
+    // Once the voices finish, the sound plays again
+    backend.FinishAllVoices();
+    queue.RequestSound(HIT_SOUND);
+    queue.Flush();
+    CHECK_EQUAL(backend.GetStartSoundCount(), 3u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(DefaultLimitAppliesToUnconfiguredSounds)
+{
+    NullAudioBackend  backend;
+    AudioRequestQueue queue(WithBackend(&backend, eVoiceStealPolicy::REJECT_NEW));
+
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        queue.RequestSound(COIN_SOUND);
+        queue.Flush();
+    }
+
+    CHECK_EQUAL(backend.GetStartSoundCount(), 4u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(StopAllStopsEveryVoiceAndDropsPendingRequests)
+{
+    NullAudioBackend  backend;
+    AudioRequestQueue queue(WithBackend(&backend));
+
+    queue.RequestSound(HIT_SOUND);
+    queue.RequestSound(COIN_SOUND);
+    queue.Flush();
+
+    queue.RequestSound(HIT_SOUND);
+    queue.StopAll();
+    queue.Flush();
+
+    CHECK_EQUAL(backend.GetStopSoundCount(), 2u);
+    CHECK_EQUAL(backend.GetStartSoundCount(), 2u);
+}
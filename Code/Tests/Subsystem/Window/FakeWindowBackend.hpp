@@ -0,0 +1,137 @@
+//----------------------------------------------------------------------------------------------------
+// FakeWindowBackend.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+
+#include "Game/Subsystem/Window/WindowBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// One fake OS window; the client rect is kept in OS space (top-left origin) like Win32 does
+//----------------------------------------------------------------------------------------------------
+struct sFakeNativeWindow
+{
+    String m_title;
+    bool   m_isVisible    = false;
+    int    m_clientLeft   = 0;
+    int    m_clientTop    = 0;
+    int    m_clientWidth  = 0;
+    int    m_clientHeight = 0;
+    int    m_zOrder       = 0;     // Higher is closer to the top
+};
+
+//----------------------------------------------------------------------------------------------------
+// FakeWindowBackend
+// Records every call WindowSubsystem makes instead of reaching an OS. Windows are placed exactly
+// where CreateNativeWindow asks (no frame), and client rects are reported in engine screen space
+// with the same Y flip the Win32 backend applies.
+//----------------------------------------------------------------------------------------------------
+class FakeWindowBackend : public IWindowBackend
+{
+public:
+    void* CreateNativeWindow(String const& title, int const x, int const y, int const width, int const height) override
+    {
+        ++m_createCount;
+
+        void* const windowHandle = reinterpret_cast<void*>(static_cast<uintptr_t>(m_createCount));
+
+        sFakeNativeWindow& window = m_windows[windowHandle];
+        window.m_title            = title;
+        window.m_clientLeft       = x;
+        window.m_clientTop        = y;
+        window.m_clientWidth      = width;
+        window.m_clientHeight     = height;
+        window.m_zOrder           = m_createCount;
+
+        return windowHandle;
+    }
+
+    void PlaceNativeWindow(void* windowHandle, int const x, int const y, int const width, int const height) override
+    {
+        ++m_placeCount;
+
+        sFakeNativeWindow& window = m_windows[windowHandle];
+        window.m_clientLeft       = x;
+        window.m_clientTop        = y;
+        window.m_clientWidth      = width;
+        window.m_clientHeight     = height;
+    }
+
+    void* GetNativeDisplayContext(void* windowHandle) override { return windowHandle; }
+
+    void GetNativeClientRect(void* windowHandle, Vec2& outClientPosition, Vec2& outClientDimensions) override
+    {
+        ++m_clientRectQueryCount;
+
+        sFakeNativeWindow const& window = m_windows[windowHandle];
+        outClientPosition   = Vec2(static_cast<float>(window.m_clientLeft), static_cast<float>(m_screenHeight - (window.m_clientTop + window.m_clientHeight)));
+        outClientDimensions = Vec2(static_cast<float>(window.m_clientWidth), static_cast<float>(window.m_clientHeight));
+    }
+
+    void ShowNativeWindow(void* windowHandle, bool const isVisible) override
+    {
+        ++m_showCount;
+        m_windows[windowHandle].m_isVisible = isVisible;
+    }
+
+    void SetNativeWindowTitle(void* windowHandle, String const& title) override
+    {
+        ++m_titleCount;
+        m_windows[windowHandle].m_title = title;
+    }
+
+    void CommitWindowGeometry(std::vector<sWindowGeometry> const& geometries) override
+    {
+        ++m_geometryBatchCount;
+        m_geometryWindowCount += static_cast<int>(geometries.size());
+
+        for (sWindowGeometry const& geometry : geometries)
+        {
+            sFakeNativeWindow& window = m_windows[geometry.m_windowHandle];
+            window.m_clientWidth      = static_cast<int>(geometry.m_clientDimensions.x);
+            window.m_clientHeight     = static_cast<int>(geometry.m_clientDimensions.y);
+            window.m_clientLeft       = static_cast<int>(geometry.m_clientPosition.x);
+            window.m_clientTop        = m_screenHeight - static_cast<int>(geometry.m_clientPosition.y) - window.m_clientHeight;
+        }
+    }
+
+    void SortTopmostFirst(std::vector<void*>& inOutWindowHandles) override
+    {
+        ++m_sortCount;
+
+        std::sort(inOutWindowHandles.begin(), inOutWindowHandles.end(), [this](void* a, void* b)
+        {
+            return m_windows[a].m_zOrder > m_windows[b].m_zOrder;
+        });
+    }
+
+    // Calls WindowSubsystem counts as OS calls: placement, visibility, title and one per committed geometry
+    int GetOSCallCount() const { return m_placeCount + m_showCount + m_titleCount + m_geometryWindowCount; }
+
+    void ResetCallCounts()
+    {
+        m_placeCount           = 0;
+        m_showCount            = 0;
+        m_titleCount           = 0;
+        m_geometryBatchCount   = 0;
+        m_geometryWindowCount  = 0;
+        m_sortCount            = 0;
+        m_clientRectQueryCount = 0;
+    }
+
+    std::unordered_map<void*, sFakeNativeWindow> m_windows;
+    int                                          m_screenHeight = 1080;     // Matches the stand-in main window
+
+    int m_createCount          = 0;
+    int m_placeCount           = 0;
+    int m_showCount            = 0;
+    int m_titleCount           = 0;
+    int m_geometryBatchCount   = 0;
+    int m_geometryWindowCount  = 0;
+    int m_sortCount            = 0;
+    int m_clientRectQueryCount = 0;
+};
@@ -0,0 +1,253 @@
+//----------------------------------------------------------------------------------------------------
+// PixelExtraction.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Subsystem/Window/PixelExtraction.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//----------------------------------------------------------------------------------------------------
+// MSVC emits AVX2 intrinsics without /arch:AVX2; GCC / Clang need the function-level target
+//----------------------------------------------------------------------------------------------------
+#if defined(_MSC_VER)
+#define PIXEL_TARGET_SSSE3
+#define PIXEL_TARGET_AVX2
+#else
+#define PIXEL_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define PIXEL_TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // Rows per thread below which splitting costs more than it saves
+    constexpr int MIN_ROWS_PER_THREAD = 64;
+
+    //------------------------------------------------------------------------------------------------
+    // A contiguous run of destination rows of one job
+    //------------------------------------------------------------------------------------------------
+    struct sRowRange
+    {
+        sPixelExtractJob const* m_job      = nullptr;
+        int                     m_firstRow = 0;
+        int                     m_rowCount = 0;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    bool IsCpuFeatureSupported(ePixelKernel const kernel)
+    {
+#if defined(_MSC_VER)
+        int cpuInfo[4] = {};
+        __cpuid(cpuInfo, 0);
+        int const maxLeaf = cpuInfo[0];
+
+        __cpuid(cpuInfo, 1);
+        bool const hasSSSE3   = (cpuInfo[2] & (1 << 9)) != 0;
+        bool const hasOSXSAVE = (cpuInfo[2] & (1 << 27)) != 0;
+        if (kernel == ePixelKernel::SSSE3) return hasSSSE3;
+
+        if (maxLeaf < 7 || !hasOSXSAVE) return false;
+        if ((_xgetbv(0) & 0x6) != 0x6) return false;     // OS saves YMM state
+
+        __cpuidex(cpuInfo, 7, 0);
+        return (cpuInfo[1] & (1 << 5)) != 0;
+#else
+        if (kernel == ePixelKernel::SSSE3) return __builtin_cpu_supports("ssse3");
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+
+    //------------------------------------------------------------------------------------------------
+    uint8_t const* GetSourceRow(sPixelFrameView const& frame, sPixelExtractJob const& job, int const destinationRow)
+    {
+        int const sourceRow = job.m_flipY ? job.m_sourceRect.m_bottom - 1 - destinationRow : job.m_sourceRect.m_top + destinationRow;
+        return frame.m_pixels + static_cast<size_t>(sourceRow) * frame.m_pitch + static_cast<size_t>(job.m_sourceRect.m_left) * 4;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void SwapRedBlueRowScalar(uint8_t* destination, uint8_t const* source, int const pixelCount)
+    {
+        for (int i = 0; i < pixelCount; ++i)
+        {
+            destination[0] = source[2];
+            destination[1] = source[1];
+            destination[2] = source[0];
+            destination[3] = source[3];
+            destination += 4;
+            source += 4;
+        }
+    }
+
+    PIXEL_TARGET_SSSE3 void SwapRedBlueRowSSSE3(uint8_t* destination, uint8_t const* source, int const pixelCount)
+    {
+        __m128i const shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+        int i = 0;
+        for (; i + 4 <= pixelCount; i += 4)
+        {
+            __m128i const pixels = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + i * 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), _mm_shuffle_epi8(pixels, shuffle));
+        }
+
+        SwapRedBlueRowScalar(destination + i * 4, source + i * 4, pixelCount - i);
+    }
+
+    PIXEL_TARGET_AVX2 void SwapRedBlueRowAVX2(uint8_t* destination, uint8_t const* source, int const pixelCount)
+    {
+        // vpshufb shuffles within each 128-bit lane, so the same 16-byte pattern is repeated
+        __m256i const shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                                 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+        int i = 0;
+        for (; i + 8 <= pixelCount; i += 8)
+        {
+            __m256i const pixels = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(source + i * 4));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * 4), _mm256_shuffle_epi8(pixels, shuffle));
+        }
+
+        SwapRedBlueRowScalar(destination + i * 4, source + i * 4, pixelCount - i);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void ExtractRows(sPixelFrameView const& frame, sRowRange const& range, ePixelKernel const kernel)
+    {
+        sPixelExtractJob const& job        = *range.m_job;
+        int const               pixelCount = job.m_sourceRect.GetWidth();
+        size_t const            rowBytes   = static_cast<size_t>(pixelCount) * 4;
+
+        for (int row = range.m_firstRow; row < range.m_firstRow + range.m_rowCount; ++row)
+        {
+            uint8_t const* source      = GetSourceRow(frame, job, row);
+            uint8_t*       destination = job.m_destination + static_cast<size_t>(row) * job.m_destinationPitch;
+
+            if (!job.m_swapRedBlue)
+            {
+                memcpy(destination, source, rowBytes);
+                continue;
+            }
+
+            switch (kernel)
+            {
+            case ePixelKernel::AVX2:  SwapRedBlueRowAVX2(destination, source, pixelCount); break;
+            case ePixelKernel::SSSE3: SwapRedBlueRowSSSE3(destination, source, pixelCount); break;
+            default:                  SwapRedBlueRowScalar(destination, source, pixelCount); break;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ePixelKernel PixelExtraction::GetBestSupportedKernel()
+{
+    static ePixelKernel const s_bestKernel = IsCpuFeatureSupported(ePixelKernel::AVX2)
+                                                 ? ePixelKernel::AVX2
+                                                 : IsCpuFeatureSupported(ePixelKernel::SSSE3)
+                                                 ? ePixelKernel::SSSE3
+                                                 : ePixelKernel::SCALAR;
+    return s_bestKernel;
+}
+
+void PixelExtraction::ExtractScalar(sPixelFrameView const& frame, sPixelExtractJob const& job)
+{
+    int const width  = job.m_sourceRect.GetWidth();
+    int const height = job.m_sourceRect.GetHeight();
+
+    for (int y = 0; y < height; ++y)
+    {
+        uint8_t const* source      = GetSourceRow(frame, job, y);
+        uint8_t*       destination = job.m_destination + static_cast<size_t>(y) * job.m_destinationPitch;
+
+        for (int x = 0; x < width; ++x)
+        {
+            uint8_t const* sourcePixel      = source + x * 4;
+            uint8_t*       destinationPixel = destination + x * 4;
+
+            destinationPixel[0] = job.m_swapRedBlue ? sourcePixel[2] : sourcePixel[0];
+            destinationPixel[1] = sourcePixel[1];
+            destinationPixel[2] = job.m_swapRedBlue ? sourcePixel[0] : sourcePixel[2];
+            destinationPixel[3] = sourcePixel[3];
+        }
+    }
+}
+
+void PixelExtraction::Extract(sPixelFrameView const& frame, sPixelExtractJob const& job, ePixelKernel const kernel)
+{
+    if (job.m_sourceRect.IsEmpty()) return;
+
+    ePixelKernel const usedKernel = (std::min)(kernel, GetBestSupportedKernel());
+    ExtractRows(frame, {&job, 0, job.m_sourceRect.GetHeight()}, usedKernel);
+}
+
+void PixelExtraction::Extract(sPixelFrameView const&               frame,
+                              std::vector<sPixelExtractJob> const& jobs,
+                              ePixelKernel const                   kernel,
+                              int const                            threadCount)
+{
+    ePixelKernel const usedKernel = (std::min)(kernel, GetBestSupportedKernel());
+
+    int totalRows = 0;
+    for (sPixelExtractJob const& job : jobs)
+    {
+        if (!job.m_sourceRect.IsEmpty()) totalRows += job.m_sourceRect.GetHeight();
+    }
+
+    int const usedThreadCount = std::clamp(totalRows / MIN_ROWS_PER_THREAD, 1, (std::max)(threadCount, 1));
+
+    // Split the rows of all jobs into usedThreadCount contiguous partitions of near-equal size
+    std::vector<std::vector<sRowRange>> partitions(static_cast<size_t>(usedThreadCount));
+    int const rowsPerPartition = (totalRows + usedThreadCount - 1) / usedThreadCount;
+    int       partitionIndex   = 0;
+    int       partitionRows    = 0;
+
+    for (sPixelExtractJob const& job : jobs)
+    {
+        if (job.m_sourceRect.IsEmpty()) continue;
+
+        int row = 0;
+        while (row < job.m_sourceRect.GetHeight())
+        {
+            int const rowCount = (std::min)(job.m_sourceRect.GetHeight() - row, rowsPerPartition - partitionRows);
+            partitions[static_cast<size_t>(partitionIndex)].push_back({&job, row, rowCount});
+
+            row += rowCount;
+            partitionRows += rowCount;
+
+            if (partitionRows == rowsPerPartition && partitionIndex + 1 < usedThreadCount)
+            {
+                ++partitionIndex;
+                partitionRows = 0;
+            }
+        }
+    }
+
+    auto const runPartition = [&frame, usedKernel](std::vector<sRowRange> const& partition)
+    {
+        for (sRowRange const& range : partition)
+        {
+            ExtractRows(frame, range, usedKernel);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(partitions.size() - 1);
+
+    for (size_t i = 1; i < partitions.size(); ++i)
+    {
+        workers.emplace_back(runPartition, std::cref(partitions[i]));
+    }
+
+    runPartition(partitions[0]);
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
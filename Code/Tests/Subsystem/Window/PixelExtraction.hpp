@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------------------------------
+// PixelExtraction.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Game/Subsystem/Window/ReadbackPlanner.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Read-only view of a 4-byte-per-pixel frame (RGBA8 or BGRA8), top row first
+//----------------------------------------------------------------------------------------------------
+struct sPixelFrameView
+{
+    uint8_t const* m_pixels = nullptr;
+    int            m_width  = 0;
+    int            m_height = 0;
+    size_t         m_pitch  = 0;     // Bytes per row, >= m_width * 4
+};
+
+//----------------------------------------------------------------------------------------------------
+// One sub-rect to crop out of the frame into its own tightly or loosely packed buffer
+//----------------------------------------------------------------------------------------------------
+struct sPixelExtractJob
+{
+    sPixelRect m_sourceRect;                 // Must lie inside the frame
+    uint8_t*   m_destination      = nullptr;
+    size_t     m_destinationPitch = 0;       // Bytes per row, >= source rect width * 4
+    bool       m_swapRedBlue      = false;   // BGRA <-> RGBA
+    bool       m_flipY            = false;   // Destination row 0 is the bottom source row
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class ePixelKernel : uint8_t
+{
+    SCALAR,
+    SSSE3,
+    AVX2,
+};
+
+//----------------------------------------------------------------------------------------------------
+// PixelExtraction
+// Crops many sub-rects out of one frame. Plain copies go through memcpy per row, red/blue swaps use
+// the widest shuffle the CPU supports, and rows of all jobs can be split across threads.
+// The per-window copy itself happens in the engine's RenderViewportToWindow, so the game has nothing
+// to call this from; it lives here as the measured reference for that copy (PixelExtractionTests,
+// PixelExtractionBenchmark).
+//----------------------------------------------------------------------------------------------------
+namespace PixelExtraction
+{
+    ePixelKernel GetBestSupportedKernel();
+
+    // Reference implementation, one pixel at a time
+    void ExtractScalar(sPixelFrameView const& frame, sPixelExtractJob const& job);
+
+    // Same result as ExtractScalar; kernel is clamped to what the CPU supports
+    void Extract(sPixelFrameView const& frame, sPixelExtractJob const& job, ePixelKernel kernel);
+    void Extract(sPixelFrameView const& frame, std::vector<sPixelExtractJob> const& jobs, ePixelKernel kernel, int threadCount);
+}
@@ -0,0 +1,106 @@
+//----------------------------------------------------------------------------------------------------
+// PixelExtractionBenchmark.cpp
+// GB/s of a full 3840x2160 Y-flipped extraction: the scalar reference with a red/blue swap, memcpy
+// rows, and the SSSE3 / AVX2 swap kernels; then 64 window-sized jobs split over 1, 2 and 4 threads.
+// 50 passes each; bytes counted once per destination pixel.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "Harness/TestHarness.hpp"
+#include "Subsystem/Window/PixelExtraction.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int FRAME_WIDTH  = 3840;
+    constexpr int FRAME_HEIGHT = 2160;
+    constexpr int PASS_COUNT   = 50;
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    template <typename PassFunction>
+    double MeasureGigabytesPerSecond(size_t const bytesPerPass, PassFunction const& pass)
+    {
+        pass();     // Warm the destination pages
+
+        double const startSeconds = GetNowSeconds();
+        for (int passIndex = 0; passIndex < PASS_COUNT; ++passIndex) pass();
+        return static_cast<double>(bytesPerPass) * PASS_COUNT / (GetNowSeconds() - startSeconds) / 1e9;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(FullFrameThroughput)
+{
+    std::vector<uint8_t> const frame(static_cast<size_t>(FRAME_WIDTH) * FRAME_HEIGHT * 4, 0x5A);
+    std::vector<uint8_t>       destination(frame.size());
+    sPixelFrameView const      view = {frame.data(), FRAME_WIDTH, FRAME_HEIGHT, static_cast<size_t>(FRAME_WIDTH) * 4};
+
+    sPixelExtractJob job;
+    job.m_sourceRect       = sPixelRect{0, 0, FRAME_WIDTH, FRAME_HEIGHT};
+    job.m_destination      = destination.data();
+    job.m_destinationPitch = static_cast<size_t>(FRAME_WIDTH) * 4;
+    job.m_flipY            = true;
+
+    job.m_swapRedBlue = true;
+    double const scalarGigabytes = MeasureGigabytesPerSecond(frame.size(), [&] { PixelExtraction::ExtractScalar(view, job); });
+
+    job.m_swapRedBlue = false;
+    double const memcpyGigabytes = MeasureGigabytesPerSecond(frame.size(), [&] { PixelExtraction::Extract(view, job, ePixelKernel::SCALAR); });
+
+    job.m_swapRedBlue = true;
+    double const ssse3Gigabytes = MeasureGigabytesPerSecond(frame.size(), [&] { PixelExtraction::Extract(view, job, ePixelKernel::SSSE3); });
+    double const avx2Gigabytes  = MeasureGigabytesPerSecond(frame.size(), [&] { PixelExtraction::Extract(view, job, ePixelKernel::AVX2); });
+
+    std::printf("    %dx%d, best kernel %d\n", FRAME_WIDTH, FRAME_HEIGHT, static_cast<int>(PixelExtraction::GetBestSupportedKernel()));
+    std::printf("    scalar reference (swap): %.1f GB/s\n", scalarGigabytes);
+    std::printf("    memcpy rows:             %.1f GB/s\n", memcpyGigabytes);
+    std::printf("    SSSE3 swap:              %.1f GB/s\n", ssse3Gigabytes);
+    std::printf("    AVX2 swap:               %.1f GB/s\n", avx2Gigabytes);
+
+    CHECK(memcpyGigabytes > scalarGigabytes);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(WindowJobsThroughputByThreadCount)
+{
+    constexpr int JOB_COLUMNS = 8;
+    constexpr int JOB_ROWS    = 8;
+    constexpr int JOB_WIDTH   = FRAME_WIDTH / JOB_COLUMNS;
+    constexpr int JOB_HEIGHT  = FRAME_HEIGHT / JOB_ROWS;
+
+    std::vector<uint8_t> const frame(static_cast<size_t>(FRAME_WIDTH) * FRAME_HEIGHT * 4, 0x5A);
+    sPixelFrameView const      view = {frame.data(), FRAME_WIDTH, FRAME_HEIGHT, static_cast<size_t>(FRAME_WIDTH) * 4};
+
+    std::vector<std::vector<uint8_t>> destinations;
+    std::vector<sPixelExtractJob>     jobs;
+    for (int row = 0; row < JOB_ROWS; ++row)
+    {
+        for (int column = 0; column < JOB_COLUMNS; ++column)
+        {
+            destinations.emplace_back(static_cast<size_t>(JOB_WIDTH) * JOB_HEIGHT * 4);
+
+            sPixelExtractJob job;
+            job.m_sourceRect       = sPixelRect{column * JOB_WIDTH, row * JOB_HEIGHT, (column + 1) * JOB_WIDTH, (row + 1) * JOB_HEIGHT};
+            job.m_destination      = destinations.back().data();
+            job.m_destinationPitch = static_cast<size_t>(JOB_WIDTH) * 4;
+            job.m_swapRedBlue      = true;
+            job.m_flipY            = true;
+            jobs.push_back(job);
+        }
+    }
+
+    std::printf("    %d jobs of %dx%d, %u hardware threads\n", JOB_COLUMNS * JOB_ROWS, JOB_WIDTH, JOB_HEIGHT, std::thread::hardware_concurrency());
+    for (int const threadCount : {1, 2, 4})
+    {
+        double const gigabytes = MeasureGigabytesPerSecond(frame.size(), [&] { PixelExtraction::Extract(view, jobs, PixelExtraction::GetBestSupportedKernel(), threadCount); });
+        std::printf("    %d thread(s): %.1f GB/s\n", threadCount, gigabytes);
+    }
+}
@@ -0,0 +1,149 @@
+//----------------------------------------------------------------------------------------------------
+// PixelExtractionTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Harness/TestHarness.hpp"
+#include "Subsystem/Window/PixelExtraction.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int FRAME_WIDTH  = 1280;
+    constexpr int FRAME_HEIGHT = 720;
+    constexpr int FRAME_PITCH  = FRAME_WIDTH * 4 + 64;     // Padded rows, as a mapped staging texture has
+
+    std::vector<uint8_t> MakeFrame()
+    {
+        std::vector<uint8_t> pixels(static_cast<size_t>(FRAME_PITCH) * FRAME_HEIGHT);
+        for (size_t i = 0; i < pixels.size(); ++i)
+        {
+            pixels[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+        }
+        return pixels;
+    }
+
+    // Widths cover the 4- and 8-pixel shuffle bodies and every scalar tail length
+    sPixelRect MakeRandomRect(RandomNumberGenerator& rng)
+    {
+        int const width  = rng.RollRandomIntInRange(1, 300);
+        int const height = rng.RollRandomIntInRange(1, 200);
+        int const left   = rng.RollRandomIntInRange(0, FRAME_WIDTH - width);
+        int const top    = rng.RollRandomIntInRange(0, FRAME_HEIGHT - height);
+        return sPixelRect{left, top, left + width, top + height};
+    }
+
+    struct sJobBuffers
+    {
+        sPixelExtractJob     m_job;
+        std::vector<uint8_t> m_pixels;
+    };
+
+    // Destination rows are padded too, and the padding must survive untouched
+    sJobBuffers MakeJob(sPixelRect const& rect, bool const swapRedBlue, bool const flipY)
+    {
+        sJobBuffers buffers;
+        buffers.m_job.m_sourceRect       = rect;
+        buffers.m_job.m_destinationPitch = static_cast<size_t>(rect.GetWidth()) * 4 + 12;
+        buffers.m_job.m_swapRedBlue      = swapRedBlue;
+        buffers.m_job.m_flipY            = flipY;
+        buffers.m_pixels.assign(buffers.m_job.m_destinationPitch * static_cast<size_t>(rect.GetHeight()), 0xCD);
+        buffers.m_job.m_destination = buffers.m_pixels.data();
+        return buffers;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(EveryKernelMatchesTheScalarReference)
+{
+    std::vector<uint8_t> const frame = MakeFrame();
+    sPixelFrameView const      view  = {frame.data(), FRAME_WIDTH, FRAME_HEIGHT, FRAME_PITCH};
+
+    RandomNumberGenerator rng;
+    int                   mismatchCount = 0;
+
+    for (int rectIndex = 0; rectIndex < 200; ++rectIndex)
+    {
+        sPixelRect const rect = MakeRandomRect(rng);
+
+        for (int options = 0; options < 4; ++options)
+        {
+            bool const  swapRedBlue = (options & 1) != 0;
+            bool const  flipY       = (options & 2) != 0;
+            sJobBuffers reference   = MakeJob(rect, swapRedBlue, flipY);
+            PixelExtraction::ExtractScalar(view, reference.m_job);
+
+            for (ePixelKernel const kernel : {ePixelKernel::SCALAR, ePixelKernel::SSSE3, ePixelKernel::AVX2})
+            {
+                sJobBuffers extracted = MakeJob(rect, swapRedBlue, flipY);
+                PixelExtraction::Extract(view, extracted.m_job, kernel);
+                if (extracted.m_pixels != reference.m_pixels) ++mismatchCount;
+            }
+        }
+    }
+
+    CHECK_EQUAL(mismatchCount, 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ScalarReferenceSwapsAndFlips)
+{
+    // Two rows of two pixels: BGRA values 0..15
+    uint8_t frame[16];
+    for (int i = 0; i < 16; ++i) frame[i] = static_cast<uint8_t>(i);
+    sPixelFrameView const view = {frame, 2, 2, 8};
+
+    sJobBuffers buffers = MakeJob(sPixelRect{1, 0, 2, 2}, true, true);
+    PixelExtraction::ExtractScalar(view, buffers.m_job);
+
+    // Bottom source row first, red and blue swapped
+    uint8_t const expectedFirstRow[4]  = {14, 13, 12, 15};
+    uint8_t const expectedSecondRow[4] = {6, 5, 4, 7};
+    CHECK(std::memcmp(buffers.m_pixels.data(), expectedFirstRow, 4) == 0);
+    CHECK(std::memcmp(buffers.m_pixels.data() + buffers.m_job.m_destinationPitch, expectedSecondRow, 4) == 0);
+    CHECK_EQUAL(buffers.m_pixels[4], 0xCD);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ThreadedJobsMatchTheScalarReference)
+{
+    std::vector<uint8_t> const frame = MakeFrame();
+    sPixelFrameView const      view  = {frame.data(), FRAME_WIDTH, FRAME_HEIGHT, FRAME_PITCH};
+
+    RandomNumberGenerator         rng;
+    std::vector<sJobBuffers>      references;
+    std::vector<sJobBuffers>      extracted;
+    std::vector<sPixelExtractJob> jobs;
+
+    for (int jobIndex = 0; jobIndex < 40; ++jobIndex)
+    {
+        sPixelRect const rect        = MakeRandomRect(rng);
+        bool const       swapRedBlue = (jobIndex & 1) != 0;
+        bool const       flipY       = (jobIndex & 2) != 0;
+
+        references.push_back(MakeJob(rect, swapRedBlue, flipY));
+        PixelExtraction::ExtractScalar(view, references.back().m_job);
+        extracted.push_back(MakeJob(rect, swapRedBlue, flipY));
+    }
+
+    // Moving a sJobBuffers keeps its pixel buffer, so the destinations are stable from here on
+    for (sJobBuffers const& buffers : extracted) jobs.push_back(buffers.m_job);
+
+    for (int const threadCount : {1, 3, 8})
+    {
+        for (sJobBuffers& buffers : extracted) std::fill(buffers.m_pixels.begin(), buffers.m_pixels.end(), 0xCD);
+        PixelExtraction::Extract(view, jobs, PixelExtraction::GetBestSupportedKernel(), threadCount);
+
+        int mismatchCount = 0;
+        for (size_t i = 0; i < extracted.size(); ++i)
+        {
+            if (extracted[i].m_pixels != references[i].m_pixels) ++mismatchCount;
+        }
+        CHECK_EQUAL(mismatchCount, 0);
+    }
+}
@@ -0,0 +1,186 @@
+//----------------------------------------------------------------------------------------------------
+// ReadbackPlannerTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+
+#include "Game/Subsystem/Window/ReadbackPlanner.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int BYTES_PER_PIXEL = 4;
+
+    sPixelRect MakeRect(int const left, int const top, int const width, int const height)
+    {
+        return sPixelRect{left, top, left + width, top + height};
+    }
+
+    sReadbackPlan BuildPlan(std::vector<sPixelRect> rects, int const backbufferWidth = 1920, int const backbufferHeight = 1080)
+    {
+        sReadbackPlan plan;
+        ReadbackPlanner::BuildReadbackPlan(rects, backbufferWidth, backbufferHeight, BYTES_PER_PIXEL, plan);
+        return plan;
+    }
+
+    // Brute-force pixel count of the union of rects clipped to the backbuffer
+    size_t CountCoveredPixels(std::vector<sPixelRect> const& rects, int const backbufferWidth, int const backbufferHeight)
+    {
+        std::vector<uint8_t> isCovered(static_cast<size_t>(backbufferWidth) * static_cast<size_t>(backbufferHeight), 0);
+
+        for (sPixelRect const& rect : rects)
+        {
+            sPixelRect const clipped = ReadbackPlanner::GetClipped(rect, backbufferWidth, backbufferHeight);
+            for (int y = clipped.m_top; y < clipped.m_bottom; ++y)
+            {
+                for (int x = clipped.m_left; x < clipped.m_right; ++x)
+                {
+                    isCovered[static_cast<size_t>(y) * backbufferWidth + x] = 1;
+                }
+            }
+        }
+
+        size_t coveredCount = 0;
+        for (uint8_t const covered : isCovered)
+        {
+            coveredCount += covered;
+        }
+        return coveredCount;
+    }
+
+    bool HasOverlappingRects(std::vector<sPixelRect> const& rects)
+    {
+        for (size_t i = 0; i < rects.size(); ++i)
+        {
+            for (size_t j = i + 1; j < rects.size(); ++j)
+            {
+                if (ReadbackPlanner::DoRectsOverlap(rects[i], rects[j])) return true;
+            }
+        }
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ClippingKeepsOnlyBackbufferPixels)
+{
+    sPixelRect const clipped = ReadbackPlanner::GetClipped(MakeRect(-50, 1000, 200, 200), 1920, 1080);
+
+    CHECK_EQUAL(clipped.m_left, 0);
+    CHECK_EQUAL(clipped.m_top, 1000);
+    CHECK_EQUAL(clipped.m_right, 150);
+    CHECK_EQUAL(clipped.m_bottom, 1080);
+    CHECK_EQUAL(clipped.GetArea(), 150u * 80u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(OffScreenWindowsLeaveAnEmptyPlan)
+{
+    sReadbackPlan const plan = BuildPlan({MakeRect(-300, 100, 200, 200), MakeRect(2000, 100, 200, 200), MakeRect(100, 1080, 200, 200)});
+
+    CHECK(plan.IsEmpty());
+    CHECK_EQUAL(plan.m_bytesToCopy, 0u);
+    CHECK_EQUAL(plan.m_fullFrameBytes, 1920u * 1080u * BYTES_PER_PIXEL);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(RectsSharingAFullEdgeMerge)
+{
+    sReadbackPlan const plan = BuildPlan({MakeRect(100, 100, 200, 200), MakeRect(300, 100, 200, 200)});
+
+    CHECK_EQUAL(plan.m_rects.size(), 1u);
+    CHECK_EQUAL(plan.m_bytesToCopy, 400u * 200u * BYTES_PER_PIXEL);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(NestedRectMergesIntoItsContainer)
+{
+    sReadbackPlan const plan = BuildPlan({MakeRect(100, 100, 700, 500), MakeRect(200, 200, 200, 200)});
+
+    CHECK_EQUAL(plan.m_rects.size(), 1u);
+    CHECK_EQUAL(plan.m_bytesToCopy, 700u * 500u * BYTES_PER_PIXEL);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(CornerTouchingRectsStaySeparate)
+{
+    sReadbackPlan const plan = BuildPlan({MakeRect(100, 100, 200, 200), MakeRect(300, 300, 200, 200)});
+
+    CHECK_EQUAL(plan.m_rects.size(), 2u);
+    CHECK_EQUAL(plan.m_bytesToCopy, 2u * 200u * 200u * BYTES_PER_PIXEL);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(CrossingRectsAreNotGrownToTheirBoundingBox)
+{
+    // A 100 x 1000 bar and a 1000 x 100 bar crossing in the middle: 190,000 pixels, not 1,000,000
+    sReadbackPlan const plan = BuildPlan({MakeRect(450, 0, 100, 1000), MakeRect(0, 450, 1000, 100)});
+
+    CHECK_EQUAL(plan.m_bytesToCopy, 190000u * BYTES_PER_PIXEL);
+    CHECK(!HasOverlappingRects(plan.m_rects));
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(PartialOverlapIsCopiedOnce)
+{
+    sReadbackPlan const plan = BuildPlan({MakeRect(100, 100, 200, 200), MakeRect(200, 150, 200, 200)});
+
+    CHECK_EQUAL(plan.m_bytesToCopy, CountCoveredPixels({MakeRect(100, 100, 200, 200), MakeRect(200, 150, 200, 200)}, 1920, 1080) * BYTES_PER_PIXEL);
+    CHECK(!HasOverlappingRects(plan.m_rects));
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(RectMinusRectCoversTheRemainderExactly)
+{
+    sPixelRect const rect = MakeRect(0, 0, 100, 100);
+    sPixelRect const cut  = MakeRect(25, 40, 50, 20);
+
+    sPixelRect pieces[4];
+    int const  pieceCount = ReadbackPlanner::GetRectMinusRect(rect, cut, pieces);
+
+    size_t pieceArea = 0;
+    for (int i = 0; i < pieceCount; ++i)
+    {
+        CHECK(!ReadbackPlanner::DoRectsOverlap(pieces[i], cut));
+        pieceArea += pieces[i].GetArea();
+    }
+
+    CHECK_EQUAL(pieceCount, 4);
+    CHECK_EQUAL(pieceArea, 100u * 100u - 50u * 20u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(PlanMatchesBruteForceCoverage)
+{
+    // Deterministic LCG so a failure reproduces
+    uint32_t state = 12345u;
+    auto     roll  = [&state](int const range)
+    {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<int>((state >> 8) % static_cast<uint32_t>(range));
+    };
+
+    constexpr int BACKBUFFER_WIDTH  = 320;
+    constexpr int BACKBUFFER_HEIGHT = 180;
+
+    for (int trial = 0; trial < 200; ++trial)
+    {
+        std::vector<sPixelRect> rects;
+        int const               rectCount = 1 + roll(12);
+
+        for (int i = 0; i < rectCount; ++i)
+        {
+            rects.push_back(MakeRect(roll(BACKBUFFER_WIDTH + 60) - 30, roll(BACKBUFFER_HEIGHT + 60) - 30, 1 + roll(120), 1 + roll(90)));
+        }
+
+        size_t const        expectedPixels = CountCoveredPixels(rects, BACKBUFFER_WIDTH, BACKBUFFER_HEIGHT);
+        sReadbackPlan const plan           = BuildPlan(rects, BACKBUFFER_WIDTH, BACKBUFFER_HEIGHT);
+
+        CHECK_EQUAL(plan.m_bytesToCopy, expectedPixels * BYTES_PER_PIXEL);
+        CHECK(!HasOverlappingRects(plan.m_rects));
+        CHECK(plan.m_bytesToCopy <= plan.m_fullFrameBytes);
+    }
+}
@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------------------------------
+// WindowGrowthBenchmark.cpp
+// 1000 bullets reaching the player window's right edge in one frame: one animation restart per hit,
+// as before, against the hits summed into one RequestWindowGrowth.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <chrono>
+
+#include "Harness/TestHarness.hpp"
+#include "Subsystem/Window/WindowSubsystemFixture.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int BULLET_COUNT = 1000;
+    constexpr int FRAME_COUNT  = 200;
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Runs FRAME_COUNT frames of BULLET_COUNT right-edge hits; returns the ms per frame spent issuing
+    // the hits and updating the subsystem, and the width the window gained
+    double RunBulletFrames(bool const isCoalesced, float& outWidthGained)
+    {
+        sWindowSubsystemFixture fixture;
+
+        WindowID const windowID   = fixture.m_windowSubsystem.CreateChildWindow(1, "Player", 760, 340, 400, 400);
+        Window const*  window     = fixture.m_windowSubsystem.GetWindowData(windowID)->m_window.get();
+        float const    startWidth = window->GetWindowDimensions().x;
+
+        double elapsedSeconds = 0.0;
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            double const startSeconds = GetNowSeconds();
+
+            if (isCoalesced)
+            {
+                Vec2 positionDelta  = Vec2::ZERO;
+                Vec2 dimensionDelta = Vec2::ZERO;
+
+                for (int bullet = 0; bullet < BULLET_COUNT; ++bullet)
+                {
+                    positionDelta += Vec2(10.f, 0.f);
+                    dimensionDelta += Vec2(10.f, 0.f);
+                }
+
+                fixture.m_windowSubsystem.RequestWindowGrowth(windowID, positionDelta, dimensionDelta, 0.1f);
+            }
+            else
+            {
+                for (int bullet = 0; bullet < BULLET_COUNT; ++bullet)
+                {
+                    Vec2 const position   = window->GetWindowPosition();
+                    Vec2 const dimensions = window->GetWindowDimensions();
+                    fixture.m_windowSubsystem.AnimateWindowPositionAndDimensions(windowID, position + Vec2(10.f, 0.f), dimensions + Vec2(10.f, 0.f), 0.1f);
+                }
+            }
+
+            fixture.m_windowSubsystem.Update(FRAME_SECONDS, true);
+            elapsedSeconds += GetNowSeconds() - startSeconds;
+
+            fixture.Render();
+            fixture.m_windowSubsystem.EndFrame();
+            fixture.m_frameArena.EndFrame();
+            fixture.m_windowSubsystem.BeginFrame();
+        }
+
+        for (int frame = 0; frame < 20; ++frame)
+        {
+            fixture.RunFrame();
+        }
+
+        outWidthGained = window->GetWindowDimensions().x - startWidth;
+        return elapsedSeconds * 1000.0 / FRAME_COUNT;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ThousandBulletEdgeHitsPerFrame)
+{
+    float        perHitWidthGained     = 0.f;
+    float        coalescedWidthGained  = 0.f;
+    double const perHitMilliseconds    = RunBulletFrames(false, perHitWidthGained);
+    double const coalescedMilliseconds = RunBulletFrames(true, coalescedWidthGained);
+
+    std::printf("    %d hits per frame for %d frames\n", BULLET_COUNT, FRAME_COUNT);
+    std::printf("    animation per hit:     %.4f ms/frame, window grew %.0f px\n", perHitMilliseconds, perHitWidthGained);
+    std::printf("    one growth per frame:  %.4f ms/frame, window grew %.0f px\n", coalescedMilliseconds, coalescedWidthGained);
+
+    CHECK_EQUAL(coalescedWidthGained, static_cast<float>(BULLET_COUNT * FRAME_COUNT * 10));
+}
@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------------------------------
+// WindowLookupBenchmark.cpp
+// The per-frame child window show / hide Entity::Update issues for 500 bound entities: through
+// ShowWindowByWindowID / HideWindowByWindowID, one hash lookup each, as before, against the
+// WindowData* cached at bind time. 2000 frames; hash lookups per frame and ns per entity.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <chrono>
+#include <vector>
+
+#include "Harness/TestHarness.hpp"
+#include "Subsystem/Window/WindowSubsystemFixture.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    constexpr int ENTITY_COUNT = 500;
+    constexpr int FRAME_COUNT  = 2000;
+
+    double GetNowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Returns ns per entity spent in the show / hide calls
+    double RunVisibilityFrames(bool const isCached, size_t& outLookupsPerFrame)
+    {
+        sWindowSubsystemFixture  fixture;
+        std::vector<WindowID>    windowIDs;
+        std::vector<WindowData*> boundWindows;
+
+        for (EntityID owner = 1; owner <= ENTITY_COUNT; ++owner)
+        {
+            WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(owner, "Enemy", static_cast<int>(owner % 40) * 40, 100, 200, 200);
+            windowIDs.push_back(windowID);
+            boundWindows.push_back(fixture.m_windowSubsystem.GetWindowData(windowID));
+        }
+
+        fixture.m_windowSubsystem.BeginFrame();
+        double elapsedSeconds = 0.0;
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            double const startSeconds = GetNowSeconds();
+
+            for (int index = 0; index < ENTITY_COUNT; ++index)
+            {
+                bool const isVisible = ((index + frame / 60) & 1) == 0;
+                if (isCached)
+                {
+                    isVisible ? fixture.m_windowSubsystem.ShowWindow(boundWindows[index]) : fixture.m_windowSubsystem.HideWindow(boundWindows[index]);
+                }
+                else
+                {
+                    isVisible ? fixture.m_windowSubsystem.ShowWindowByWindowID(windowIDs[index]) : fixture.m_windowSubsystem.HideWindowByWindowID(windowIDs[index]);
+                }
+            }
+
+            elapsedSeconds += GetNowSeconds() - startSeconds;
+
+            // Publishes this frame's lookups; the subsystem's own Update / Render are not part of the comparison
+            fixture.m_windowSubsystem.BeginFrame();
+            outLookupsPerFrame = fixture.m_windowSubsystem.GetLookupCountLastFrame();
+        }
+
+        return elapsedSeconds * 1e9 / (static_cast<double>(FRAME_COUNT) * ENTITY_COUNT);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(BoundEntityVisibilityLookups)
+{
+    size_t       byIDLookups   = 0;
+    size_t       cachedLookups = 0;
+    double const byIDNanoseconds   = RunVisibilityFrames(false, byIDLookups);
+    double const cachedNanoseconds = RunVisibilityFrames(true, cachedLookups);
+
+    std::printf("    %d entities by WindowID:    %4zu lookups/frame, %.1f ns/entity\n", ENTITY_COUNT, byIDLookups, byIDNanoseconds);
+    std::printf("    %d entities by WindowData*: %4zu lookups/frame, %.1f ns/entity\n", ENTITY_COUNT, cachedLookups, cachedNanoseconds);
+
+    CHECK_EQUAL(byIDLookups, static_cast<size_t>(ENTITY_COUNT));
+    CHECK_EQUAL(cachedLookups, 0u);
+}
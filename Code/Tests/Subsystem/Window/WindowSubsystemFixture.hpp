@@ -0,0 +1,66 @@
+//----------------------------------------------------------------------------------------------------
+// WindowSubsystemFixture.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/FrameArena.hpp"
+#include "Game/Subsystem/Window/WindowSubsystem.hpp"
+#include "Subsystem/Window/FakeWindowBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+inline constexpr float FRAME_SECONDS = 1.f / 60.f;
+
+//----------------------------------------------------------------------------------------------------
+// Everything WindowSubsystem reaches through globals, pointed at locals for one test
+//----------------------------------------------------------------------------------------------------
+struct sWindowSubsystemFixture
+{
+    FakeWindowBackend m_backend;
+    Window            m_mainWindow = Window(sWindowConfig{});
+    Renderer          m_renderer;
+    FrameArena        m_frameArena = FrameArena(sFrameArenaConfig{});
+    WindowSubsystem   m_windowSubsystem;
+
+    std::vector<sWindowGeometry> m_drawnGeometry;     // Stands in for the batch; Render() draws the frame just simulated
+
+    explicit sWindowSubsystemFixture(sWindowSubsystemConfig config = sWindowSubsystemConfig{})
+        : m_windowSubsystem(WithBackend(config, &m_backend))
+    {
+        Window::s_mainWindow = &m_mainWindow;
+        g_renderer           = &m_renderer;
+        g_frameArena         = &m_frameArena;
+    }
+
+    ~sWindowSubsystemFixture()
+    {
+        m_windowSubsystem.ShutDown();
+        Window::s_mainWindow = nullptr;
+        g_renderer           = nullptr;
+        g_frameArena         = nullptr;
+    }
+
+    // One App frame: BeginFrame, Update, Render, EndFrame, then the counters for that frame are read
+    void RunFrame(bool const isGameplayRunning = true)
+    {
+        m_windowSubsystem.BeginFrame();
+        m_windowSubsystem.Update(FRAME_SECONDS, isGameplayRunning);
+        Render();
+        m_windowSubsystem.EndFrame();
+        m_frameArena.EndFrame();
+    }
+
+    // Renders with no render-prep latency: the geometry drawn is the geometry just updated
+    void Render()
+    {
+        m_windowSubsystem.GetWindowGeometry(m_drawnGeometry);
+        m_windowSubsystem.Render(m_drawnGeometry);
+    }
+
+    static sWindowSubsystemConfig WithBackend(sWindowSubsystemConfig config, IWindowBackend* backend)
+    {
+        config.m_backend = backend;
+        return config;
+    }
+};
@@ -0,0 +1,621 @@
+//----------------------------------------------------------------------------------------------------
+// WindowSubsystemTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <vector>
+
+#include "Game/Gameplay/ProjectileSystem.hpp"
+#include "Harness/TestHarness.hpp"
+#include "Subsystem/Window/WindowSubsystemFixture.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    size_t GetOSCallsOfLastFrame(sWindowSubsystemFixture& fixture)
+    {
+        // BeginFrame publishes the previous frame's count
+        fixture.m_windowSubsystem.BeginFrame();
+        return fixture.m_windowSubsystem.GetOSCallCountLastFrame();
+    }
+
+    // Same per-edge growth Game::UpdateProjectiles sums before its one RequestWindowGrowth per frame
+    void AddEdgeGrowth(eProjectileEdge const edge, Vec2& positionDelta, Vec2& dimensionDelta)
+    {
+        switch (edge)
+        {
+        case eProjectileEdge::RIGHT:  positionDelta += Vec2(10.f, 0.f);  dimensionDelta += Vec2(10.f, 0.f); break;
+        case eProjectileEdge::LEFT:   positionDelta += Vec2(-20.f, 0.f); dimensionDelta += Vec2(10.f, 0.f); break;
+        case eProjectileEdge::TOP:    positionDelta += Vec2(0.f, 10.f);  dimensionDelta += Vec2(0.f, 10.f); break;
+        case eProjectileEdge::BOTTOM: positionDelta += Vec2(0.f, -20.f); dimensionDelta += Vec2(0.f, 10.f); break;
+        }
+    }
+
+    // Fires bulletCount bullets from the middle of the window in the given spawn order and grows the
+    // window from their edge hits the way Game::UpdateProjectiles does for four seconds; returns the
+    // settled geometry
+    AABB2 GrowWindowFromBullets(int const bulletCount, bool const isReversed, int& outEdgeHitCount, Vec2& outStartDimensions)
+    {
+        sWindowSubsystemFixture fixture;
+        ProjectileSystem        projectiles(sProjectileSystemConfig{});
+
+        WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Player", 760, 340, 400, 400);
+        Window const*  window   = fixture.m_windowSubsystem.GetWindowData(windowID)->m_window.get();
+
+        outStartDimensions = window->GetWindowDimensions();
+
+        for (int i = 0; i < bulletCount; ++i)
+        {
+            int const bullet = isReversed ? bulletCount - 1 - i : i;
+            projectiles.SpawnProjectile(Vec2(960.f, 540.f), Vec2::MakeFromPolarDegrees(360.f * static_cast<float>(bullet) / static_cast<float>(bulletCount)),
+                                        150.f + static_cast<float>(bullet % 7) * 40.f, 4.f, eProjectileFaction::PLAYER, Rgba8::WHITE);
+        }
+
+        std::vector<eProjectileEdge> edgeHits;
+        outEdgeHitCount = 0;
+
+        for (int frame = 0; frame < 240; ++frame)
+        {
+            projectiles.Update(FRAME_SECONDS);
+
+            Vec2 const windowPosition = window->GetWindowPosition();
+            projectiles.CollectEdgeHits(AABB2(windowPosition, windowPosition + window->GetWindowDimensions()), edgeHits);
+
+            if (!edgeHits.empty())
+            {
+                Vec2 positionDelta  = Vec2::ZERO;
+                Vec2 dimensionDelta = Vec2::ZERO;
+
+                for (eProjectileEdge const edge : edgeHits)
+                {
+                    AddEdgeGrowth(edge, positionDelta, dimensionDelta);
+                }
+
+                fixture.m_windowSubsystem.RequestWindowGrowth(windowID, positionDelta, dimensionDelta, 0.1f);
+                outEdgeHitCount += static_cast<int>(edgeHits.size());
+            }
+
+            fixture.RunFrame();
+        }
+
+        // Let the last requested growth finish animating
+        for (int frame = 0; frame < 20; ++frame)
+        {
+            fixture.RunFrame();
+        }
+
+        return AABB2(window->GetWindowPosition(), window->GetWindowPosition() + window->GetWindowDimensions());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(NewWindowIsShownOnceAndNotRePlaced)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Enemy", 100, 100, 200, 200);
+    CHECK(windowID != INVALID_WINDOW_ID);
+    CHECK_EQUAL(fixture.m_backend.m_createCount, 1);
+    CHECK_EQUAL(fixture.m_backend.m_showCount, 1);
+    CHECK_EQUAL(fixture.m_backend.m_titleCount, 0);
+
+    // The OS placed it where it was asked to, so the first geometry pass sends nothing
+    fixture.RunFrame();
+    CHECK_EQUAL(fixture.m_backend.m_geometryWindowCount, 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(StillWindowsCostNoOSCallsPerFrame)
+{
+    sWindowSubsystemFixture fixture;
+
+    for (EntityID owner = 1; owner <= 50; ++owner)
+    {
+        fixture.m_windowSubsystem.CreateChildWindow(owner, "Enemy", static_cast<int>(owner) * 10, 100, 200, 200);
+    }
+
+    fixture.RunFrame();
+    fixture.m_backend.ResetCallCounts();
+
+    for (int frame = 0; frame < 120; ++frame)
+    {
+        fixture.RunFrame();
+        CHECK_EQUAL(GetOSCallsOfLastFrame(fixture), 0u);
+    }
+
+    CHECK_EQUAL(fixture.m_backend.GetOSCallCount(), 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(VisibilityIsOnlySentOnTransitions)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Enemy", 100, 100, 200, 200);
+    fixture.m_backend.ResetCallCounts();
+
+    fixture.m_windowSubsystem.ShowWindowByWindowID(windowID);
+    fixture.m_windowSubsystem.ShowWindowByWindowID(windowID);
+    CHECK_EQUAL(fixture.m_backend.m_showCount, 0);
+
+    fixture.m_windowSubsystem.HideWindowByWindowID(windowID);
+    fixture.m_windowSubsystem.HideWindowByWindowID(windowID);
+    CHECK_EQUAL(fixture.m_backend.m_showCount, 1);
+    CHECK(!fixture.m_backend.m_windows.begin()->second.m_isVisible);
+
+    fixture.m_windowSubsystem.ShowWindowByWindowID(windowID);
+    CHECK_EQUAL(fixture.m_backend.m_showCount, 2);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(BoundWindowVisibilityCostsNoLookupsPerFrame)
+{
+    sWindowSubsystemFixture  fixture;
+    std::vector<WindowData*> boundWindows;
+
+    // What NotifyEntityWindowBound hands each entity once, at bind time
+    for (EntityID owner = 1; owner <= 50; ++owner)
+    {
+        WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(owner, "Enemy", static_cast<int>(owner) * 10, 100, 200, 200);
+        boundWindows.push_back(fixture.m_windowSubsystem.GetWindowData(windowID));
+    }
+
+    fixture.RunFrame();
+
+    // Entity::Update shows or hides every bound window every frame through the cached pointer
+    for (int frame = 0; frame < 60; ++frame)
+    {
+        fixture.m_windowSubsystem.BeginFrame();
+        CHECK_EQUAL(fixture.m_windowSubsystem.GetLookupCountLastFrame(), 0u);
+
+        for (size_t index = 0; index < boundWindows.size(); ++index)
+        {
+            bool const isVisible = ((index + static_cast<size_t>(frame / 10)) & 1) == 0;
+            isVisible ? fixture.m_windowSubsystem.ShowWindow(boundWindows[index]) : fixture.m_windowSubsystem.HideWindow(boundWindows[index]);
+        }
+
+        fixture.m_windowSubsystem.Update(FRAME_SECONDS, true);
+        fixture.Render();
+        fixture.m_windowSubsystem.EndFrame();
+        fixture.m_frameArena.EndFrame();
+    }
+
+    fixture.m_windowSubsystem.BeginFrame();
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetLookupCountLastFrame(), 0u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(TitleIsOnlySentWhenItChanges)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "HP 10", 100, 100, 200, 200);
+    fixture.m_backend.ResetCallCounts();
+
+    // Entities rename their window every frame; only a different string reaches the OS
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        fixture.m_windowSubsystem.SetWindowName(windowID, "HP 10");
+    }
+    CHECK_EQUAL(fixture.m_backend.m_titleCount, 0);
+
+    fixture.m_windowSubsystem.SetWindowName(windowID, "HP 9");
+    fixture.m_windowSubsystem.SetWindowName(windowID, "HP 9");
+    CHECK_EQUAL(fixture.m_backend.m_titleCount, 1);
+    CHECK(fixture.m_backend.m_windows.begin()->second.m_title == "HP 9");
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(OSCallCountMatchesBackendCalls)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const first  = fixture.m_windowSubsystem.CreateChildWindow(1, "A", 100, 100, 200, 200);
+    WindowID const second = fixture.m_windowSubsystem.CreateChildWindow(2, "B", 400, 100, 200, 200);
+    fixture.RunFrame();
+    fixture.m_backend.ResetCallCounts();
+
+    fixture.m_windowSubsystem.BeginFrame();
+    fixture.m_windowSubsystem.SetWindowName(first, "A2");
+    fixture.m_windowSubsystem.HideWindowByWindowID(second);
+    fixture.m_windowSubsystem.Update(FRAME_SECONDS, true);
+    fixture.Render();
+
+    CHECK_EQUAL(GetOSCallsOfLastFrame(fixture), 2u);
+    CHECK_EQUAL(fixture.m_backend.GetOSCallCount(), 2);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(NewWindowClientRectIsInEngineScreenSpace)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Enemy", 100, 50, 200, 150);
+    Window const*  window   = fixture.m_windowSubsystem.GetWindow(windowID);
+
+    // Created with its top-left at (100, 50) in OS space; engine space has a bottom-left origin
+    CHECK(window->GetClientPosition() == Vec2(100.f, 1080.f - 200.f));
+    CHECK(window->GetClientDimensions() == Vec2(200.f, 150.f));
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(MovingWindowsShareOneGeometryBatchPerFrame)
+{
+    sWindowSubsystemFixture fixture;
+
+    std::vector<WindowID> windowIDs;
+    for (EntityID owner = 1; owner <= 10; ++owner)
+    {
+        windowIDs.push_back(fixture.m_windowSubsystem.CreateChildWindow(owner, "Enemy", static_cast<int>(owner) * 50, 100, 200, 200));
+    }
+    fixture.RunFrame();
+    fixture.m_backend.ResetCallCounts();
+
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            fixture.m_windowSubsystem.MoveWindowByOffset(windowIDs[i], Vec2(5.f, 0.f));
+        }
+        fixture.RunFrame();
+
+        CHECK_EQUAL(fixture.m_windowSubsystem.GetGeometryCommitCountLastFrame(), 3u);
+    }
+
+    CHECK_EQUAL(fixture.m_backend.m_geometryBatchCount, 20);
+    CHECK_EQUAL(fixture.m_backend.m_geometryWindowCount, 60);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(DriftBelowThresholdIsHeldBack)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Enemy", 100, 100, 200, 200);
+    fixture.RunFrame();
+    fixture.m_backend.ResetCallCounts();
+
+    // The default threshold is one pixel; quarter-pixel steps reach it on the fourth frame
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        fixture.m_windowSubsystem.MoveWindowByOffset(windowID, Vec2(0.25f, 0.f));
+        fixture.RunFrame();
+    }
+    CHECK_EQUAL(fixture.m_backend.m_geometryWindowCount, 0);
+
+    fixture.m_windowSubsystem.MoveWindowByOffset(windowID, Vec2(0.25f, 0.f));
+    fixture.RunFrame();
+    CHECK_EQUAL(fixture.m_backend.m_geometryWindowCount, 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(AnimationStopsCommittingOnceSettled)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Enemy", 100, 100, 200, 200);
+    fixture.RunFrame();
+    fixture.m_backend.ResetCallCounts();
+
+    Window const* window = fixture.m_windowSubsystem.GetWindow(windowID);
+    fixture.m_windowSubsystem.AnimateWindowPosition(windowID, window->GetWindowPosition() + Vec2(300.f, 0.f), 0.5f);
+
+    // 0.5 seconds at 60 Hz is 30 frames; the eased ends move less than a pixel and may be held back
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        fixture.RunFrame();
+    }
+    int const animationCommits = fixture.m_backend.m_geometryWindowCount;
+    CHECK(animationCommits > 20 && animationCommits <= 30);
+    CHECK(!fixture.m_windowSubsystem.IsWindowAnimating(windowID));
+
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        fixture.RunFrame();
+    }
+    CHECK_EQUAL(fixture.m_backend.m_geometryWindowCount, animationCommits);
+
+    sFakeNativeWindow const& nativeWindow = fixture.m_backend.m_windows.begin()->second;
+    CHECK_EQUAL(nativeWindow.m_clientLeft, 400);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(GeometryWaitsForGameplay)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Enemy", 100, 100, 200, 200);
+    fixture.RunFrame();
+    fixture.m_backend.ResetCallCounts();
+
+    fixture.m_windowSubsystem.MoveWindowByOffset(windowID, Vec2(40.f, 0.f));
+    fixture.RunFrame(false);
+    fixture.RunFrame(false);
+    CHECK_EQUAL(fixture.m_backend.m_geometryBatchCount, 0);
+
+    fixture.RunFrame(true);
+    CHECK_EQUAL(fixture.m_backend.m_geometryBatchCount, 1);
+    CHECK_EQUAL(fixture.m_backend.m_geometryWindowCount, 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(WarmedPoolServesAWaveWithoutCreatingWindows)
+{
+    sWindowSubsystemFixture fixture;
+
+    // Two per call by default; eight idle frames fill the default capacity of sixteen
+    for (int frame = 0; frame < 8; ++frame)
+    {
+        fixture.m_windowSubsystem.WarmWindowPool(200, 200);
+    }
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetPooledWindowCount(), 16u);
+    CHECK_EQUAL(fixture.m_backend.m_createCount, 16);
+    CHECK_EQUAL(fixture.m_backend.m_showCount, 0);
+
+    for (EntityID owner = 1; owner <= 16; ++owner)
+    {
+        fixture.m_windowSubsystem.CreateChildWindow(owner, "Enemy", static_cast<int>(owner) * 20, 100, 200, 200);
+    }
+
+    CHECK_EQUAL(fixture.m_backend.m_createCount, 16);
+    CHECK_EQUAL(fixture.m_renderer.m_swapChainCreationCount, 16);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetNativeWindowCreationCount(), 16u);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetPooledWindowCount(), 0u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(DestroyedWindowsAreReusedByTheNextWave)
+{
+    sWindowSubsystemFixture fixture;
+
+    for (int wave = 0; wave < 5; ++wave)
+    {
+        std::vector<WindowID> windowIDs;
+        for (EntityID owner = 1; owner <= 10; ++owner)
+        {
+            windowIDs.push_back(fixture.m_windowSubsystem.CreateChildWindow(owner, "Enemy", static_cast<int>(owner) * 20, 100, 200, 200));
+        }
+        for (WindowID const windowID : windowIDs)
+        {
+            fixture.m_windowSubsystem.DestroyWindow(windowID);
+        }
+    }
+
+    CHECK_EQUAL(fixture.m_backend.m_createCount, 10);
+    CHECK_EQUAL(fixture.m_renderer.m_swapChainCreationCount, 10);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetPooledWindowCount(), 10u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(PooledWindowIsOnlyReusedAtItsSwapChainSize)
+{
+    sWindowSubsystemFixture fixture;
+
+    fixture.m_windowSubsystem.WarmWindowPool(200, 200);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetPooledWindowCount(), 2u);
+
+    // The shop asks for 700 x 500; stretching a 200 x 200 swap chain over it would blur every frame
+    WindowID const shopID = fixture.m_windowSubsystem.CreateChildWindow(1, "Shop", 600, 300, 700, 500);
+    CHECK_EQUAL(fixture.m_backend.m_createCount, 3);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetPooledWindowCount(), 2u);
+    CHECK(fixture.m_windowSubsystem.GetWindow(shopID)->GetClientDimensions() == Vec2(700.f, 500.f));
+
+    fixture.m_windowSubsystem.CreateChildWindow(2, "Enemy", 100, 100, 200, 200);
+    CHECK_EQUAL(fixture.m_backend.m_createCount, 3);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetPooledWindowCount(), 1u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(RecycledWindowLandsWhereAFreshOneWould)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const freshID  = fixture.m_windowSubsystem.CreateChildWindow(1, "Fresh", 300, 120, 200, 200);
+    Vec2 const     freshPos = fixture.m_windowSubsystem.GetWindow(freshID)->GetClientPosition();
+
+    fixture.m_windowSubsystem.WarmWindowPool(200, 200);
+    fixture.m_backend.ResetCallCounts();
+
+    WindowID const recycledID = fixture.m_windowSubsystem.CreateChildWindow(2, "Recycled", 300, 120, 200, 200);
+    Window const*  recycled   = fixture.m_windowSubsystem.GetWindow(recycledID);
+
+    CHECK(recycled->GetClientPosition() == freshPos);
+    CHECK(recycled->GetClientDimensions() == Vec2(200.f, 200.f));
+
+    // Placed, retitled and shown once at checkout; the next frames send nothing more
+    CHECK_EQUAL(fixture.m_backend.m_placeCount, 1);
+    CHECK_EQUAL(fixture.m_backend.m_titleCount, 1);
+    CHECK_EQUAL(fixture.m_backend.m_showCount, 1);
+
+    fixture.RunFrame();
+    fixture.RunFrame();
+    CHECK_EQUAL(fixture.m_backend.m_geometryWindowCount, 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ReadbackIsSkippedWhenNoWindowIsVisible)
+{
+    sWindowSubsystemFixture fixture;
+
+    fixture.RunFrame();
+    CHECK_EQUAL(fixture.m_renderer.m_stagingReadbackCount, 0);
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Enemy", 100, 100, 200, 200);
+    fixture.RunFrame();
+    CHECK_EQUAL(fixture.m_renderer.m_stagingReadbackCount, 1);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetReadbackBytesLastFrame(), 1920u * 1080u * 4u);
+
+    fixture.m_windowSubsystem.HideWindowByWindowID(windowID);
+    fixture.RunFrame();
+    CHECK_EQUAL(fixture.m_renderer.m_stagingReadbackCount, 1);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetReadbackBytesLastFrame(), 0u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(OccludedWindowIsNotPresentedUntilRaised)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const shopID  = fixture.m_windowSubsystem.CreateChildWindow(1, "Shop", 100, 100, 700, 500);
+    WindowID const enemyID = fixture.m_windowSubsystem.CreateChildWindow(2, "Enemy", 200, 200, 200, 200);
+
+    void* const shopHandle  = fixture.m_windowSubsystem.GetWindowData(shopID)->m_window->GetWindowHandle();
+    void* const enemyHandle = fixture.m_windowSubsystem.GetWindowData(enemyID)->m_window->GetWindowHandle();
+
+    // The shop sits above the enemy it fully contains
+    fixture.m_backend.m_windows[shopHandle].m_zOrder  = 2;
+    fixture.m_backend.m_windows[enemyHandle].m_zOrder = 1;
+    fixture.RunFrame();
+
+    CHECK_EQUAL(fixture.m_renderer.m_viewportPresentCount, 1);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetSkippedPresentCountLastFrame(), 1u);
+
+    // Clicking the enemy brings it to the top; both are drawn again
+    fixture.m_backend.m_windows[enemyHandle].m_zOrder = 3;
+    fixture.RunFrame();
+
+    CHECK_EQUAL(fixture.m_renderer.m_viewportPresentCount, 3);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetSkippedPresentCountLastFrame(), 0u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(OffScreenAndHiddenWindowsAreNotPresented)
+{
+    sWindowSubsystemFixture fixture;
+
+    fixture.m_windowSubsystem.CreateChildWindow(1, "OnScreen", 100, 100, 200, 200);
+    fixture.m_windowSubsystem.CreateChildWindow(2, "OffScreen", -600, 100, 200, 200);
+    WindowID const hiddenID = fixture.m_windowSubsystem.CreateChildWindow(3, "Hidden", 500, 100, 200, 200);
+    fixture.m_windowSubsystem.HideWindowByWindowID(hiddenID);
+    fixture.RunFrame();
+
+    CHECK_EQUAL(fixture.m_renderer.m_viewportPresentCount, 1);
+    CHECK_EQUAL(fixture.m_windowSubsystem.GetSkippedPresentCountLastFrame(), 2u);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(LaggingBatchKeepsWindowsWhereItWasDrawn)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Enemy", 100, 100, 200, 200);
+    Window const*  window   = fixture.m_windowSubsystem.GetWindow(windowID);
+    void* const    handle   = window->GetWindowHandle();
+    fixture.RunFrame();
+
+    // Render prep is a frame behind: the window has moved, the batch being drawn has not
+    std::vector<sWindowGeometry> drawnGeometry;
+    fixture.m_windowSubsystem.GetWindowGeometry(drawnGeometry);
+    Vec2 const drawnPosition = window->GetClientPosition();
+
+    fixture.m_windowSubsystem.MoveWindowByOffset(windowID, Vec2(100.f, 0.f));
+    fixture.m_windowSubsystem.Update(FRAME_SECONDS, true);
+    fixture.m_windowSubsystem.Render(drawnGeometry);
+
+    CHECK_EQUAL(fixture.m_backend.m_windows[handle].m_clientLeft, 100);
+    CHECK(fixture.m_renderer.m_lastPresentClientPosition == drawnPosition);
+    CHECK(window->GetClientPosition() == drawnPosition + Vec2(100.f, 0.f));
+
+    // Once the batch of the move is drawn, the window follows
+    fixture.RunFrame();
+    CHECK_EQUAL(fixture.m_backend.m_windows[handle].m_clientLeft, 200);
+    CHECK(fixture.m_renderer.m_lastPresentClientPosition == window->GetClientPosition());
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(SettledAnimationReachesTheOSBehindALaggingBatch)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID = fixture.m_windowSubsystem.CreateChildWindow(1, "Enemy", 100, 100, 200, 200);
+    Window const*  window   = fixture.m_windowSubsystem.GetWindow(windowID);
+    void* const    handle   = window->GetWindowHandle();
+    fixture.RunFrame();
+
+    // A long animation ends in sub-pixel steps; the last one is only forced out once its own frame is drawn
+    fixture.m_windowSubsystem.AnimateWindowPosition(windowID, window->GetWindowPosition() + Vec2(301.f, 0.f), 0.5f);
+
+    std::vector<sWindowGeometry> drawnGeometry;
+    std::vector<sWindowGeometry> newestGeometry;
+    fixture.m_windowSubsystem.GetWindowGeometry(drawnGeometry);
+
+    for (int frame = 0; frame < 40; ++frame)
+    {
+        fixture.m_windowSubsystem.BeginFrame();
+        fixture.m_windowSubsystem.Update(FRAME_SECONDS, true);
+        fixture.m_windowSubsystem.GetWindowGeometry(newestGeometry);
+        fixture.m_windowSubsystem.Render(drawnGeometry);
+        fixture.m_windowSubsystem.EndFrame();
+        fixture.m_frameArena.EndFrame();
+        drawnGeometry.swap(newestGeometry);
+    }
+
+    CHECK(!fixture.m_windowSubsystem.IsWindowAnimating(windowID));
+    CHECK_EQUAL(fixture.m_backend.m_windows[handle].m_clientLeft, 401);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(GrowthRequestsInOneFrameAllCount)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID  = fixture.m_windowSubsystem.CreateChildWindow(1, "Player", 760, 340, 400, 400);
+    Window const*  window    = fixture.m_windowSubsystem.GetWindowData(windowID)->m_window.get();
+    Vec2 const     startSize = window->GetWindowDimensions();
+
+    for (int hit = 0; hit < 5; ++hit)
+    {
+        fixture.m_windowSubsystem.RequestWindowGrowth(windowID, Vec2(10.f, 0.f), Vec2(10.f, 0.f), 0.1f);
+    }
+
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        fixture.RunFrame();
+    }
+
+    CHECK_EQUAL(window->GetWindowDimensions().x, startSize.x + 50.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(GrowthStacksOnARunningAnimation)
+{
+    sWindowSubsystemFixture fixture;
+
+    WindowID const windowID  = fixture.m_windowSubsystem.CreateChildWindow(1, "Player", 760, 340, 400, 400);
+    Window const*  window    = fixture.m_windowSubsystem.GetWindowData(windowID)->m_window.get();
+    Vec2 const     startSize = window->GetWindowDimensions();
+
+    // The second request lands mid-animation; it must add to the first target, not restart from the current size
+    fixture.m_windowSubsystem.RequestWindowGrowth(windowID, Vec2::ZERO, Vec2(0.f, 30.f), 0.1f);
+    fixture.RunFrame();
+    fixture.RunFrame();
+    fixture.m_windowSubsystem.RequestWindowGrowth(windowID, Vec2::ZERO, Vec2(0.f, 30.f), 0.1f);
+
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        fixture.RunFrame();
+    }
+
+    CHECK_EQUAL(window->GetWindowDimensions().y, startSize.y + 60.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(BulletGrowthDoesNotDependOnBulletOrder)
+{
+    constexpr int BULLET_COUNT = 1000;
+
+    int         forwardHitCount  = 0;
+    int         reversedHitCount = 0;
+    Vec2        startDimensions;
+    AABB2 const forward          = GrowWindowFromBullets(BULLET_COUNT, false, forwardHitCount, startDimensions);
+    AABB2 const reversed         = GrowWindowFromBullets(BULLET_COUNT, true, reversedHitCount, startDimensions);
+
+    CHECK(forwardHitCount > 0);
+    CHECK_EQUAL(forwardHitCount, reversedHitCount);
+    CHECK(forward.m_mins == reversed.m_mins);
+    CHECK(forward.m_maxs == reversed.m_maxs);
+
+    // Every hit grew the window by 10 px along its axis; none was lost to a restarted animation
+    Vec2 const grownBy = forward.GetDimensions() - startDimensions;
+    CHECK_EQUAL(static_cast<int>(grownBy.x + grownBy.y), forwardHitCount * 10);
+}
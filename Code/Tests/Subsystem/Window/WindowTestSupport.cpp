@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------------------------------
+// WindowTestSupport.cpp
+// Link seams for driving WindowSubsystem without Win32 or the full Entity translation unit.
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/Entity.hpp"
+#include "Subsystem/Window/FakeWindowBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+std::unique_ptr<IWindowBackend> CreatePlatformWindowBackend(wchar_t const* iconFilePath)
+{
+    (void)iconFilePath;
+    return std::make_unique<FakeWindowBackend>();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Same bodies as Entity.cpp, which pulls in rendering, input and gameplay
+//----------------------------------------------------------------------------------------------------
+void Entity::BindChildWindow(WindowID const windowID, WindowData* windowData)
+{
+    m_windowID   = windowID;
+    m_window     = windowData->m_window.get();
+    m_windowData = windowData;
+}
+
+void Entity::UnbindChildWindow()
+{
+    m_windowID   = INVALID_WINDOW_ID;
+    m_window     = nullptr;
+    m_windowData = nullptr;
+}
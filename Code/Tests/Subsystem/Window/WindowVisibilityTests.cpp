@@ -0,0 +1,142 @@
+//----------------------------------------------------------------------------------------------------
+// WindowVisibilityTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <vector>
+
+#include "Game/Subsystem/Window/WindowVisibility.hpp"
+#include "Harness/TestHarness.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    sPixelRect const SCREEN_RECT = sPixelRect{0, 0, 1920, 1080};
+
+    sWindowVisibilityInput MakeInput(int const left, int const top, int const width, int const height, bool const isHidden = false)
+    {
+        return sWindowVisibilityInput{sPixelRect{left, top, left + width, top + height}, isHidden};
+    }
+
+    std::vector<eWindowVisibility> Classify(std::vector<sWindowVisibilityInput> const& windowsTopmostFirst)
+    {
+        std::vector<eWindowVisibility> visibility;
+        WindowVisibility::Classify(windowsTopmostFirst, SCREEN_RECT, visibility);
+        return visibility;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(WindowOnScreenIsVisible)
+{
+    std::vector<eWindowVisibility> const visibility = Classify({MakeInput(100, 100, 200, 200)});
+
+    CHECK_EQUAL(visibility.size(), 1u);
+    CHECK(visibility[0] == eWindowVisibility::VISIBLE);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(HiddenWinsOverEveryOtherState)
+{
+    // Hidden is reported even when the rect is also empty or off screen
+    std::vector<eWindowVisibility> const visibility = Classify({MakeInput(100, 100, 200, 200, true),
+                                                                MakeInput(100, 100, 0, 200, true),
+                                                                MakeInput(-500, 100, 200, 200, true)});
+
+    CHECK(visibility[0] == eWindowVisibility::HIDDEN);
+    CHECK(visibility[1] == eWindowVisibility::HIDDEN);
+    CHECK(visibility[2] == eWindowVisibility::HIDDEN);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(EmptyClientRectIsZeroArea)
+{
+    std::vector<eWindowVisibility> const visibility = Classify({MakeInput(100, 100, 0, 200),
+                                                                MakeInput(100, 100, 200, 0),
+                                                                MakeInput(100, 100, -20, 200)});
+
+    CHECK(visibility[0] == eWindowVisibility::ZERO_AREA);
+    CHECK(visibility[1] == eWindowVisibility::ZERO_AREA);
+    CHECK(visibility[2] == eWindowVisibility::ZERO_AREA);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(WindowOutsideTheScreenIsOffScreen)
+{
+    std::vector<eWindowVisibility> const visibility = Classify({MakeInput(-200, 100, 200, 200),     // Touches the left edge only
+                                                                MakeInput(1920, 100, 200, 200),
+                                                                MakeInput(100, -400, 200, 200),
+                                                                MakeInput(100, 1080, 200, 200),
+                                                                MakeInput(-199, 100, 200, 200)});   // One column on screen
+
+    CHECK(visibility[0] == eWindowVisibility::OFF_SCREEN);
+    CHECK(visibility[1] == eWindowVisibility::OFF_SCREEN);
+    CHECK(visibility[2] == eWindowVisibility::OFF_SCREEN);
+    CHECK(visibility[3] == eWindowVisibility::OFF_SCREEN);
+    CHECK(visibility[4] == eWindowVisibility::VISIBLE);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(WindowInsideOneAboveIsOccluded)
+{
+    std::vector<eWindowVisibility> const visibility = Classify({MakeInput(100, 100, 700, 500),
+                                                                MakeInput(200, 200, 200, 200),
+                                                                MakeInput(100, 100, 700, 500)});   // Same rect counts as inside
+
+    CHECK(visibility[0] == eWindowVisibility::VISIBLE);
+    CHECK(visibility[1] == eWindowVisibility::OCCLUDED);
+    CHECK(visibility[2] == eWindowVisibility::OCCLUDED);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(ClassifyIsTopmostFirst)
+{
+    // The same two rects: the big one covers the small one only when it is above it
+    sWindowVisibilityInput const big   = MakeInput(100, 100, 700, 500);
+    sWindowVisibilityInput const small = MakeInput(200, 200, 200, 200);
+
+    std::vector<eWindowVisibility> const bigOnTop   = Classify({big, small});
+    std::vector<eWindowVisibility> const smallOnTop = Classify({small, big});
+
+    CHECK(bigOnTop[1] == eWindowVisibility::OCCLUDED);
+    CHECK(smallOnTop[0] == eWindowVisibility::VISIBLE);
+    CHECK(smallOnTop[1] == eWindowVisibility::VISIBLE);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(PartialCoverIsNotOcclusion)
+{
+    // Two windows above that together cover the one below still leave it visible; only full containment in one window counts
+    std::vector<eWindowVisibility> const visibility = Classify({MakeInput(100, 100, 150, 200),
+                                                                MakeInput(250, 100, 150, 200),
+                                                                MakeInput(150, 150, 200, 100)});
+
+    CHECK(visibility[2] == eWindowVisibility::VISIBLE);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(OnlyVisibleWindowsAboveOcclude)
+{
+    // A hidden or off-screen window above draws nothing, so it cannot cover the window below
+    std::vector<eWindowVisibility> const visibility = Classify({MakeInput(100, 100, 700, 500, true),
+                                                                MakeInput(-800, 100, 700, 500),
+                                                                MakeInput(-700, 200, 100, 100),
+                                                                MakeInput(200, 200, 200, 200)});
+
+    CHECK(visibility[0] == eWindowVisibility::HIDDEN);
+    CHECK(visibility[1] == eWindowVisibility::OFF_SCREEN);
+    CHECK(visibility[2] == eWindowVisibility::OFF_SCREEN);
+    CHECK(visibility[3] == eWindowVisibility::VISIBLE);
+}
+
+//----------------------------------------------------------------------------------------------------
+TEST(OutputHasOneEntryPerInputAndIsReset)
+{
+    std::vector<eWindowVisibility> visibility = {eWindowVisibility::HIDDEN, eWindowVisibility::HIDDEN, eWindowVisibility::HIDDEN};
+
+    WindowVisibility::Classify({MakeInput(100, 100, 200, 200)}, SCREEN_RECT, visibility);
+    CHECK_EQUAL(visibility.size(), 1u);
+
+    WindowVisibility::Classify({}, SCREEN_RECT, visibility);
+    CHECK(visibility.empty());
+}